@@ -12,14 +12,17 @@
 #include <openpose/headers.hpp>
 
 // Calibration
-DEFINE_int32(mode,                      1,              "Select 1 for intrinsic camera parameter calibration, 2 for extrinsic calibration.");
+DEFINE_int32(mode,                      1,              "Select 1 for intrinsic camera parameter calibration, 2 for extrinsic calibration, 3 for"
+                                                        " extrinsic refinement (bundle adjustment), 5 for ground-plane calibration of a single"
+                                                        " camera (`--3d_ground_plane`), and 6 to store the final camera parameters into a binary"
+                                                        " bundle for faster loading.");
 DEFINE_string(calibration_image_dir,    "images/intrinsics/", "Directory where the images for camera parameter calibration are placed.");
 DEFINE_double(grid_square_size_mm,      127.0,          "Chessboard square length (in millimeters).");
 DEFINE_string(grid_number_inner_corners,"9x6",          "Number of inner corners in width and height, i.e., number of total squares in width"
                                                         " and height minus 1.");
-// Mode 1 - Intrinsics
+// Modes 1 and 5 - Intrinsics and ground plane
 DEFINE_string(camera_serial_number,     "18079958",     "Camera serial number.");
-// Mode 2 - Extrinsics
+// Modes 2 and 5 - Extrinsics and ground plane
 DEFINE_bool(omit_distortion,            false,          "Set to true if image views are already undistorted (e.g., if recorded from OpenPose"
                                                         " after intrinsic parameter calibration).");
 DEFINE_bool(combine_cam0_extrinsics,    false,          "Set to true if cam0 extrinsics are not [R=I, t=0]. I will make no effect if cam0 is"
@@ -30,6 +33,12 @@ DEFINE_int32(cam1,                      0,              "Target camera to estima
                                                         " as the world coordinate origin.");
 // Modes 3-4
 DEFINE_int32(number_cameras,            4,              "Number of cameras (for mode 3-4).");
+DEFINE_int32(number_fixed_cameras,      0,              "Mode 3 incremental refinement: cameras 0 to `number_fixed_cameras`-1 keep their already"
+                                                        " refined extrinsics and only the remaining ones (e.g., a new camera) are refined. 0 to"
+                                                        " refine all of them.");
+// Mode 6
+DEFINE_string(undistortion_resolution,  "-1x-1",        "Mode 6: Image resolution whose undistortion maps are also stored in the bundle (e.g.,"
+                                                        " `1920x1080`). Use \"-1x-1\" to only store the camera parameters.");
 // Producer
 DEFINE_string(camera_parameter_folder,  "models/cameraParameters/flir/", "String with the folder where the camera parameters are or will be"
                                                         " located.");
@@ -96,11 +105,37 @@ int openPoseDemo()
             // Run calibration
             op::refineAndSaveExtrinsics(
                 FLAGS_camera_parameter_folder, calibrationImageDir, gridInnerCorners, gridSqureSizeMm,
-                FLAGS_number_cameras, FLAGS_omit_distortion, saveImagesWithCorners);
+                FLAGS_number_cameras, FLAGS_omit_distortion, saveImagesWithCorners, FLAGS_number_fixed_cameras);
             // Logging
             op::opLog("Extrinsic calibration (bundle adjustment) completed!", op::Priority::High);
         }
 
+        // Calibration - Ground plane (single camera)
+        else if (FLAGS_mode == 5)
+        {
+            op::opLog("Running calibration (ground plane)...", op::Priority::High);
+            // Run calibration
+            op::estimateAndSaveGroundPlane(
+                op::formatAsDirectory(FLAGS_camera_parameter_folder), calibrationImageDir, gridInnerCorners,
+                gridSqureSizeMm, FLAGS_camera_serial_number, FLAGS_omit_distortion);
+            // Logging
+            op::opLog("Ground-plane calibration completed!", op::Priority::High);
+        }
+
+        // Camera parameter bundle (faster loading of the camera parameters by OpenPose)
+        else if (FLAGS_mode == 6)
+        {
+            op::opLog("Writing camera parameter bundle...", op::Priority::High);
+            const auto undistortionResolution = op::flagsToPoint(op::String(FLAGS_undistortion_resolution), "-1x-1");
+            std::vector<op::Point<int>> imageSizes;
+            if (undistortionResolution.x > 0 && undistortionResolution.y > 0)
+                imageSizes.emplace_back(undistortionResolution);
+            op::CameraParameterReader cameraParameterReader;
+            cameraParameterReader.writeParameterBundle(
+                op::formatAsDirectory(FLAGS_camera_parameter_folder), imageSizes);
+            // Logging
+            op::opLog("Camera parameter bundle completed!", op::Priority::High);
+        }
         // // Calibration - Extrinsics Refinement with Visual SFM
         // else if (FLAGS_mode == 4)
         // {
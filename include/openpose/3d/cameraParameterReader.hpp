@@ -21,6 +21,8 @@ namespace op
 
         // serialNumbers is optional. If empty, it will load all the XML files available in the
         // cameraParameterPath folder
+        // If the cameraParameterPath folder contains a binary bundle (see writeParameterBundle), it is used instead
+        // of the XML files as long as it is valid and not older than them. It never writes any file
         void readParameters(const std::string& cameraParameterPath,
                             const std::vector<std::string>& serialNumbers = {});
 
@@ -28,8 +30,16 @@ namespace op
         void readParameters(const std::string& cameraParameterPath,
                             const std::string& serialNumber);
 
+        // It also removes the binary bundle of cameraParameterPath (if any), as it would be outdated
         void writeParameters(const std::string& cameraParameterPath) const;
 
+        // It reads all the XML files of cameraParameterPath and stores them in a binary bundle in that folder
+        // (together with the undistortion maps of each one of the imageSizes resolutions), so the following
+        // readParameters() and undistort() calls on that folder are faster. It must be called again whenever the XML
+        // files change, otherwise the bundle is ignored
+        void writeParameterBundle(const std::string& cameraParameterPath,
+                                  const std::vector<Point<int>>& imageSizes = {});
+
         unsigned long long getNumberCameras() const;
 
         const std::vector<std::string>& getCameraSerialNumbers() const;
@@ -0,0 +1,48 @@
+#ifndef OPENPOSE_3D_GROUND_PLANE_LIFTING_HPP
+#define OPENPOSE_3D_GROUND_PLANE_LIFTING_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/pose/enumClasses.hpp>
+
+namespace op
+{
+    /**
+     * GroundPlaneLifting obtains the floor position of each person from a single camera (i.e., monocular 3-D
+     * lifting), by intersecting the ray of each foot keypoint with the ground plane.
+     * The camera matrix must be referred to the ground plane (Z = 0 on the floor), e.g., estimated with the
+     * calibration toolbox (`--mode 5`). The ground-plane homography is simply the inverse of its columns 0, 1, and 3.
+     * The keypoints must be in input image resolution and undistorted (e.g., with `--frame_undistort`) for
+     * accurate results.
+     */
+    class OP_API GroundPlaneLifting
+    {
+    public:
+        /**
+         * @param poseModel Body model. Only its foot keypoints are lifted: the heels and toes (e.g., BODY_25) or the
+         * ankles if the model does not have them (e.g., COCO).
+         * @param minConfidence Minimum confidence of a 2-D keypoint in order to lift it.
+         */
+        explicit GroundPlaneLifting(const PoseModel poseModel = PoseModel::BODY_25, const float minConfidence = 0.2f);
+
+        virtual ~GroundPlaneLifting();
+
+        /**
+         * It lifts the foot keypoints of all the people to the ground plane.
+         * @param poseKeypoints3D Output 3-D keypoints, with the same format than the ones from PoseTriangulation,
+         * i.e., {#people, #body parts, 4} with x-y-z-score, in the units of the camera matrix (meters for the
+         * calibration toolbox). The lifted keypoints keep their 2-D confidence as score, while all other keypoints
+         * are 0.
+         * @param floorPositions Output floor position of each person, i.e., {#people, 3} with x-y-score, where x-y
+         * and score are the average position and confidence of its lifted keypoints (all 0 if none was lifted).
+         */
+        void lift(
+            Array<float>& poseKeypoints3D, Array<float>& floorPositions, const Array<float>& poseKeypoints,
+            const Matrix& cameraMatrix) const;
+
+    private:
+        std::vector<unsigned int> mFootBodyParts;
+        const float mMinConfidence;
+    };
+}
+
+#endif // OPENPOSE_3D_GROUND_PLANE_LIFTING_HPP
@@ -3,9 +3,14 @@
 
 // 3d module
 #include <openpose/3d/cameraParameterReader.hpp>
+#include <openpose/3d/groundPlaneLifting.hpp>
 #include <openpose/3d/jointAngleEstimation.hpp>
 #include <openpose/3d/poseTriangulation.hpp>
+#include <openpose/3d/poseViewRefiner.hpp>
+#include <openpose/3d/wGroundPlaneLifting.hpp>
 #include <openpose/3d/wJointAngleEstimation.hpp>
 #include <openpose/3d/wPoseTriangulation.hpp>
+#include <openpose/3d/wPoseViewRefinerCrop.hpp>
+#include <openpose/3d/wPoseViewRefinerUpdate.hpp>
 
 #endif // OPENPOSE_3D_HEADERS_HPP
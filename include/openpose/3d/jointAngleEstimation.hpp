@@ -25,14 +25,29 @@ namespace op
 
         void initializationOnThread();
 
-        void adamFastFit(Eigen::Matrix<double, 62, 3, Eigen::RowMajor>& adamPose,
-                         Eigen::Vector3d& adamTranslation,
-                         Eigen::Matrix<double, Eigen::Dynamic, 1>& vtVec,
-                         Eigen::Matrix<double, Eigen::Dynamic, 1>& j0Vec,
-                         Eigen::VectorXd& adamFacecoeffsExp,
-                         const Array<float>& poseKeypoints3D,
-                         const Array<float>& faceKeypoints3D,
-                         const std::array<Array<float>, 2>& handKeypoints3D);
+        /**
+         * It fits Adam to each person of poseKeypoints3D, each one on a different thread of a worker pool created
+         * once by the constructor (the calling thread also fits people). It is thread-safe, so a single instance is
+         * shared by all the `--ik_threads` (which also shares the warm starts and the worker pool across them).
+         * The fit of each person is warm started from their last fit if it is recent enough (according to
+         * frameNumber) and the root did not abruptly move. Otherwise, the full (multi-stage) initialization is run,
+         * which is also the only one estimating the shape of the person (kept by the warm started fits). The fit is
+         * skipped (and the last one re-used) if the last solve of that person converged (i.e., it barely changed the
+         * fit) and the target joints barely moved since then.
+         * @param adamPoses, adamTranslations, adamFaceCoeffsExps Resulting fit of each person.
+         * @param vtVec, j0Vec Jacobians of the first person (only filled if returnJacobian).
+         * @param poseIds Person identifiers (e.g., Datum::poseIds), used to match each person with their previous fit.
+         * If empty, people are matched by their index.
+         * @param frameNumber Frame number (e.g., Datum::frameNumber), used to discard too old fits.
+         */
+        void adamFastFit(
+            std::vector<Eigen::Matrix<double, 62, 3, Eigen::RowMajor>,
+                        Eigen::aligned_allocator<Eigen::Matrix<double, 62, 3, Eigen::RowMajor>>>& adamPoses,
+            std::vector<Eigen::Vector3d>& adamTranslations, Eigen::Matrix<double, Eigen::Dynamic, 1>& vtVec,
+            Eigen::Matrix<double, Eigen::Dynamic, 1>& j0Vec, std::vector<Eigen::VectorXd>& adamFaceCoeffsExps,
+            const Array<float>& poseKeypoints3D, const Array<float>& faceKeypoints3D,
+            const std::array<Array<float>, 2>& handKeypoints3D, const Array<long long>& poseIds = Array<long long>{},
+            const unsigned long long frameNumber = 0ull);
 
     private:
         // PIMPL idiom
@@ -0,0 +1,67 @@
+#ifndef OPENPOSE_3D_POSE_VIEW_REFINER_HPP
+#define OPENPOSE_3D_POSE_VIEW_REFINER_HPP
+
+#include <mutex>
+#include <openpose/core/common.hpp>
+
+namespace op
+{
+    /**
+     * PoseViewRefiner uses the 3-D reconstruction of each frame to guide the 2-D detection of each camera view:
+     * 1) After the 3-D reconstruction, the 3-D keypoints are reprojected into each view (with its camera matrix).
+     * The missing or low-confidence 2-D keypoints of that view are replaced by their reprojection, and the bounding
+     * box of the reprojected person (plus a margin) is kept as the predicted region of that view.
+     * 2) In the following frames, the pose deep net of each view is only run on its predicted region, which
+     * considerably reduces the network input size (and time) when the people only occupy a small part of the
+     * image. Every `fullFrameInterval` frames (and whenever there is no recent prediction), the whole image is
+     * processed, so new people can be detected.
+     * Analogously to PoseTriangulation, it only considers the first person of each view.
+     * It is thread-safe, so the same PoseViewRefiner can be shared by the input and 3-D reconstruction threads.
+     */
+    class OP_API PoseViewRefiner
+    {
+    public:
+        /**
+         * @param fullFrameInterval The whole image of each view is processed once every fullFrameInterval frames.
+         * Predictions older than fullFrameInterval frames are ignored.
+         * @param minConfidence 2-D keypoints with a confidence lower than this threshold are replaced by their
+         * reprojection. The replaced keypoints are assigned half this confidence, so they can be distinguished from
+         * the detected ones.
+         * @param cropMargin Margin added at each side of the predicted region, relative to its maximum side.
+         */
+        explicit PoseViewRefiner(
+            const int fullFrameInterval = 30, const float minConfidence = 0.2f, const float cropMargin = 0.25f);
+
+        virtual ~PoseViewRefiner();
+
+        /**
+         * It sets the region of the image fed to the pose deep net for the desired view and frame, and it adapts
+         * the net input size(s) and scale(s) to that region (keeping the original net resolution as upper bound).
+         * netInputRectangle is left empty (i.e., whole image) if there is no recent prediction for that view.
+         */
+        void setNetInputRectangle(
+            Rectangle<int>& netInputRectangle, std::vector<Point<int>>& netInputSizes,
+            std::vector<double>& scaleInputToNetInputs, const Point<int>& imageSize, const int view,
+            const unsigned long long frameId);
+
+        /**
+         * It replaces the missing or low-confidence keypoints of the first person of poseKeypoints (if any) with
+         * the reprojection of poseKeypoints3D, and it updates the predicted region of that view.
+         */
+        void refine(
+            Array<float>& poseKeypoints, const Array<float>& poseKeypoints3D, const Matrix& cameraMatrix,
+            const Point<int>& imageSize, const int view, const unsigned long long frameId);
+
+    private:
+        const unsigned long long mFullFrameInterval;
+        const float mMinConfidence;
+        const float mCropMargin;
+        std::mutex mMutex;
+        // For each view, frame id of the last prediction and predicted region
+        std::vector<std::pair<unsigned long long, Rectangle<int>>> mPredictedRectangles;
+
+        DELETE_COPY(PoseViewRefiner);
+    };
+}
+
+#endif // OPENPOSE_3D_POSE_VIEW_REFINER_HPP
@@ -0,0 +1,87 @@
+#ifndef OPENPOSE_3D_W_GROUND_PLANE_LIFTING_HPP
+#define OPENPOSE_3D_W_GROUND_PLANE_LIFTING_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/3d/groundPlaneLifting.hpp>
+#include <openpose/thread/worker.hpp>
+
+namespace op
+{
+    template<typename TDatums>
+    class WGroundPlaneLifting : public Worker<TDatums>
+    {
+    public:
+        explicit WGroundPlaneLifting(const std::shared_ptr<GroundPlaneLifting>& groundPlaneLifting);
+
+        virtual ~WGroundPlaneLifting();
+
+        void initializationOnThread();
+
+        void work(TDatums& tDatums);
+
+    private:
+        const std::shared_ptr<GroundPlaneLifting> spGroundPlaneLifting;
+
+        DELETE_COPY(WGroundPlaneLifting);
+    };
+}
+
+
+
+
+
+// Implementation
+#include <openpose/utilities/pointerContainer.hpp>
+namespace op
+{
+    template<typename TDatums>
+    WGroundPlaneLifting<TDatums>::WGroundPlaneLifting(const std::shared_ptr<GroundPlaneLifting>& groundPlaneLifting) :
+        spGroundPlaneLifting{groundPlaneLifting}
+    {
+    }
+
+    template<typename TDatums>
+    WGroundPlaneLifting<TDatums>::~WGroundPlaneLifting()
+    {
+    }
+
+    template<typename TDatums>
+    void WGroundPlaneLifting<TDatums>::initializationOnThread()
+    {
+    }
+
+    template<typename TDatums>
+    void WGroundPlaneLifting<TDatums>::work(TDatums& tDatums)
+    {
+        try
+        {
+            if (checkNoNullNorEmpty(tDatums))
+            {
+                // Debugging log
+                opLogIfDebug("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                // Profiling speed
+                const auto profilerKey = Profiler::timerInit(__LINE__, __FUNCTION__, __FILE__);
+                // Monocular 3-D lifting (floor position of each person)
+                for (auto& tDatumPtr : *tDatums)
+                    spGroundPlaneLifting->lift(
+                        tDatumPtr->poseKeypoints3D, tDatumPtr->poseFloorPositions, tDatumPtr->poseKeypoints,
+                        tDatumPtr->cameraMatrix);
+                // Profiling speed
+                Profiler::timerEnd(profilerKey);
+                Profiler::printAveragedTimeMsOnIterationX(profilerKey, __LINE__, __FUNCTION__, __FILE__);
+                // Debugging log
+                opLogIfDebug("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            this->stop();
+            tDatums = nullptr;
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    COMPILE_TEMPLATE_DATUM(WGroundPlaneLifting);
+}
+
+#endif // OPENPOSE_3D_W_GROUND_PLANE_LIFTING_HPP
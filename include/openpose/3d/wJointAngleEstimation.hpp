@@ -77,8 +77,16 @@ namespace op
                 const auto& handKeypoints3D = tDatumPtr->handKeypoints3D;
                 // Running Adam model
                 spJointAngleEstimation->adamFastFit(
-                    tDatumPtr->adamPose, tDatumPtr->adamTranslation, tDatumPtr->vtVec, tDatumPtr->j0Vec,
-                    tDatumPtr->adamFaceCoeffsExp, poseKeypoints3D, faceKeypoints3D, handKeypoints3D);
+                    tDatumPtr->adamPoses, tDatumPtr->adamTranslations, tDatumPtr->vtVec, tDatumPtr->j0Vec,
+                    tDatumPtr->adamFaceCoeffsExps, poseKeypoints3D, faceKeypoints3D, handKeypoints3D,
+                    tDatumPtr->poseIds, tDatumPtr->frameNumber);
+                // First person (used by the Adam GUI, BVH saver, and UDP sender)
+                if (!tDatumPtr->adamPoses.empty())
+                {
+                    tDatumPtr->adamPose = tDatumPtr->adamPoses[0];
+                    tDatumPtr->adamTranslation = tDatumPtr->adamTranslations[0];
+                    tDatumPtr->adamFaceCoeffsExp = tDatumPtr->adamFaceCoeffsExps[0];
+                }
                 // Profiling speed
                 Profiler::timerEnd(profilerKey);
                 Profiler::printAveragedTimeMsOnIterationX(profilerKey, __LINE__, __FUNCTION__, __FILE__);
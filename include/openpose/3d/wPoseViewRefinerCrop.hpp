@@ -0,0 +1,88 @@
+#ifndef OPENPOSE_3D_W_POSE_VIEW_REFINER_CROP_HPP
+#define OPENPOSE_3D_W_POSE_VIEW_REFINER_CROP_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/3d/poseViewRefiner.hpp>
+#include <openpose/thread/worker.hpp>
+
+namespace op
+{
+    template<typename TDatums>
+    class WPoseViewRefinerCrop : public Worker<TDatums>
+    {
+    public:
+        explicit WPoseViewRefinerCrop(const std::shared_ptr<PoseViewRefiner>& poseViewRefiner);
+
+        virtual ~WPoseViewRefinerCrop();
+
+        void initializationOnThread();
+
+        void work(TDatums& tDatums);
+
+    private:
+        const std::shared_ptr<PoseViewRefiner> spPoseViewRefiner;
+
+        DELETE_COPY(WPoseViewRefinerCrop);
+    };
+}
+
+
+
+
+
+// Implementation
+#include <openpose/utilities/pointerContainer.hpp>
+namespace op
+{
+    template<typename TDatums>
+    WPoseViewRefinerCrop<TDatums>::WPoseViewRefinerCrop(const std::shared_ptr<PoseViewRefiner>& poseViewRefiner) :
+        spPoseViewRefiner{poseViewRefiner}
+    {
+    }
+
+    template<typename TDatums>
+    WPoseViewRefinerCrop<TDatums>::~WPoseViewRefinerCrop()
+    {
+    }
+
+    template<typename TDatums>
+    void WPoseViewRefinerCrop<TDatums>::initializationOnThread()
+    {
+    }
+
+    template<typename TDatums>
+    void WPoseViewRefinerCrop<TDatums>::work(TDatums& tDatums)
+    {
+        try
+        {
+            if (checkNoNullNorEmpty(tDatums))
+            {
+                // Debugging log
+                opLogIfDebug("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                // Profiling speed
+                const auto profilerKey = Profiler::timerInit(__LINE__, __FUNCTION__, __FILE__);
+                // Restrict net input to the predicted region of each view
+                for (auto& tDatumPtr : *tDatums)
+                    spPoseViewRefiner->setNetInputRectangle(
+                        tDatumPtr->netInputRectangle, tDatumPtr->netInputSizes, tDatumPtr->scaleInputToNetInputs,
+                        Point<int>{tDatumPtr->cvInputData.cols(), tDatumPtr->cvInputData.rows()},
+                        (int)tDatumPtr->subId, tDatumPtr->id);
+                // Profiling speed
+                Profiler::timerEnd(profilerKey);
+                Profiler::printAveragedTimeMsOnIterationX(profilerKey, __LINE__, __FUNCTION__, __FILE__);
+                // Debugging log
+                opLogIfDebug("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            this->stop();
+            tDatums = nullptr;
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    COMPILE_TEMPLATE_DATUM(WPoseViewRefinerCrop);
+}
+
+#endif // OPENPOSE_3D_W_POSE_VIEW_REFINER_CROP_HPP
@@ -0,0 +1,88 @@
+#ifndef OPENPOSE_3D_W_POSE_VIEW_REFINER_UPDATE_HPP
+#define OPENPOSE_3D_W_POSE_VIEW_REFINER_UPDATE_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/3d/poseViewRefiner.hpp>
+#include <openpose/thread/worker.hpp>
+
+namespace op
+{
+    template<typename TDatums>
+    class WPoseViewRefinerUpdate : public Worker<TDatums>
+    {
+    public:
+        explicit WPoseViewRefinerUpdate(const std::shared_ptr<PoseViewRefiner>& poseViewRefiner);
+
+        virtual ~WPoseViewRefinerUpdate();
+
+        void initializationOnThread();
+
+        void work(TDatums& tDatums);
+
+    private:
+        const std::shared_ptr<PoseViewRefiner> spPoseViewRefiner;
+
+        DELETE_COPY(WPoseViewRefinerUpdate);
+    };
+}
+
+
+
+
+
+// Implementation
+#include <openpose/utilities/pointerContainer.hpp>
+namespace op
+{
+    template<typename TDatums>
+    WPoseViewRefinerUpdate<TDatums>::WPoseViewRefinerUpdate(const std::shared_ptr<PoseViewRefiner>& poseViewRefiner) :
+        spPoseViewRefiner{poseViewRefiner}
+    {
+    }
+
+    template<typename TDatums>
+    WPoseViewRefinerUpdate<TDatums>::~WPoseViewRefinerUpdate()
+    {
+    }
+
+    template<typename TDatums>
+    void WPoseViewRefinerUpdate<TDatums>::initializationOnThread()
+    {
+    }
+
+    template<typename TDatums>
+    void WPoseViewRefinerUpdate<TDatums>::work(TDatums& tDatums)
+    {
+        try
+        {
+            if (checkNoNullNorEmpty(tDatums))
+            {
+                // Debugging log
+                opLogIfDebug("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                // Profiling speed
+                const auto profilerKey = Profiler::timerInit(__LINE__, __FUNCTION__, __FILE__);
+                // Refine 2-D keypoints and predict region of each view
+                for (auto& tDatumPtr : *tDatums)
+                    spPoseViewRefiner->refine(
+                        tDatumPtr->poseKeypoints, tDatumPtr->poseKeypoints3D, tDatumPtr->cameraMatrix,
+                        Point<int>{tDatumPtr->cvInputData.cols(), tDatumPtr->cvInputData.rows()},
+                        (int)tDatumPtr->subId, tDatumPtr->id);
+                // Profiling speed
+                Profiler::timerEnd(profilerKey);
+                Profiler::printAveragedTimeMsOnIterationX(profilerKey, __LINE__, __FUNCTION__, __FILE__);
+                // Debugging log
+                opLogIfDebug("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            this->stop();
+            tDatums = nullptr;
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    COMPILE_TEMPLATE_DATUM(WPoseViewRefinerUpdate);
+}
+
+#endif // OPENPOSE_3D_W_POSE_VIEW_REFINER_UPDATE_HPP
@@ -23,10 +23,28 @@ namespace op
         const float gridSquareSizeMm, const int index0, const int index1, const bool imagesAreUndistorted,
         const bool combineCam0Extrinsics);
 
+    /**
+     * This function estimates and saves the extrinsic parameters of a single camera with respect to the ground
+     * plane, defined by a grid lying on the floor (the world origin is its first inner corner, with Z = 0 on the
+     * floor). This is the only calibration required by the monocular ground-plane lifting (see
+     * GroundPlaneLifting), whose ground-plane homography is directly obtained from the resulting camera matrix.
+     * @param serialNumber Camera serial number, its intrinsic parameters must have been previously estimated.
+     * @param imagesAreUndistorted Whether the images in imageFolder are already undistorted.
+     */
+    OP_API void estimateAndSaveGroundPlane(
+        const std::string& parameterFolder, const std::string& imageFolder, const Point<int>& gridInnerCorners,
+        const float gridSquareSizeMm, const std::string& serialNumber, const bool imagesAreUndistorted);
+
+    /**
+     * This function refines the extrinsic parameters of all the cameras together by means of bundle adjustment.
+     * @param numberFixedCameras Incremental mode. Cameras 0 to numberFixedCameras-1 keep their current (already
+     * refined) extrinsics, and only the remaining ones (e.g., a newly added camera) are refined. 0 (default) refines
+     * all of them.
+     */
     OP_API void refineAndSaveExtrinsics(
         const std::string& parameterFolder, const std::string& imageFolder, const Point<int>& gridInnerCorners,
         const float gridSquareSizeMm, const int numberCameras, const bool imagesAreUndistorted,
-        const bool saveImagesWithCorners = false);
+        const bool saveImagesWithCorners = false, const int numberFixedCameras = 0);
 
     OP_API void estimateAndSaveSiftFile(
         const Point<int>& gridInnerCorners, const std::string& imageFolder, const int numberCameras,
@@ -1,6 +1,8 @@
 #ifndef OPENPOSE_CORE_ARRAY_HPP
 #define OPENPOSE_CORE_ARRAY_HPP
 
+#include <array>
+#include <atomic>
 #include <memory> // std::shared_ptr
 #include <vector>
 #include <openpose/core/macros.hpp>
@@ -9,6 +11,12 @@
 
 namespace op
 {
+    /**
+     * Maximum number of dimensions of an Array<T>. The shape is stored inline (no heap allocation), so copying an
+     * Array<T> or querying its size is cheap.
+     */
+    const auto ARRAY_MAX_NUMBER_DIMENSIONS = 6;
+
     /**
      * Array<T>: The OpenPose Basic Raw Data Container
      * This template class implements a multidimensional data array. It is our basic data container, analogous to
@@ -206,8 +214,12 @@ namespace op
 
         /**
          * Data allocation function.
-         * It internally allocates memory and copies the data of the argument to the Array allocated memory.
-         * @param cvMat Matrix to be copied.
+         * It sets the Array data from the argument. 3-channel matrices add their channels as last dimension (e.g., a
+         * CV_32FC3 image results in a {rows, cols, 3} Array<float>). Other multi-channel matrices are not supported.
+         * If cvMat is continuous and owns its data (and T matches its type), no data is copied: analogously to the
+         * Array<T> copy constructor, both will share the same memory (and it will stay allocated while any of them
+         * uses it), so modifying one of them will modify the other one. Otherwise, the data is copied.
+         * @param cvMat Matrix to be shared or copied.
          */
         void setFrom(const Matrix& cvMat);
 
@@ -237,16 +249,19 @@ namespace op
          */
         inline std::vector<int> getSize() const
         {
-            return mSize;
+            return std::vector<int>(mSize.begin(), mSize.begin() + mNumberDimensions);
         }
 
         /**
          * Return a vector with the size of the desired dimension.
          * @param index Dimension to check its size.
-         * @return Size of the desired dimension. It will return 0 if the requested dimension is higher than the number
-         * of dimensions.
+         * @return Size of the desired dimension. It will return 0 if the array is empty, or 1 if the requested
+         * dimension is higher than the number of dimensions (Matlab style).
          */
-        int getSize(const int index) const;
+        inline int getSize(const int index) const
+        {
+            return ((unsigned int)index < (unsigned int)mNumberDimensions ? mSize[index] : (mNumberDimensions > 0));
+        }
 
         /**
          * Return a string with the size of each dimension allocated.
@@ -261,7 +276,7 @@ namespace op
          */
         inline size_t getNumberDimensions() const
         {
-            return mSize.size();
+            return (size_t)mNumberDimensions;
         }
 
         /**
@@ -283,7 +298,23 @@ namespace op
          * @return The total volume of the allocated data between the desired dimensions. If the index are out of
          * bounds, it throws an error.
          */
-        size_t getVolume(const int indexA, const int indexB = -1) const;
+        inline size_t getVolume(const int indexA, const int indexB = -1) const
+        {
+            const auto indexBFinal = (indexB != -1 ? indexB : mNumberDimensions-1);
+            if (0 <= indexA && indexA <= indexBFinal && indexBFinal < mNumberDimensions)
+            {
+                size_t volume = 1;
+                for (auto i = indexA ; i <= indexBFinal ; i++)
+                    volume *= mSize[i];
+                return volume;
+            }
+            else
+            {
+                error((indexA > indexBFinal ? "indexA > indexB." : "Indexes out of dimension."),
+                      __LINE__, __FUNCTION__, __FILE__);
+                return 0;
+            }
+        }
 
         /**
          * Return the stride or step size of the array.
@@ -294,9 +325,21 @@ namespace op
 
         /**
          * Return the stride or step size of the array at the index-th dimension.
-         * E.g., given and Array<T> of size 5x3, getStride(2) would return sizeof(T).
+         * E.g., given and Array<T> of size 5x3, getStride(1) would return sizeof(T).
          */
-        int getStride(const int index) const;
+        inline int getStride(const int index) const
+        {
+            return mStep[index] * (int)sizeof(T);
+        }
+
+        /**
+         * Similar to getStride(const int index), but in number of elements rather than bytes.
+         * E.g., given and Array<T> of size 5x3, getStep(0) would return 3.
+         */
+        inline int getStep(const int index) const
+        {
+            return mStep[index];
+        }
 
 
 
@@ -341,6 +384,10 @@ namespace op
          *     editedCvMat = array.getConstCvMat().clone();
          *     // modify data
          *     array.setFrom(editedCvMat)
+         * The Matrix is only a header pointing to the Array data (no data is duplicated). It is lazily created the
+         * first time this function (or getCvMat) is called after each reset, so Arrays never used as Matrix do not
+         * pay for it. Calling it concurrently from several threads is safe (as long as none of them modifies the
+         * Array).
          * @return A const Matrix pointing to the data.
          */
         const Matrix& getConstCvMat() const;
@@ -475,11 +522,16 @@ namespace op
         const std::string toString() const;
 
     private:
-        std::vector<int> mSize;
+        std::array<int, ARRAY_MAX_NUMBER_DIMENSIONS> mSize;
+        std::array<int, ARRAY_MAX_NUMBER_DIMENSIONS> mStep; // Stride in number of elements
+        int mNumberDimensions;
         size_t mVolume;
         std::shared_ptr<T> spData;
         T* pData; // pData is a wrapper of spData. Used for Pybind11 binding.
-        std::pair<bool, Matrix> mCvMatData;
+        // Lazily created Matrix header pointing to pData, and whether it is up to date (atomic, so concurrent calls
+        // to the const getters do not race)
+        mutable Matrix mCvMatData;
+        mutable std::atomic<bool> mCvMatDataUpToDate{false};
 
         /**
          * Auxiliar function that both operator[](const std::vector<int>& indexes) and
@@ -507,6 +559,12 @@ namespace op
         T& commonAt(const int index) const;
 
         void resetAuxiliary(const std::vector<int>& sizes, T* const dataPtr = nullptr);
+
+        /**
+         * Auxiliar function that both getConstCvMat() and getCvMat() use. It creates the Matrix header (if it was
+         * not created yet).
+         */
+        void updateCvMatData() const;
     };
 
     // Static methods
@@ -0,0 +1,129 @@
+#ifndef OPENPOSE_CORE_ARRAY_VIEW_HPP
+#define OPENPOSE_CORE_ARRAY_VIEW_HPP
+
+#include <type_traits> // std::is_const, std::remove_const
+#include <openpose/core/array.hpp>
+
+namespace op
+{
+    /**
+     * ArrayView<T, N>: Lightweight, non-owning view of an N-dimensional Array<T>.
+     * Its rank is known at compile time and its sizes and steps are copied at construction, so indexing it inside
+     * tight loops (e.g., `view(person, bodyPart, 2)`) is just a few multiply-adds with no function calls nor
+     * dimension checks in release mode.
+     * Analogously to Array(const Array<T>& array, const int index, const bool noCopy = true), the view does not keep
+     * the data alive, so the Array must remain in scope (and must not be reset) while the view is used.
+     * Use ArrayView<const T, N> for read-only access to a const Array<T>.
+     */
+    template<typename T, int N>
+    class ArrayView
+    {
+    public:
+        typedef typename std::remove_const<T>::type TBase;
+
+        /**
+         * ArrayView constructor.
+         * @param array Array<T> to be viewed. It must have exactly N dimensions.
+         */
+        explicit ArrayView(Array<TBase>& array)
+        {
+            try
+            {
+                setFrom(array, array.getPtr());
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+
+        /**
+         * ArrayView constructor for read-only views, i.e., it can only be used with ArrayView<const T, N>.
+         * @param array Array<T> to be viewed. It must have exactly N dimensions.
+         */
+        explicit ArrayView(const Array<TBase>& array)
+        {
+            static_assert(std::is_const<T>::value, "A const Array<T> can only be viewed with ArrayView<const T, N>.");
+            try
+            {
+                setFrom(array, array.getConstPtr());
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+
+        inline T* getPtr() const
+        {
+            return pData;
+        }
+
+        inline int getSize(const int index) const
+        {
+            return mSize[index];
+        }
+
+        /**
+         * Stride of the index-th dimension, in number of elements (rather than bytes).
+         */
+        inline int getStep(const int index) const
+        {
+            return mStep[index];
+        }
+
+        /**
+         * It turns the N indexes into the equivalent 1-D index. E.g., for a {2, 25, 3} view,
+         * getIndex(1, 4, 2) = 1*75 + 4*3 + 2 = 89.
+         */
+        template<typename... Indexes>
+        inline int getIndex(const Indexes... indexes) const
+        {
+            static_assert(sizeof...(Indexes) == N, "The number of indexes must match the ArrayView rank.");
+            const int indexArray[N]{int(indexes)...};
+            auto index = 0;
+            for (auto i = 0 ; i < N ; i++)
+            {
+                #ifndef NDEBUG
+                    if ((unsigned int)indexArray[i] >= (unsigned int)mSize[i])
+                        error("Index out of bounds.", __LINE__, __FUNCTION__, __FILE__);
+                #endif
+                index += indexArray[i] * mStep[i];
+            }
+            return index;
+        }
+
+        /**
+         * () operator
+         * E.g., given a {#people, #body parts, 3} view, view(person, bodyPart, 2) is the score of that keypoint.
+         * If debug mode is enabled, then it will check that each index is within its dimension size.
+         */
+        template<typename... Indexes>
+        inline T& operator()(const Indexes... indexes) const
+        {
+            return pData[getIndex(indexes...)];
+        }
+
+    private:
+        T* pData;
+        int mSize[N];
+        int mStep[N];
+
+        template<typename TArray>
+        void setFrom(const TArray& array, T* const dataPtr)
+        {
+            // Sanity check
+            if (array.getNumberDimensions() != (size_t)N)
+                error("Array dimensions (" + array.printSize() + ") do not match the ArrayView rank ("
+                      + std::to_string(N) + ").", __LINE__, __FUNCTION__, __FILE__);
+            pData = dataPtr;
+            for (auto i = 0 ; i < N ; i++)
+            {
+                mSize[i] = array.getSize(i);
+                mStep[i] = array.getStep(i);
+            }
+        }
+    };
+}
+
+#endif // OPENPOSE_CORE_ARRAY_VIEW_HPP
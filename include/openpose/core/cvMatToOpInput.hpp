@@ -13,9 +13,24 @@ namespace op
 
         virtual ~CvMatToOpInput();
 
+        /**
+         * It creates the net input(s) from the input image.
+         * @param netInputRectangle If not empty, only this region of inputData is fed to the net (and
+         * scaleInputToNetInputs and netInputSizes are referred to it rather than to the whole image).
+         */
         std::vector<Array<float>> createArray(
             const Matrix& inputData, const std::vector<double>& scaleInputToNetInputs,
-            const std::vector<Point<int>>& netInputSizes);
+            const std::vector<Point<int>>& netInputSizes,
+            const Rectangle<int>& netInputRectangle = Rectangle<int>{});
+
+        /**
+         * Equivalent to createArray(), but it fills inputNetData in place, re-using its buffers if they have the
+         * right size and are not shared (e.g., recycled Datums).
+         */
+        void createArray(
+            std::vector<Array<float>>& inputNetData, const Matrix& inputData,
+            const std::vector<double>& scaleInputToNetInputs, const std::vector<Point<int>>& netInputSizes,
+            const Rectangle<int>& netInputRectangle = Rectangle<int>{});
 
     private:
         const PoseModel mPoseModel;
@@ -18,6 +18,14 @@ namespace op
         Array<float> createArray(
             const Matrix& inputData, const double scaleInputToOutput, const Point<int>& outputResolution);
 
+        /**
+         * Equivalent to createArray(), but it fills outputData in place, re-using its buffer if it has the right
+         * size and it is not shared (e.g., recycled Datums).
+         */
+        void createArray(
+            Array<float>& outputData, const Matrix& inputData, const double scaleInputToOutput,
+            const Point<int>& outputResolution);
+
     private:
         const bool mGpuResize;
         unsigned char* pInputImageCuda;
@@ -193,6 +193,13 @@ namespace op
          */
         std::array<Array<float>, 2> handKeypoints3D;
 
+        /**
+         * Floor (x,y,score) position of each person in the image, obtained from a single camera (monocular 3-D
+         * lifting, see GroundPlaneLifting). It is empty unless `--3d_ground_plane` is enabled.
+         * Size: #people x 3 ((x,y) coordinates on the floor + score)
+         */
+        Array<float> poseFloorPositions;
+
         /**
          * 3x4 camera matrix of the camera (equivalent to cameraIntrinsics * cameraExtrinsics).
          */
@@ -228,6 +235,13 @@ namespace op
          */
         std::vector<Point<int>> netInputSizes;
 
+        /**
+         * Region of Datum::cvInputData fed to the pose deep net (e.g., set by the PoseViewRefiner of the 3-D
+         * module). If empty (default), the whole image is used. The resulting keypoints are still referred to the
+         * whole image, but the heat maps and the net output only cover this region.
+         */
+        Rectangle<int> netInputRectangle;
+
         /**
          * Scale ratio between the input Datum::cvInputData and the output Datum::cvOutputData.
          */
@@ -269,6 +283,11 @@ namespace op
                 Eigen::Matrix<double, Eigen::Dynamic, 1> vtVec;
                 Eigen::Matrix<double, Eigen::Dynamic, 1> j0Vec;
                 Eigen::VectorXd adamFaceCoeffsExp;
+                // Adam/Unity params of each person of poseKeypoints3D (the ones above are the first person ones)
+                std::vector<Eigen::Matrix<double, 62, 3, Eigen::RowMajor>,
+                            Eigen::aligned_allocator<Eigen::Matrix<double, 62, 3, Eigen::RowMajor>>> adamPoses;
+                std::vector<Eigen::Vector3d> adamTranslations;
+                std::vector<Eigen::VectorXd> adamFaceCoeffsExps;
             #endif
         #endif
 
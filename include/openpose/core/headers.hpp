@@ -4,6 +4,7 @@
 // core module
 #include <openpose/core/array.hpp>
 #include <openpose/core/arrayCpuGpu.hpp>
+#include <openpose/core/arrayView.hpp>
 #include <openpose/core/common.hpp>
 #include <openpose/core/cvMatToOpInput.hpp>
 #include <openpose/core/cvMatToOpOutput.hpp>
@@ -15,6 +16,7 @@
 #include <openpose/core/macros.hpp>
 #include <openpose/core/matrix.hpp>
 #include <openpose/core/opOutputToCvMat.hpp>
+#include <openpose/core/planarKeypoints.hpp>
 #include <openpose/core/point.hpp>
 #include <openpose/core/rectangle.hpp>
 #include <openpose/core/renderer.hpp>
@@ -1,6 +1,7 @@
 #ifndef OPENPOSE_CORE_KEEP_TOP_N_PEOPLE_HPP
 #define OPENPOSE_CORE_KEEP_TOP_N_PEOPLE_HPP
 
+#include <atomic>
 #include <openpose/core/common.hpp>
 
 namespace op
@@ -14,8 +15,17 @@ namespace op
 
         Array<float> keepTopPeople(const Array<float>& peopleArrays, const Array<float>& poseScores) const;
 
+        int getNumberPeopleMax() const;
+
+        /**
+         * Thread-safe, it can be modified while running. A value <= 0 keeps all people.
+         */
+        void setNumberPeopleMax(const int numberPeopleMax);
+
     private:
-        const int mNumberPeopleMax;
+        std::atomic<int> mNumberPeopleMax;
+
+        DELETE_COPY(KeepTopNPeople);
     };
 }
 
@@ -0,0 +1,115 @@
+#ifndef OPENPOSE_CORE_PLANAR_KEYPOINTS_HPP
+#define OPENPOSE_CORE_PLANAR_KEYPOINTS_HPP
+
+#include <openpose/core/array.hpp>
+#include <openpose/core/macros.hpp>
+
+namespace op
+{
+    /**
+     * Number of elements each keypoint plane is padded to, i.e., 8 floats = 256 bits (AVX register width).
+     */
+    const auto PLANAR_KEYPOINTS_PADDING = 8;
+
+    /**
+     * PlanarKeypoints<T>: Structure-of-arrays (SoA) layout of a keypoint Array<T>.
+     * OpenPose keypoints are interleaved, i.e., {#people, #parts, 3} with (x,y,score) (or 4 with (x,y,z,score)), so
+     * any function reading only one of the channels (e.g., the scores) strides over the other ones. PlanarKeypoints
+     * keeps each channel of each person in its own contiguous plane, i.e., {#people, #channels, paddedNumberParts},
+     * where paddedNumberParts is #parts rounded up to PLANAR_KEYPOINTS_PADDING (the padding is filled with 0s, i.e.,
+     * score 0). This way, loops over the parts of a plane are auto-vectorized by the compiler. It is optional and
+     * meant for the keypoint utilities (see the PlanarKeypoints overloads in utilities/keypoint.hpp): the
+     * interleaved format is still the one used in Datum, so it is converted at the API boundary with setFrom() and
+     * copyTo() (each one a single pass over the data).
+     * The planes can also be indexed with ArrayView<T, 3>(getArray()).
+     */
+    template<typename T>
+    class PlanarKeypoints
+    {
+    public:
+        /**
+         * Constructor.
+         * Equivalent to the default constructor + setFrom(keypoints).
+         */
+        explicit PlanarKeypoints(const Array<T>& keypoints = Array<T>{});
+
+        /**
+         * It sets the planes from an interleaved keypoint Array<T> ({#people, #parts, 3 or 4}). The memory is
+         * re-used if the number of people and parts does not change.
+         */
+        void setFrom(const Array<T>& keypoints);
+
+        /**
+         * It fills keypoints with the equivalent interleaved keypoint Array<T> ({#people, #parts, #channels}).
+         */
+        void copyTo(Array<T>& keypoints) const;
+
+        /**
+         * Similar to copyTo(), but it returns a new Array<T>.
+         */
+        Array<T> toArray() const;
+
+        inline bool empty() const
+        {
+            return mPlanes.empty();
+        }
+
+        inline int getNumberPeople() const
+        {
+            return (mPlanes.empty() ? 0 : mPlanes.getSize(0));
+        }
+
+        inline int getNumberParts() const
+        {
+            return mNumberParts;
+        }
+
+        /**
+         * @return 3 for (x,y,score) or 4 for (x,y,z,score) keypoints.
+         */
+        inline int getNumberChannels() const
+        {
+            return (mPlanes.empty() ? 0 : mPlanes.getSize(1));
+        }
+
+        /**
+         * @return Number of elements between 2 consecutive planes, i.e., the number of parts plus padding.
+         */
+        inline int getPlaneStep() const
+        {
+            return (mPlanes.empty() ? 0 : mPlanes.getSize(2));
+        }
+
+        inline T* getPlane(const int person, const int channel)
+        {
+            return mPlanes.getPtr() + (person*getNumberChannels() + channel)*getPlaneStep();
+        }
+
+        inline const T* getPlane(const int person, const int channel) const
+        {
+            return mPlanes.getConstPtr() + (person*getNumberChannels() + channel)*getPlaneStep();
+        }
+
+        /**
+         * Equivalent to getPlane(person, getNumberChannels()-1), i.e., the score is always the last channel.
+         */
+        inline const T* getScorePlane(const int person) const
+        {
+            return getPlane(person, getNumberChannels()-1);
+        }
+
+        /**
+         * @return The internal {#people, #channels, paddedNumberParts} Array<T>.
+         */
+        inline const Array<T>& getArray() const
+        {
+            return mPlanes;
+        }
+
+    private:
+        Array<T> mPlanes;
+        int mNumberParts;
+    };
+}
+
+#endif // OPENPOSE_CORE_PLANAR_KEYPOINTS_HPP
@@ -1,6 +1,7 @@
 #ifndef OPENPOSE_CORE_SCALE_AND_SIZE_EXTRACTOR_HPP
 #define OPENPOSE_CORE_SCALE_AND_SIZE_EXTRACTOR_HPP
 
+#include <mutex>
 #include <tuple>
 #include <openpose/core/common.hpp>
 
@@ -17,12 +18,22 @@ namespace op
         std::tuple<std::vector<double>, std::vector<Point<int>>, double, Point<int>> extract(
             const Point<int>& inputResolution) const;
 
+        /**
+         * Thread-safe runtime modification of the net input resolution and scales. Each extract() call uses either
+         * the previous or the new values, but never a mix of them.
+         */
+        void setNetInputResolution(const Point<int>& netInputResolution, const int scaleNumber = 1,
+                                   const double scaleGap = 0.25);
+
     private:
-        const Point<int> mNetInputResolution;
+        Point<int> mNetInputResolution;
         const float mNetInputResolutionDynamicBehavior;
         const Point<int> mOutputSize;
-        const int mScaleNumber;
-        const double mScaleGap;
+        int mScaleNumber;
+        double mScaleGap;
+        mutable std::mutex mMutex;
+
+        DELETE_COPY(ScaleAndSizeExtractor);
     };
 }
 
@@ -66,8 +66,9 @@ namespace op
                 const auto profilerKey = Profiler::timerInit(__LINE__, __FUNCTION__, __FILE__);
                 // cv::Mat -> float*
                 for (auto& tDatumPtr : tDatumsNoPtr)
-                    tDatumPtr->outputData = spCvMatToOpOutput->createArray(
-                        tDatumPtr->cvInputData, tDatumPtr->scaleInputToOutput, tDatumPtr->netOutputSize);
+                    spCvMatToOpOutput->createArray(
+                        tDatumPtr->outputData, tDatumPtr->cvInputData, tDatumPtr->scaleInputToOutput,
+                        tDatumPtr->netOutputSize);
                 // Profiling speed
                 Profiler::timerEnd(profilerKey);
                 Profiler::printAveragedTimeMsOnIterationX(profilerKey, __LINE__, __FUNCTION__, __FILE__);
@@ -22,7 +22,7 @@ namespace op
                            const std::string& modelFolder, const int gpuId,
                            const std::vector<HeatMapType>& heatMapTypes = {},
                            const ScaleMode heatMapScaleMode = ScaleMode::ZeroToOneFixedAspect,
-                           const bool enableGoogleLogging = true);
+                           const bool enableGoogleLogging = true, const bool fastStartup = false);
 
         virtual ~FaceExtractorCaffe();
 
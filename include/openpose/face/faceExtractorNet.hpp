@@ -30,7 +30,8 @@ namespace op
 
         /**
          * This function must be call before using any other function. It must also be called inside the thread in
-         * which the functions are going to be used.
+         * which the functions are going to be used. Calling it again from the same thread does nothing (i.e., the
+         * net is not re-loaded).
          */
         void initializationOnThread();
 
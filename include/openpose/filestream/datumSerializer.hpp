@@ -0,0 +1,96 @@
+#ifndef OPENPOSE_FILESTREAM_DATUM_SERIALIZER_HPP
+#define OPENPOSE_FILESTREAM_DATUM_SERIALIZER_HPP
+
+#include <istream>
+#include <ostream>
+#include <openpose/core/common.hpp>
+#include <openpose/core/datum.hpp>
+
+namespace op
+{
+    /**
+     * Size (in bytes) of the header of each serialized Datum.
+     */
+    const auto DATUM_SERIALIZER_HEADER_SIZE = 16;
+
+    /**
+     * Versioned binary (de)serialization of Datum, meant to split an OpenPose pipeline across processes (e.g.,
+     * capture -> inference -> analytics) through pipes, sockets, shared memory or files, without the loss and
+     * overhead of JSON.
+     * Each serialized Datum (record) consists of:
+     *     - Header (DATUM_SERIALIZER_HEADER_SIZE bytes): magic "OPDT", version (uint16, currently 1), mask of the
+     *       serialized fields (uint16, DatumSerializer::Field), and payload size in bytes (uint64).
+     *     - Payload: the blocks of each enabled field, in the order of DatumSerializer::Field:
+     *         - Ids: id, subId, subIdMax and frameNumber (uint64 each), name, and poseIds.
+     *         - Keypoints: poseKeypoints, faceKeypoints, handKeypoints (left and right), poseKeypoints3D,
+     *           faceKeypoints3D, and handKeypoints3D (left and right).
+     *         - Scores: poseScores.
+     *         - Rectangles: faceRectangles and handRectangles (float x, y, width, height each).
+     *         - Images: cvInputData and cvOutputData.
+     *         - HeatMaps: poseHeatMaps, faceHeatMaps, and handHeatMaps (left and right).
+     * Array<T> blocks store #dimensions (uint32), the sizes (int32 each), and the raw data. Matrix blocks store
+     * rows, cols and type (int32 each, type as in cv::Mat), 4 reserved bytes, and the raw (continuous) data.
+     * Strings and vectors store their length (uint64) followed by their elements. Every block is padded to a
+     * multiple of 8 bytes (relative to the beginning of the record), so the data can be read in place.
+     * All values use the native byte order (little-endian on x86 and ARM). Fields not serialized keep their Datum
+     * default values when deserialized.
+     */
+    class OP_API DatumSerializer
+    {
+    public:
+        enum Field : unsigned short
+        {
+            Ids = 1,
+            Keypoints = 2,
+            Scores = 4,
+            Rectangles = 8,
+            Images = 16,
+            HeatMaps = 32,
+            All = 63,
+        };
+
+        /**
+         * @param fields Mask of the Datum fields to serialize (combination of DatumSerializer::Field). By default,
+         * everything but the images and heat maps, i.e., the lightweight output of OpenPose.
+         */
+        explicit DatumSerializer(const unsigned short fields = Ids | Keypoints | Scores | Rectangles);
+
+        virtual ~DatumSerializer();
+
+        /**
+         * It appends the serialized version of datum at the end of buffer.
+         */
+        void serialize(std::vector<unsigned char>& buffer, const Datum& datum) const;
+
+        /**
+         * Streaming version of serialize(). The record is written with a single std::ostream::write call (e.g., to
+         * keep records atomic on pipes).
+         */
+        void write(std::ostream& ostream, const Datum& datum);
+
+    private:
+        const unsigned short mFields;
+        std::vector<unsigned char> mBuffer;
+
+        DELETE_COPY(DatumSerializer);
+    };
+
+    /**
+     * It deserializes the Datum record starting at dataPtr, and it moves dataPtr to the end of it (i.e., to the
+     * next record, if any).
+     * @param dataEnd End of the buffer, used to check that the data is not truncated.
+     * @param zeroCopy If true, the keypoints, heat maps and images of the resulting Datum point to the memory of
+     * the buffer rather than copying it (only if it is properly aligned, it is copied otherwise). Thus, the buffer
+     * must outlive the Datum (and it must not be modified meanwhile). If false, all the data is copied.
+     */
+    OP_API std::shared_ptr<Datum> deserializeDatum(
+        const unsigned char*& dataPtr, const unsigned char* const dataEnd, const bool zeroCopy = false);
+
+    /**
+     * Streaming version of deserializeDatum(). It reads the next record of istream (with its data copied).
+     * @return The deserialized Datum, or nullptr if the end of the stream was reached before a new record.
+     */
+    OP_API std::shared_ptr<Datum> readDatum(std::istream& istream);
+}
+
+#endif // OPENPOSE_FILESTREAM_DATUM_SERIALIZER_HPP
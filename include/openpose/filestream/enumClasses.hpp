@@ -9,6 +9,7 @@ namespace op
         Xml,
         Yaml,
         Yml,
+        Bin, /**< Packed int16 fixed-point keypoints (see keypointPacking.hpp). Only for keypoints. */
     };
 
     enum class CocoJsonFormat : unsigned char
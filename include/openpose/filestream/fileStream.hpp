@@ -23,6 +23,13 @@ namespace op
     // arrayData = x[1+int(round(x[0])):]
     OP_API void saveFloatArray(const Array<float>& array, const std::string& fullFilePath);
 
+    // Save/load packed int16 fixed-point keypoints (DataFormat::Bin), i.e., the concatenation of each packed
+    // keypoint Array (see keypointPacking.hpp for the binary layout)
+    OP_API void savePackedKeypoints(
+        const std::vector<Array<float>>& keypointVector, const std::string& fullFilePath, const float resolution);
+
+    OP_API std::vector<Array<float>> loadPackedKeypoints(const std::string& fullFilePath);
+
     // Save/load json, xml, yaml, yml
     OP_API void saveData(
         const std::vector<Matrix>& opMats, const std::vector<std::string>& cvMatNames,
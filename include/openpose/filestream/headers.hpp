@@ -4,12 +4,14 @@
 // fileStream module
 #include <openpose/filestream/bvhSaver.hpp>
 #include <openpose/filestream/cocoJsonSaver.hpp>
+#include <openpose/filestream/datumSerializer.hpp>
 #include <openpose/filestream/enumClasses.hpp>
 #include <openpose/filestream/fileSaver.hpp>
 #include <openpose/filestream/fileStream.hpp>
 #include <openpose/filestream/heatMapSaver.hpp>
 #include <openpose/filestream/imageSaver.hpp>
 #include <openpose/filestream/jsonOfstream.hpp>
+#include <openpose/filestream/keypointPacking.hpp>
 #include <openpose/filestream/keypointSaver.hpp>
 #include <openpose/filestream/peopleJsonSaver.hpp>
 #include <openpose/filestream/udpSender.hpp>
@@ -0,0 +1,58 @@
+#ifndef OPENPOSE_FILESTREAM_KEYPOINT_PACKING_HPP
+#define OPENPOSE_FILESTREAM_KEYPOINT_PACKING_HPP
+
+#include <openpose/core/common.hpp>
+
+namespace op
+{
+    /**
+     * Size (in bytes) of the header of each packed keypoint Array<float>.
+     */
+    const auto PACKED_KEYPOINTS_HEADER_SIZE = 12;
+
+    /**
+     * Default resolution of the packed coordinates, i.e., 4 steps per pixel = 0.25 pixels (coordinates in the range
+     * [-8191.75, 8191.75]).
+     */
+    const auto PACKED_KEYPOINTS_DEFAULT_RESOLUTION = 4.f;
+
+    /**
+     * Compact fixed-point encoding of keypoint Arrays (e.g., poseKeypoints, faceKeypoints, etc.), meant for
+     * bandwidth-limited consumers (UDP) and long-term storage. Only the output encoding is affected, OpenPose
+     * internally keeps working with float keypoints.
+     * Each packed keypoint Array ({#people, #parts, 3} or {#people, #parts, 4}) consists of:
+     *     - Header (PACKED_KEYPOINTS_HEADER_SIZE bytes): #people (uint16), #parts (uint16), #channels (uint8, 0 if
+     *       the Array is empty, 3 for (x,y,score) and 4 for (x,y,z,score)), version (uint8, currently 1), 2 reserved
+     *       bytes, and the coordinate resolution (float32).
+     *     - 1 plane of #people x #parts int16 per coordinate channel (x, y, and z if 3-D), where each value is
+     *       round(coordinate * resolution), clamped to [-32767, 32767].
+     *     - 1 plane of #people x #parts uint8 with the scores, i.e., round(score * 255) clamped to [0, 255].
+     * All values use the native byte order (little-endian on x86 and ARM). I.e., 5 bytes per 2-D keypoint (rather
+     * than 12 bytes for 3 floats), or 7 bytes per 3-D keypoint (rather than 16).
+     * Example to read it in Python (single 2-D Array, e.g., a file saved with `--write_keypoint_format bin` without
+     * face nor hands):
+     *     data = np.fromfile(filePath, dtype=np.uint8)
+     *     people, parts = data[0:4].view(np.uint16); resolution = data[8:12].view(np.float32)[0]
+     *     xy = data[12:12+4*people*parts].view(np.int16).reshape(2, people, parts) / resolution
+     *     scores = data[12+4*people*parts:12+5*people*parts].reshape(people, parts) / 255.
+     */
+    OP_API std::size_t getPackedKeypointsSize(const Array<float>& keypoints);
+
+    /**
+     * It appends the packed version of keypoints at the end of buffer.
+     * @param resolution Number of int16 steps per unit (e.g., per pixel). The higher, the more accurate the
+     * coordinates, but the smaller the range of coordinates that can be represented (+-32767/resolution).
+     */
+    OP_API void packKeypoints(
+        std::vector<unsigned char>& buffer, const Array<float>& keypoints,
+        const float resolution = PACKED_KEYPOINTS_DEFAULT_RESOLUTION);
+
+    /**
+     * It decodes the packed keypoint Array starting at dataPtr, and it moves dataPtr to the end of it (i.e., to the
+     * next packed Array, if any).
+     * @param dataEnd End of the buffer, used to check that the data is not truncated.
+     */
+    OP_API Array<float> unpackKeypoints(const unsigned char*& dataPtr, const unsigned char* const dataEnd);
+}
+
+#endif // OPENPOSE_FILESTREAM_KEYPOINT_PACKING_HPP
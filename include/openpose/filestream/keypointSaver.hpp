@@ -4,13 +4,21 @@
 #include <openpose/core/common.hpp>
 #include <openpose/filestream/enumClasses.hpp>
 #include <openpose/filestream/fileSaver.hpp>
+#include <openpose/filestream/keypointPacking.hpp>
 
 namespace op
 {
     class OP_API KeypointSaver : public FileSaver
     {
     public:
-        KeypointSaver(const std::string& directoryPath, const DataFormat format);
+        /**
+         * Constructor of KeypointSaver.
+         * @param packedResolution Only used for DataFormat::Bin: resolution (steps per pixel) of the int16
+         * fixed-point coordinates (see packKeypoints).
+         */
+        KeypointSaver(
+            const std::string& directoryPath, const DataFormat format,
+            const float packedResolution = PACKED_KEYPOINTS_DEFAULT_RESOLUTION);
 
         virtual ~KeypointSaver();
 
@@ -19,6 +27,7 @@ namespace op
 
     private:
         const DataFormat mFormat;
+        const float mPackedResolution;
     };
 }
 
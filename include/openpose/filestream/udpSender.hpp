@@ -16,6 +16,15 @@ namespace op
                              const double* const adamTranslationPtr,
                              const double* const adamFaceCoeffsExpPtr, const int faceCoeffRows);
 
+        /**
+         * It sends the keypoints of a frame as a single datagram: the "Keypoints:" prefix, the frame number
+         * (uint64), the number of keypoint Arrays (uint8), and each Array packed as int16 fixed-point coordinates
+         * and uint8 scores (see keypointPacking.hpp).
+         * Datagrams bigger than the UDP limit (65507 bytes) are not sent.
+         */
+        void sendKeypoints(const std::vector<Array<float>>& keypointVector, const unsigned long long frameNumber,
+                           const float resolution);
+
     private:
         // PIMPL idiom
         // http://www.cppsamples.com/common-tasks/pimpl.html
@@ -75,7 +75,7 @@ namespace op
                     // Pose IDs from long long to float
                     Array<float> poseIds{tDatumPtr->poseIds};
 
-                    const std::vector<std::pair<Array<float>, std::string>> keypointVector{
+                    std::vector<std::pair<Array<float>, std::string>> keypointVector{
                         // Pose IDs
                         std::make_pair(poseIds, "person_id"),
                         // 2D
@@ -89,6 +89,9 @@ namespace op
                         std::make_pair(tDatumPtr->handKeypoints3D[0], "hand_left_keypoints_3d"),
                         std::make_pair(tDatumPtr->handKeypoints3D[1], "hand_right_keypoints_3d")
                     };
+                    // Monocular 3D (only if enabled)
+                    if (!tDatumPtr->poseFloorPositions.empty())
+                        keypointVector.emplace_back(tDatumPtr->poseFloorPositions, "pose_floor_position");
                     // Save keypoints
                     spPeopleJsonSaver->save(
                         keypointVector, tDatumPtr->poseCandidates, fileName, humanReadable);
@@ -11,7 +11,12 @@ namespace op
     class WUdpSender : public WorkerConsumer<TDatums>
     {
     public:
-        explicit WUdpSender(const std::shared_ptr<UdpSender>& udpSender);
+        /**
+         * Constructor of WUdpSender.
+         * @param keypointResolution If positive, the keypoints of each frame are also sent (packed as int16
+         * fixed-point with this resolution, see UdpSender::sendKeypoints). If 0 (default), they are not sent.
+         */
+        explicit WUdpSender(const std::shared_ptr<UdpSender>& udpSender, const float keypointResolution = 0.f);
 
         virtual ~WUdpSender();
 
@@ -21,6 +26,7 @@ namespace op
 
     private:
         const std::shared_ptr<UdpSender> spUdpSender;
+        const float mKeypointResolution;
 
         DELETE_COPY(WUdpSender);
     };
@@ -35,8 +41,9 @@ namespace op
 namespace op
 {
     template<typename TDatums>
-    WUdpSender<TDatums>::WUdpSender(const std::shared_ptr<UdpSender>& udpSender) :
-        spUdpSender{udpSender}
+    WUdpSender<TDatums>::WUdpSender(const std::shared_ptr<UdpSender>& udpSender, const float keypointResolution) :
+        spUdpSender{udpSender},
+        mKeypointResolution{keypointResolution}
     {
     }
 
@@ -62,6 +69,12 @@ namespace op
                 // Profiling speed
                 const auto profilerKey = Profiler::timerInit(__LINE__, __FUNCTION__, __FILE__);
                 // Send though UDP communication
+                // Packed keypoints (1 datagram per view)
+                if (mKeypointResolution > 0.f)
+                    for (const auto& tDatumPtr : *tDatums)
+                        spUdpSender->sendKeypoints(
+                            {tDatumPtr->poseKeypoints, tDatumPtr->faceKeypoints, tDatumPtr->handKeypoints[0],
+                             tDatumPtr->handKeypoints[1]}, tDatumPtr->frameNumber, mKeypointResolution);
 #ifdef USE_3D_ADAM_MODEL
                 const auto& tDatumPtr = (*tDatums)[0];
                 if (!tDatumPtr->poseKeypoints3D.empty())
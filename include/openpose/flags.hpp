@@ -23,6 +23,13 @@ DEFINE_bool(disable_multi_thread,       false,          "It would slightly reduc
                                                         " for 1) Cases where it is needed a low latency (e.g., webcam in real-time scenarios with"
                                                         " low-range GPU devices); and 2) Debugging OpenPose when it is crashing to locate the"
                                                         " error.");
+DEFINE_string(thread_affinity,          "",             "CPU affinity of the OpenPose threads. By default (empty), threads are not pinned. Select"
+                                                        " `auto` to distribute the pose extraction threads (1 per GPU) across the NUMA nodes"
+                                                        " (binding their memory to that node), or a `;`-separated list of cores for each thread"
+                                                        " id (e.g., `0;1-7;8-15;16`), where empty entries are not pinned.");
+DEFINE_int32(intra_op_threads,          0,              "Number of OpenMP/BLAS threads of each pose extraction thread when running on CPU. 0"
+                                                        " (default) keeps the library default, while -1 splits the CPU cores among the pose"
+                                                        " extraction threads after subtracting the rest of OpenPose threads.");
 DEFINE_int32(profile_speed,             1000,           "If PROFILER_ENABLED was set in CMake or Makefile.config files, OpenPose will show some"
                                                         " runtime statistics at this frame number.");
 #ifndef OPENPOSE_FLAGS_DISABLE_POSE
@@ -42,6 +49,18 @@ DEFINE_int32(flir_camera_index,         -1,             "Select -1 (default) to
                                                         " camera index to run, where 0 corresponds to the detected flir camera with the lowest"
                                                         " serial number, and `n` to the `n`-th lowest serial number camera.");
 DEFINE_string(ip_camera,                "",             "String with the IP camera URL. It supports protocols like RTSP and HTTP.");
+DEFINE_string(video_views,              "",             "Comma-separated list of video files or IP camera URLs, 1 per camera view (e.g.,"
+                                                        " `cam0.mp4,cam1.mp4` or `rtsp://ip0/stream,rtsp://ip1/stream`). They are decoded in"
+                                                        " parallel and synchronized to the first one by their timestamps (video files) or arrival"
+                                                        " time (IP cameras), dropping or repeating frames as needed. Both clocks cannot be mixed, so"
+                                                        " all the views must be video files or all IP cameras. Meant for 3-D reconstruction (`--3d`)"
+                                                        " with cameras that are not hardware synchronized.");
+DEFINE_string(watch_dir,                "",             "Continuously process the images written or moved into this directory (e.g., by an upstream"
+                                                        " process), as they arrive, without restarting OpenPose (Linux only). The images already on"
+                                                        " it are processed first. It never ends by itself.");
+DEFINE_string(watch_dir_processed,      "",             "Complementary option for `--watch_dir`. What to do with each image once read: keep it (empty,"
+                                                        " by default), `delete` it, or move it to the given directory (ideally on the same file"
+                                                        " system).");
 DEFINE_uint64(frame_first,              0,              "Start on desired frame number. Indexes are 0-based, i.e., the first frame has index 0.");
 DEFINE_uint64(frame_step,               1,              "Step or gap between processed frames. E.g., `--frame_step 5` would read and process frames"
                                                         " 0, 5, 10, etc..");
@@ -135,6 +154,10 @@ DEFINE_bool(part_candidates,            false,          "Also enable `write_json
                                                         " use this information.");
 DEFINE_double(upsampling_ratio,         0.,             "Upsampling ratio between the `net_resolution` and the output net results. A value less"
                                                         " or equal than 0 (default) will use the network default value (recommended).");
+DEFINE_bool(fast_startup,               false,          "Reduce the network initialization time. The Caffe prototxts and trained models are loaded"
+                                                        " in parallel, their weights are cached into a binary `.opcache` file next to each"
+                                                        " caffemodel (created in the first run, so the model folder must be writable) and the"
+                                                        " body, face and hand networks are warmed up before the first frame.");
 // OpenPose Face
 DEFINE_bool(face,                       false,          "Enables face keypoint detection. It will share some parameters from the body pose, e.g."
                                                         " `model_folder`. Note that this will considerable slow down the performance and increse"
@@ -174,6 +197,18 @@ DEFINE_int32(3d_views,                  -1,             "Complementary option fo
                                                         " iteration, allowing tasks such as stereo camera processing (`--3d`). Note that"
                                                         " `--camera_parameter_path` must be set. OpenPose must find as many `xml` files in the"
                                                         " parameter folder as this number indicates.");
+DEFINE_int32(3d_refinement,             0,              "Whether to refine the 2-D detection of each view with the 3-D reconstruction (`--3d`)."
+                                                        " By default (0), it is disabled. If N > 0, the missing or low-confidence 2-D keypoints"
+                                                        " of each view are replaced by the reprojection of the 3-D keypoints, and the body"
+                                                        " network of each view is only run around that reprojection on the following frames"
+                                                        " (faster), except once every N frames, where the whole image is processed to detect"
+                                                        " new people.");
+DEFINE_bool(3d_ground_plane,            false,          "Monocular alternative to `--3d` that only obtains the floor position of each person from"
+                                                        " a single camera, by lifting its foot keypoints to the ground plane. The lifted keypoints"
+                                                        " are saved as `pose_keypoints_3d` and their average as `pose_floor_position` (in meters)."
+                                                        " `--camera_parameter_path` must point to the XML file of that camera, calibrated with"
+                                                        " respect to the floor (calibration toolbox with `--mode 5`). Also enable"
+                                                        " `--frame_undistort` if the camera distortion is noticeable.");
 // Extra algorithms
 DEFINE_bool(identification,             false,          "Experimental, not available yet. Whether to enable people identification across frames.");
 DEFINE_int32(tracking,                  -1,             "Experimental, not available yet. Whether to enable people tracking across frames. The"
@@ -269,12 +304,22 @@ DEFINE_string(write_heatmaps_format,    "png",          "File extension and form
 DEFINE_string(write_keypoint,           "",             "(Deprecated, use `write_json`) Directory to write the people pose keypoint data. Set format"
                                                         " with `write_keypoint_format`.");
 DEFINE_string(write_keypoint_format,    "yml",          "(Deprecated, use `write_json`) File extension and format for `write_keypoint`: json, xml,"
-                                                        " yaml & yml. Json not available for OpenCV < 3.0, use `write_json` instead.");
+                                                        " yaml, yml & bin. Json not available for OpenCV < 3.0, use `write_json` instead. Bin"
+                                                        " saves the keypoints packed as int16 fixed-point coordinates and uint8 scores (~2.4x"
+                                                        " smaller than float), see `include/openpose/filestream/keypointPacking.hpp`.");
+DEFINE_double(packed_keypoint_resolution, 4.,           "Resolution (steps per pixel) of the packed int16 keypoint coordinates of"
+                                                        " `--write_keypoint_format bin` and `--udp_keypoints`. E.g., the default 4 means 0.25"
+                                                        " pixel accuracy and coordinates up to +-8191 pixels. Use a smaller value if"
+                                                        " `--keypoint_scale` is 0 and the input is bigger than that, or a bigger one (e.g., 32767)"
+                                                        " for `--keypoint_scale 3` or 4.");
 // Result Saving - Extra Algorithms
 DEFINE_string(write_bvh,                "",             "Experimental, not available yet. E.g., `~/Desktop/mocapResult.bvh`.");
 // UDP Communication
 DEFINE_string(udp_host,                 "",             "Experimental, not available yet. IP for UDP communication. E.g., `192.168.0.1`.");
 DEFINE_string(udp_port,                 "8051",         "Experimental, not available yet. Port number for UDP communication.");
+DEFINE_bool(udp_keypoints,              false,          "If enabled (and `--udp_host` is set), it sends the keypoints of each frame through UDP,"
+                                                        " packed as int16 fixed-point coordinates (see `--packed_keypoint_resolution`) and uint8"
+                                                        " scores. It requires the `WITH_ASIO` CMake flag.");
 #endif // OPENPOSE_FLAGS_DISABLE_POSE
 
 #endif // OPENPOSE_FLAGS_HPP
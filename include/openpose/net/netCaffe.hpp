@@ -9,8 +9,17 @@ namespace op
     class OP_API NetCaffe : public Net
     {
     public:
+        /**
+         * Constructor of the NetCaffe class.
+         * @param fastStartup If true, the prototxt and trained model start loading asynchronously on construction (so
+         * different nets load in parallel and nets sharing the same model parse it only once), and the weights are
+         * memory-mapped from a binary cache (`caffeTrainedModel` + ".opcache") rather than parsed by protobuf. The
+         * cache is created the first time the model is loaded and re-created if the caffemodel changes (i.e., if its
+         * size or modification time differ).
+         */
         NetCaffe(const std::string& caffeProto, const std::string& caffeTrainedModel, const int gpuId = 0,
-                 const bool enableGoogleLogging = true, const std::string& lastBlobName = "net_output");
+                 const bool enableGoogleLogging = true, const std::string& lastBlobName = "net_output",
+                 const bool fastStartup = false);
 
         virtual ~NetCaffe();
 
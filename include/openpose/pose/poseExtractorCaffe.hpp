@@ -16,6 +16,11 @@ namespace op
     class OP_API PoseExtractorCaffe : public PoseExtractorNet
     {
     public:
+        /**
+         * @param netInputSize Expected net input resolution (e.g., WrapperStructPose::netInputSize). Only used by
+         * fastStartup to warm up the net (and its blobs) at that size, so the first frame does not reshape them.
+         * Dimensions set to -1 (i.e., only known once the first frame arrives) are warmed up at 368.
+         */
         PoseExtractorCaffe(
             const PoseModel poseModel, const std::string& modelFolder, const int gpuId,
             const std::vector<HeatMapType>& heatMapTypes = {},
@@ -23,7 +28,8 @@ namespace op
             const bool addPartCandidates = false, const bool maximizePositives = false,
             const std::string& protoTxtPath = "", const std::string& caffeModelPath = "",
             const float upsamplingRatio = 0.f, const bool enableNet = true,
-            const bool enableGoogleLogging = true);
+            const bool enableGoogleLogging = true, const bool fastStartup = false,
+            const Point<int>& netInputSize = Point<int>{-1, -1});
 
         virtual ~PoseExtractorCaffe();
 
@@ -63,6 +69,8 @@ namespace op
         const float mUpsamplingRatio;
         const bool mEnableNet;
         const bool mEnableGoogleLogging;
+        const bool mFastStartup;
+        const Point<int> mNetInputSize;
         // General parameters
         std::vector<std::shared_ptr<Net>> spNets;
         std::shared_ptr<ResizeAndMergeCaffe<float>> spResizeAndMergeCaffe;
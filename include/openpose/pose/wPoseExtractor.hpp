@@ -74,14 +74,43 @@ namespace op
                 // for (auto& tDatum : *tDatums)
                 {
                     auto& tDatumPtr = (*tDatums)[i];
+                    // Net input only covering a region of the image (e.g., predicted by the 3-D module)
+                    const auto& netInputRectangle = tDatumPtr->netInputRectangle;
+                    const auto isCropped = (netInputRectangle.area() > 0);
+                    const auto inputDataSize = (isCropped
+                        ? Point<int>{netInputRectangle.width, netInputRectangle.height}
+                        : Point<int>{tDatumPtr->cvInputData.cols(), tDatumPtr->cvInputData.rows()});
                     // OpenPose net forward pass
                     spPoseExtractor->forwardPass(
-                        tDatumPtr->inputNetData, Point<int>{tDatumPtr->cvInputData.cols(), tDatumPtr->cvInputData.rows()},
-                        tDatumPtr->scaleInputToNetInputs, tDatumPtr->poseNetOutput, tDatumPtr->id);
+                        tDatumPtr->inputNetData, inputDataSize, tDatumPtr->scaleInputToNetInputs,
+                        tDatumPtr->poseNetOutput, tDatumPtr->id);
                     // OpenPose keypoint detector
                     tDatumPtr->poseCandidates = spPoseExtractor->getCandidatesCopy();
                     tDatumPtr->poseHeatMaps = spPoseExtractor->getHeatMapsCopy();
                     tDatumPtr->poseKeypoints = spPoseExtractor->getPoseKeypoints().clone();
+                    // Cropped net input --> Refer keypoints (detected ones only) to the whole image
+                    if (isCropped)
+                    {
+                        const auto offsetX = float(netInputRectangle.x);
+                        const auto offsetY = float(netInputRectangle.y);
+                        auto& poseKeypoints = tDatumPtr->poseKeypoints;
+                        for (auto index = 0u ; index < poseKeypoints.getVolume() ; index += 3)
+                        {
+                            if (poseKeypoints[index+2] > 0.f)
+                            {
+                                poseKeypoints[index] += offsetX;
+                                poseKeypoints[index+1] += offsetY;
+                            }
+                        }
+                        for (auto& bodyPartCandidates : tDatumPtr->poseCandidates)
+                        {
+                            for (auto& candidate : bodyPartCandidates)
+                            {
+                                candidate[0] += offsetX;
+                                candidate[1] += offsetY;
+                            }
+                        }
+                    }
                     tDatumPtr->poseScores = spPoseExtractor->getPoseScores().clone();
                     tDatumPtr->scaleNetToOutput = spPoseExtractor->getScaleNetToOutput();
                     // Keep desired top N people
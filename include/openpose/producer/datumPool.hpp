@@ -0,0 +1,382 @@
+#ifndef OPENPOSE_PRODUCER_DATUM_POOL_HPP
+#define OPENPOSE_PRODUCER_DATUM_POOL_HPP
+
+#include <atomic>
+#include <cstddef> // std::max_align_t
+#include <openpose/core/common.hpp>
+
+namespace op
+{
+    /**
+     * DatumPool recycles the TDatum objects (and the std::vector holding them) created by DatumProducer, so neither
+     * them nor their network buffers are re-allocated for every frame.
+     * The std::shared_ptr returned by get() and getDatums() automatically gives the object back to the pool once its
+     * last copy is released (i.e., by the final consumer of the Datum), regardless of the thread where that happens.
+     * Their shared_ptr control block lives inside the pooled object, so getting an object does not allocate either.
+     * Once returned, the results of the TDatum (keypoints, heat maps, images, name, etc.) are cleared (i.e., assigned
+     * from a default-constructed TDatum), which also releases the image buffers it was sharing with the rest of the
+     * pipeline. The network input and output buffers (inputNetData and outputData) are kept instead, so the next
+     * frame fills them in place (Array::reset() re-uses a buffer of the same volume that no other Array shares).
+     * Their content is stale until then.
+     * Returning objects is lock-free and thread-safe. get() and getDatums() must always be called from the same
+     * thread (the producer one), which makes the free lists safe from the ABA problem.
+     */
+    template<typename TDatum>
+    class DatumPool
+    {
+    public:
+        /**
+         * @param maxSize Maximum number of idle TDatums (and vectors) kept in the pool. Extra returned ones are
+         * deleted. It should be at least the maximum number of TDatums alive at the same time (roughly the sum of all
+         * queue sizes).
+         */
+        explicit DatumPool(const unsigned int maxSize = 64u);
+
+        virtual ~DatumPool();
+
+        std::shared_ptr<TDatum> get();
+
+        /**
+         * It returns an empty std::vector (with the capacity of its previous use) to hold the TDatums of a frame.
+         */
+        std::shared_ptr<std::vector<std::shared_ptr<TDatum>>> getDatums();
+
+        unsigned int getNumberIdleDatums() const;
+
+    private:
+        template<typename T>
+        struct Node
+        {
+            T object;
+            // Storage for the std::shared_ptr control block (bigger ones are allocated on the heap)
+            alignas(std::max_align_t) unsigned char controlBlock[8*sizeof(void*)];
+            Node* next = nullptr;
+        };
+
+        // It must outlive the DatumPool while any object is still in use, so it is shared with the allocators
+        template<typename T>
+        class FreeList
+        {
+        public:
+            explicit FreeList(const unsigned int maxSize);
+
+            ~FreeList();
+
+            Node<T>* pop();
+
+            void push(Node<T>* node);
+
+            unsigned int size() const;
+
+        private:
+            const unsigned int mMaxSize;
+            const T mEmptyObject;
+            std::atomic<Node<T>*> mHead;
+            std::atomic<unsigned int> mSize;
+
+            DELETE_COPY(FreeList);
+        };
+
+        // Allocator of the std::shared_ptr control block. It places it inside the Node, and it gives the Node back
+        // to its FreeList when the control block is released (i.e., after the last std::shared_ptr and
+        // std::weak_ptr copies are gone)
+        template<typename U, typename T>
+        class NodeAllocator
+        {
+        public:
+            typedef U value_type;
+
+            template<typename V>
+            struct rebind
+            {
+                typedef NodeAllocator<V, T> other;
+            };
+
+            NodeAllocator(const std::shared_ptr<FreeList<T>>& freeList, Node<T>* node);
+
+            template<typename V>
+            NodeAllocator(const NodeAllocator<V, T>& nodeAllocator);
+
+            U* allocate(const std::size_t n);
+
+            void deallocate(U* ptr, const std::size_t n);
+
+            std::shared_ptr<FreeList<T>> spFreeList;
+            Node<T>* pNode;
+        };
+
+        const std::shared_ptr<FreeList<TDatum>> spDatumFreeList;
+        const std::shared_ptr<FreeList<std::vector<std::shared_ptr<TDatum>>>> spDatumsFreeList;
+
+        template<typename T>
+        static std::shared_ptr<T> getFromFreeList(const std::shared_ptr<FreeList<T>>& freeList);
+
+        static void recycle(TDatum& datum, const TDatum& emptyDatum);
+
+        static void recycle(
+            std::vector<std::shared_ptr<TDatum>>& datums, const std::vector<std::shared_ptr<TDatum>>& emptyDatums);
+
+        DELETE_COPY(DatumPool);
+    };
+}
+
+
+
+
+
+// Implementation
+namespace op
+{
+    template<typename TDatum>
+    DatumPool<TDatum>::DatumPool(const unsigned int maxSize) :
+        spDatumFreeList{std::make_shared<FreeList<TDatum>>(maxSize)},
+        spDatumsFreeList{std::make_shared<FreeList<std::vector<std::shared_ptr<TDatum>>>>(maxSize)}
+    {
+    }
+
+    template<typename TDatum>
+    DatumPool<TDatum>::~DatumPool()
+    {
+    }
+
+    template<typename TDatum>
+    std::shared_ptr<TDatum> DatumPool<TDatum>::get()
+    {
+        try
+        {
+            return getFromFreeList(spDatumFreeList);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+
+    template<typename TDatum>
+    std::shared_ptr<std::vector<std::shared_ptr<TDatum>>> DatumPool<TDatum>::getDatums()
+    {
+        try
+        {
+            return getFromFreeList(spDatumsFreeList);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+
+    template<typename TDatum>
+    unsigned int DatumPool<TDatum>::getNumberIdleDatums() const
+    {
+        try
+        {
+            return spDatumFreeList->size();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0u;
+        }
+    }
+
+    template<typename TDatum>
+    template<typename T>
+    std::shared_ptr<T> DatumPool<TDatum>::getFromFreeList(const std::shared_ptr<FreeList<T>>& freeList)
+    {
+        try
+        {
+            auto* node = freeList->pop();
+            if (node == nullptr)
+                node = new Node<T>();
+            // The deleter does nothing, the allocator returns the Node once the control block is released
+            return std::shared_ptr<T>{&node->object, [](T*){}, NodeAllocator<T, T>{freeList, node}};
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+
+    template<typename TDatum>
+    void DatumPool<TDatum>::recycle(TDatum& datum, const TDatum& emptyDatum)
+    {
+        try
+        {
+            // Keep the network buffers (not shared with any other Datum once the Datum is returned, unless the user
+            // copied them, in which case the next Array::reset() allocates a new one)
+            auto inputNetData = std::move(datum.inputNetData);
+            auto outputData = std::move(datum.outputData);
+            // Clear everything else (shallow assignment, no member is re-allocated)
+            datum = emptyDatum;
+            datum.inputNetData = std::move(inputNetData);
+            datum.outputData = std::move(outputData);
+        }
+        catch (const std::exception& e)
+        {
+            errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename TDatum>
+    void DatumPool<TDatum>::recycle(
+        std::vector<std::shared_ptr<TDatum>>& datums, const std::vector<std::shared_ptr<TDatum>>& emptyDatums)
+    {
+        try
+        {
+            UNUSED(emptyDatums);
+            // Keep its capacity (releasing the TDatums gives them back to their own free list)
+            datums.clear();
+        }
+        catch (const std::exception& e)
+        {
+            errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename TDatum>
+    template<typename T>
+    DatumPool<TDatum>::FreeList<T>::FreeList(const unsigned int maxSize) :
+        mMaxSize{maxSize},
+        mEmptyObject{},
+        mHead{nullptr},
+        mSize{0u}
+    {
+    }
+
+    template<typename TDatum>
+    template<typename T>
+    DatumPool<TDatum>::FreeList<T>::~FreeList()
+    {
+        try
+        {
+            auto* node = mHead.load();
+            while (node != nullptr)
+            {
+                auto* next = node->next;
+                delete node;
+                node = next;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename TDatum>
+    template<typename T>
+    typename DatumPool<TDatum>::template Node<T>* DatumPool<TDatum>::FreeList<T>::pop()
+    {
+        try
+        {
+            // Single consumer: no other thread can pop (and re-push) the head between load and exchange
+            auto* node = mHead.load(std::memory_order_acquire);
+            while (node != nullptr
+                   && !mHead.compare_exchange_weak(node, node->next, std::memory_order_acquire,
+                                                   std::memory_order_acquire))
+            {
+            }
+            if (node != nullptr)
+            {
+                mSize--;
+                node->next = nullptr;
+            }
+            return node;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+
+    template<typename TDatum>
+    template<typename T>
+    void DatumPool<TDatum>::FreeList<T>::push(Node<T>* node)
+    {
+        try
+        {
+            // Clear it (i.e., release the buffers shared with the rest of the pipeline and remove any result of the
+            // previous frame)
+            recycle(node->object, mEmptyObject);
+            // Pool full --> Delete it
+            if (mSize.fetch_add(1u) >= mMaxSize)
+            {
+                mSize--;
+                delete node;
+            }
+            // Otherwise, push it into the free list
+            else
+            {
+                node->next = mHead.load(std::memory_order_relaxed);
+                while (!mHead.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                                    std::memory_order_relaxed))
+                {
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename TDatum>
+    template<typename T>
+    unsigned int DatumPool<TDatum>::FreeList<T>::size() const
+    {
+        try
+        {
+            return mSize.load();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0u;
+        }
+    }
+
+    template<typename TDatum>
+    template<typename U, typename T>
+    DatumPool<TDatum>::NodeAllocator<U, T>::NodeAllocator(
+        const std::shared_ptr<FreeList<T>>& freeList, Node<T>* node) :
+        spFreeList{freeList},
+        pNode{node}
+    {
+    }
+
+    template<typename TDatum>
+    template<typename U, typename T>
+    template<typename V>
+    DatumPool<TDatum>::NodeAllocator<U, T>::NodeAllocator(const NodeAllocator<V, T>& nodeAllocator) :
+        spFreeList{nodeAllocator.spFreeList},
+        pNode{nodeAllocator.pNode}
+    {
+    }
+
+    template<typename TDatum>
+    template<typename U, typename T>
+    U* DatumPool<TDatum>::NodeAllocator<U, T>::allocate(const std::size_t n)
+    {
+        // A Node is only handed out once until it is returned, so its storage holds a single control block
+        if (n * sizeof(U) <= sizeof(pNode->controlBlock) && alignof(U) <= alignof(std::max_align_t))
+            return reinterpret_cast<U*>(pNode->controlBlock);
+        return static_cast<U*>(::operator new(n * sizeof(U)));
+    }
+
+    template<typename TDatum>
+    template<typename U, typename T>
+    void DatumPool<TDatum>::NodeAllocator<U, T>::deallocate(U* ptr, const std::size_t n)
+    {
+        UNUSED(n);
+        if ((void*)ptr != (void*)pNode->controlBlock)
+            ::operator delete(ptr);
+        // Control block released --> No copy of the std::shared_ptr left, give the Node back
+        spFreeList->push(pNode);
+    }
+}
+
+#endif // OPENPOSE_PRODUCER_DATUM_POOL_HPP
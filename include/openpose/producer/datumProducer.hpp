@@ -6,6 +6,7 @@
 #include <openpose/core/common.hpp>
 #include <openpose/core/datum.hpp>
 #include <openpose/utilities/fastMath.hpp>
+#include <openpose/producer/datumPool.hpp>
 #include <openpose/producer/producer.hpp>
 
 namespace op
@@ -31,6 +32,8 @@ namespace op
         unsigned long long mFrameStep;
         unsigned int mNumberConsecutiveEmptyFrames;
         std::shared_ptr<std::pair<std::atomic<bool>, std::atomic<int>>> spVideoSeek;
+        // Recycled TDatums (and their vectors), to avoid re-allocating them (and their buffers) for each frame
+        DatumPool<TDatum> mDatumPool;
 
         void checkIfTooManyConsecutiveEmptyFrames(
             unsigned int& numberConsecutiveEmptyFrames, const bool emptyFrame) const;
@@ -76,7 +79,8 @@ namespace op
         mGlobalCounter{0ll},
         mFrameStep{frameStep},
         mNumberConsecutiveEmptyFrames{0u},
-        spVideoSeek{videoSeekSharedPtr}
+        spVideoSeek{videoSeekSharedPtr},
+        mDatumPool{}
     {
         try
         {
@@ -102,7 +106,7 @@ namespace op
             const bool datumProducerRunning = datumProducerConstructorRunningAndGetDatumIsDatumProducerRunning(
                 spProducer, mNumberFramesToProcess, mGlobalCounter);
             // If device is open
-            auto datums = std::make_shared<std::vector<std::shared_ptr<TDatum>>>();
+            auto datums = mDatumPool.getDatums();
             if (datumProducerRunning)
             {
                 // Fast forward/backward - Seek to specific frame index desired
@@ -125,7 +129,7 @@ namespace op
                     datums->resize(matrices.size());
                     // Datum cannot be assigned before resize()
                     auto& datumPtr = (*datums)[0];
-                    datumPtr = std::make_shared<TDatum>();
+                    datumPtr = mDatumPool.get();
                     // Filling first element
                     std::swap(datumPtr->name, nextFrameName);
                     datumPtr->frameNumber = nextFrameNumber;
@@ -146,7 +150,7 @@ namespace op
                         for (auto i = 1u ; i < datums->size() ; i++)
                         {
                             auto& datumIPtr = (*datums)[i];
-                            datumIPtr = std::make_shared<TDatum>();
+                            datumIPtr = mDatumPool.get();
                             datumIPtr->name = datumPtr->name;
                             datumIPtr->frameNumber = datumPtr->frameNumber;
                             datumIPtr->cvInputData = matrices[i];
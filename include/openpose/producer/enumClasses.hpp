@@ -36,8 +36,16 @@ namespace op
         ImageDirectory,
         /** An IP camera frames extractor, extending the functionality of cv::VideoCapture. */
         IPCamera,
+        /** Several video files and/or IP camera streams (1 per camera view), decoded in parallel and synchronized by
+         * their timestamps.
+         */
+        MultiVideo,
         /** A video frames extractor, extending the functionality of cv::VideoCapture. */
         Video,
+        /** A folder watcher (Linux only). It continuously reads the images written or moved into a folder (e.g., by
+         * an upstream process) as they arrive.
+         */
+        WatchFolder,
         /** A webcam frames extractor, extending the functionality of cv::VideoCapture. */
         Webcam,
         /** No type defined. Default state when no specific Producer has been picked yet. */
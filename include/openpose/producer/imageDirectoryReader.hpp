@@ -16,7 +16,12 @@ namespace op
     public:
         /**
          * Constructor of ImageDirectoryReader. It sets the image directory path from which the images will be loaded
-         * and generates a std::vector<std::string> with the list of images on that directory.
+         * and generates a std::vector<std::string> with the list of images on that directory (sorted in natural
+         * order). For folders with at least 10,000 images, the sorted list is cached in an index file on the user
+         * cache folder (`$XDG_CACHE_HOME/openpose/image_index/`, `~/.cache/openpose/image_index/` or
+         * `%LOCALAPPDATA%/openpose/image_index/`), which is re-used until any file is added, removed or renamed
+         * (i.e., until the modification time of the folder changes). It is not cached if the folder was modified
+         * less than 2 seconds before listing it, as a change in the same second might not update its time.
          * @param imageDirectoryPath const std::string parameter with the folder path containing the images.
          * @param cameraParameterPath const std::string parameter with the folder path containing the camera
          * parameters (only required if imageDirectorystereo > 1).
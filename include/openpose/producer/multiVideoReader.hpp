@@ -0,0 +1,57 @@
+#ifndef OPENPOSE_PRODUCER_MULTI_VIDEO_READER_HPP
+#define OPENPOSE_PRODUCER_MULTI_VIDEO_READER_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/producer/producer.hpp>
+
+namespace op
+{
+    /**
+     * MultiVideoReader reads several independent video files or IP camera streams simultaneously, each one of
+     * them being a different camera view (e.g., for 3-D reconstruction with cameras that are not hardware
+     * synchronized). Each view is decoded in its own thread.
+     * The views are aligned to the clock of the first one: for each frame of the first view, the closest frame of
+     * each other view is returned, so frames of the other views are dropped or repeated to stay in sync. If the
+     * closest frame of a view is further than half a frame period (of the first view), the frame of the first view
+     * is dropped (if that view is ahead) or the last frame of that view repeated (if it is behind).
+     * Video files are aligned with their frame timestamps, while IP camera streams use their arrival time. Given
+     * that both clocks cannot be compared, all the views must be video files or all of them IP camera streams.
+     */
+    class OP_API MultiVideoReader : public Producer
+    {
+    public:
+        /**
+         * Constructor of MultiVideoReader. It opens all the videos/streams and starts decoding them.
+         * @param videoPaths Video file paths or IP camera URLs (not both), one per camera view (at least 2).
+         * @param numberViews Number of views. If > 0, it must match videoPaths.size().
+         */
+        explicit MultiVideoReader(const std::vector<std::string>& videoPaths, const std::string& cameraParameterPath,
+                                  const bool undistortImage = false, const int numberViews = -1);
+
+        virtual ~MultiVideoReader();
+
+        std::string getNextFrameName();
+
+        bool isOpened() const;
+
+        void release();
+
+        double get(const int capProperty);
+
+        void set(const int capProperty, const double value);
+
+    private:
+        // PIMPL idiom
+        // http://www.cppsamples.com/common-tasks/pimpl.html
+        struct ImplMultiVideoReader;
+        std::unique_ptr<ImplMultiVideoReader> upImpl;
+
+        Matrix getRawFrame();
+
+        std::vector<Matrix> getRawFrames();
+
+        DELETE_COPY(MultiVideoReader);
+    };
+}
+
+#endif // OPENPOSE_PRODUCER_MULTI_VIDEO_READER_HPP
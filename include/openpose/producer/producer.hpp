@@ -178,12 +178,14 @@ namespace op
 
     /**
      * This function returns the desired producer given the input parameters.
+     * @param processedFilesPath Only for ProducerType::WatchFolder, what to do with each image once read (see
+     * WatchFolderReader).
      */
     OP_API std::shared_ptr<Producer> createProducer(
         const ProducerType producerType = ProducerType::None, const std::string& producerString = "",
         const Point<int>& cameraResolution = Point<int>{-1,-1},
         const std::string& cameraParameterPath = "models/cameraParameters/", const bool undistortImage = true,
-        const int numberViews = -1);
+        const int numberViews = -1, const std::string& processedFilesPath = "");
 }
 
 #endif // OPENPOSE_PRODUCER_PRODUCER_HPP
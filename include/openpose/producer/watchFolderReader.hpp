@@ -0,0 +1,64 @@
+#ifndef OPENPOSE_PRODUCER_WATCH_FOLDER_READER_HPP
+#define OPENPOSE_PRODUCER_WATCH_FOLDER_READER_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/producer/producer.hpp>
+
+namespace op
+{
+    /**
+     * WatchFolderReader continuously reads the images dropped into a folder (e.g., by an upstream process), so
+     * OpenPose (and its models) does not have to be restarted for each new batch of images. Only available on Linux.
+     * The folder is watched with inotify, and each new image is read once it is closed after being written or moved
+     * into the folder (so partially written files are never read). The images already on the folder when it starts
+     * are read first (in natural order). If one of them was still being written, it is read once it is closed
+     * instead (or again, if it was already being decoded by then).
+     * The images are decoded in parallel by a small pool of threads, and returned in the order they arrived. Up to a
+     * few decoded images are kept in memory. Once that limit is reached, new images wait on disk until the pipeline
+     * processes the previous ones (backpressure).
+     * It never ends by itself, but it can be stopped as any other producer (e.g., by closing the GUI).
+     */
+    class OP_API WatchFolderReader : public Producer
+    {
+    public:
+        /**
+         * Constructor of WatchFolderReader. It starts watching the folder.
+         * @param watchDirectoryPath Folder to watch.
+         * @param processedFilesPath What to do with each image once it is read: "" to keep it, "delete" to remove
+         * it, or a folder path to move it there (created if it does not exist, and it should be on the same file
+         * system to avoid copies). Images that cannot be decoded are always kept.
+         */
+        explicit WatchFolderReader(
+            const std::string& watchDirectoryPath, const std::string& processedFilesPath = "",
+            const std::string& cameraParameterPath = "", const bool undistortImage = false);
+
+        virtual ~WatchFolderReader();
+
+        /**
+         * It waits until the next image is decoded, and returns its file name (without extension).
+         */
+        std::string getNextFrameName();
+
+        bool isOpened() const;
+
+        void release();
+
+        double get(const int capProperty);
+
+        void set(const int capProperty, const double value);
+
+    private:
+        // PIMPL idiom
+        // http://www.cppsamples.com/common-tasks/pimpl.html
+        struct ImplWatchFolderReader;
+        std::unique_ptr<ImplWatchFolderReader> upImpl;
+
+        Matrix getRawFrame();
+
+        std::vector<Matrix> getRawFrames();
+
+        DELETE_COPY(WatchFolderReader);
+    };
+}
+
+#endif // OPENPOSE_PRODUCER_WATCH_FOLDER_READER_HPP
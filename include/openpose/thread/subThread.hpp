@@ -1,6 +1,8 @@
 #ifndef OPENPOSE_THREAD_SUB_THREAD_HPP
 #define OPENPOSE_THREAD_SUB_THREAD_HPP
 
+#include <atomic>
+#include <mutex>
 #include <openpose/core/common.hpp>
 #include <openpose/thread/worker.hpp>
 
@@ -17,6 +19,14 @@ namespace op
 
         void initializationOnThread();
 
+        /**
+         * It replaces its TWorkers. It can be called from any thread (including a TWorker of this SubThread): the
+         * thread running this SubThread initializes the new TWorkers (initializationOnThread) and switches to them
+         * right before working on its next TDatums, so the rest of SubThreads are not interrupted. The previous
+         * TWorkers are released from that thread as well.
+         */
+        void setTWorkers(const std::vector<TWorker>& tWorkers);
+
         virtual bool work() = 0;
 
     protected:
@@ -29,6 +39,12 @@ namespace op
 
     private:
         std::vector<TWorker> mTWorkers;
+        // TWorkers waiting to replace mTWorkers (see setTWorkers)
+        std::atomic<bool> mTWorkersReplaced;
+        std::mutex mNewTWorkersMutex;
+        std::vector<TWorker> mNewTWorkers;
+
+        void replaceTWorkers();
 
         DELETE_COPY(SubThread);
     };
@@ -43,7 +59,8 @@ namespace op
 {
     template<typename TDatums, typename TWorker>
     SubThread<TDatums, TWorker>::SubThread(const std::vector<TWorker>& tWorkers) :
-        mTWorkers{tWorkers}
+        mTWorkers{tWorkers},
+        mTWorkersReplaced{false}
     {
     }
 
@@ -57,6 +74,10 @@ namespace op
     {
         try
         {
+            // New TWorkers (if setTWorkers was called)
+            if (mTWorkersReplaced)
+                replaceTWorkers();
+
             // If !inputIsRunning -> try to close TWorkers
             if (!inputIsRunning)
             {
@@ -151,6 +172,48 @@ namespace op
         }
     }
 
+    template<typename TDatums, typename TWorker>
+    void SubThread<TDatums, TWorker>::setTWorkers(const std::vector<TWorker>& tWorkers)
+    {
+        try
+        {
+            if (tWorkers.empty())
+                error("No TWorker(s) given.", __LINE__, __FUNCTION__, __FILE__);
+            const std::lock_guard<std::mutex> lock{mNewTWorkersMutex};
+            mNewTWorkers = tWorkers;
+            mTWorkersReplaced = true;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename TDatums, typename TWorker>
+    void SubThread<TDatums, TWorker>::replaceTWorkers()
+    {
+        try
+        {
+            std::vector<TWorker> tWorkers;
+            {
+                const std::lock_guard<std::mutex> lock{mNewTWorkersMutex};
+                std::swap(tWorkers, mNewTWorkers);
+                mTWorkersReplaced = false;
+            }
+            if (!tWorkers.empty())
+            {
+                for (auto& tWorker : tWorkers)
+                    tWorker->initializationOnThreadNoException();
+                // The previous TWorkers are released here (i.e., on this thread) unless someone else still keeps them
+                std::swap(mTWorkers, tWorkers);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     COMPILE_TEMPLATE_DATUM(SubThread);
 }
 
@@ -2,8 +2,10 @@
 #define OPENPOSE_THREAD_THREAD_HPP
 
 #include <atomic>
+#include <thread>
 #include <openpose/core/common.hpp>
 #include <openpose/thread/subThread.hpp>
+#include <openpose/utilities/threadAffinity.hpp>
 #include <openpose/thread/worker.hpp>
 
 namespace op
@@ -27,6 +29,13 @@ namespace op
 
         void add(const std::shared_ptr<SubThread<TDatums, TWorker>>& subThread);
 
+        /**
+         * It sets the CPU cores, NUMA node and intra-op threads of this thread. It is applied when the thread
+         * starts (i.e., before initializationOnThread(), so the Workers allocate their memory on that NUMA node).
+         * Note that exec() runs on the calling thread, so its affinity is modified too.
+         */
+        void setThreadAffinity(const ThreadAffinity& threadAffinity);
+
         void exec(const std::shared_ptr<std::atomic<bool>>& isRunningSharedPtr);
 
         void startInThread();
@@ -38,10 +47,21 @@ namespace op
             return *spIsRunning;
         }
 
+        /**
+         * Whether the calling thread is the one running this Thread (i.e., called from one of its TWorkers).
+         */
+        inline bool isCurrentThread() const
+        {
+            return mThreadId.load() == std::this_thread::get_id();
+        }
+
     private:
         std::shared_ptr<std::atomic<bool>> spIsRunning;
         std::vector<std::shared_ptr<SubThread<TDatums, TWorker>>> mSubThreads;
         std::thread mThread;
+        ThreadAffinity mThreadAffinity;
+        // Id of the thread running threadFunction() (the std::thread or the one calling exec())
+        std::atomic<std::thread::id> mThreadId;
 
         void initializationOnThread();
 
@@ -64,16 +84,19 @@ namespace op
 {
     template<typename TDatums, typename TWorker>
     Thread<TDatums, TWorker>::Thread(const std::shared_ptr<std::atomic<bool>>& isRunningSharedPtr) :
-        spIsRunning{(isRunningSharedPtr != nullptr ? isRunningSharedPtr : std::make_shared<std::atomic<bool>>(false))}
+        spIsRunning{(isRunningSharedPtr != nullptr ? isRunningSharedPtr : std::make_shared<std::atomic<bool>>(false))},
+        mThreadId{std::thread::id{}}
     {
     }
 
     template<typename TDatums, typename TWorker>
     Thread<TDatums, TWorker>::Thread(Thread<TDatums, TWorker>&& t) :
-        spIsRunning{std::make_shared<std::atomic<bool>>(t.spIsRunning->load())}
+        spIsRunning{std::make_shared<std::atomic<bool>>(t.spIsRunning->load())},
+        mThreadId{t.mThreadId.load()}
     {
         std::swap(mSubThreads, t.mSubThreads);
         std::swap(mThread, t.mThread);
+        std::swap(mThreadAffinity, t.mThreadAffinity);
     }
 
     template<typename TDatums, typename TWorker>
@@ -81,7 +104,9 @@ namespace op
     {
         std::swap(mSubThreads, t.mSubThreads);
         std::swap(mThread, t.mThread);
+        std::swap(mThreadAffinity, t.mThreadAffinity);
         spIsRunning = {std::make_shared<std::atomic<bool>>(t.spIsRunning->load())};
+        mThreadId = t.mThreadId.load();
         return *this;
     }
 
@@ -113,6 +138,19 @@ namespace op
         add(std::vector<std::shared_ptr<SubThread<TDatums, TWorker>>>{subThread});
     }
 
+    template<typename TDatums, typename TWorker>
+    void Thread<TDatums, TWorker>::setThreadAffinity(const ThreadAffinity& threadAffinity)
+    {
+        try
+        {
+            mThreadAffinity = threadAffinity;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     template<typename TDatums, typename TWorker>
     void Thread<TDatums, TWorker>::exec(const std::shared_ptr<std::atomic<bool>>& isRunningSharedPtr)
     {
@@ -180,6 +218,9 @@ namespace op
         try
         {
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            mThreadId = std::this_thread::get_id();
+            if (!mThreadAffinity.empty())
+                applyThreadAffinity(mThreadAffinity);
             initializationOnThread();
 
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
@@ -196,10 +237,12 @@ namespace op
                     break;
                 }
             }
+            mThreadId = std::thread::id{};
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
         }
         catch (const std::exception& e)
         {
+            mThreadId = std::thread::id{};
             error(e.what(), __LINE__, __FUNCTION__, __FILE__);
         }
     }
@@ -3,6 +3,7 @@
 
 #include <atomic>
 #include <set> // std::multiset
+#include <thread>
 #include <tuple>
 #include <openpose/core/common.hpp>
 #include <openpose/thread/enumClasses.hpp>
@@ -32,12 +33,28 @@ namespace op
          */
         void setDefaultMaxSizeQueues(const long long defaultMaxSizeQueues = -1);
 
+        /**
+         * It sets the ThreadAffinity of each thread, where the index of each element is the thread id. Thread ids
+         * without ThreadAffinity (or with an empty one) are not modified.
+         * It must be called before start() or exec().
+         */
+        void setThreadAffinities(const std::vector<ThreadAffinity>& threadAffinities);
+
         void add(const unsigned long long threadId, const std::vector<TWorker>& tWorkers,
                  const unsigned long long queueInId, const unsigned long long queueOutId);
 
         void add(const unsigned long long threadId, const TWorker& tWorker, const unsigned long long queueInId,
                  const unsigned long long queueOutId);
 
+        /**
+         * It replaces the TWorkers added with add() (i.e., the same std::vector<TWorker>) by newTWorkers, without
+         * stopping the ThreadManager nor any other TWorker. If it was started with start() or exec(), their thread
+         * switches to (and initializes) newTWorkers right before its next TDatums (see SubThread::setTWorkers).
+         * It cannot be applied after startInline().
+         * @return Whether tWorkers was found (and replaced).
+         */
+        bool setTWorkers(const std::vector<TWorker>& tWorkers, const std::vector<TWorker>& newTWorkers);
+
         void reset();
 
         void exec();
@@ -46,6 +63,20 @@ namespace op
 
         void stop();
 
+        /**
+         * Alternative to start() that does not create any Thread nor queue. The TWorkers are initialized on the
+         * calling thread and run sequentially by workInline(), also on its calling thread.
+         * Only a single chain of TWorkers is supported, i.e., each queue id must be consumed by a single TWorker
+         * vector (e.g., as configured by WrapperT when multi-threading is disabled).
+         */
+        void startInline();
+
+        /**
+         * It runs the whole chain of TWorkers over tDatums. Only valid after startInline().
+         * @return Whether tDatums was processed by all the TWorkers (i.e., no TWorker stopped nor discarded it).
+         */
+        bool workInline(TDatums& tDatums);
+
         inline std::shared_ptr<std::atomic<bool>> getIsRunningSharedPtr()
         {
             return spIsRunning;
@@ -56,6 +87,12 @@ namespace op
             return *spIsRunning;
         }
 
+        /**
+         * Whether the calling thread is running its TWorkers (i.e., it is called from a TWorker, including the ones
+         * run by exec() or workInline()). stop() must not be called from them, as it waits for those threads to end.
+         */
+        bool isWorkerThread() const;
+
         bool tryEmplace(TDatums& tDatums);
 
         bool waitAndEmplace(TDatums& tDatums);
@@ -72,9 +109,13 @@ namespace op
         const ThreadManagerMode mThreadManagerMode;
         std::shared_ptr<std::atomic<bool>> spIsRunning;
         long long mDefaultMaxSizeQueues;
+        std::vector<ThreadAffinity> mThreadAffinities;
         std::multiset<std::tuple<unsigned long long, std::vector<TWorker>, unsigned long long, unsigned long long>> mThreadWorkerQueues;
         std::vector<std::shared_ptr<Thread<TDatums, TWorker>>> mThreads;
         std::vector<std::shared_ptr<TQueue>> mTQueues;
+        std::vector<std::pair<std::vector<TWorker>, std::shared_ptr<SubThread<TDatums, TWorker>>>> mSubThreads;
+        std::vector<std::vector<TWorker>> mInlineTWorkers;
+        std::atomic<std::thread::id> mInlineThreadId;
 
         void add(const std::vector<std::tuple<unsigned long long, std::vector<TWorker>, unsigned long long, unsigned long long>>& threadWorkerQueues);
 
@@ -86,6 +127,8 @@ namespace op
 
         void checkAndCreateQueues();
 
+        bool workInlineTWorkers(TDatums& tDatums);
+
         DELETE_COPY(ThreadManager);
     };
 }
@@ -95,6 +138,7 @@ namespace op
 
 
 // Implementation
+#include <algorithm> // std::sort
 #include <utility> // std::pair
 #include <openpose/utilities/fastMath.hpp>
 #include <openpose/thread/subThread.hpp>
@@ -108,7 +152,8 @@ namespace op
     ThreadManager<TDatums, TWorker, TQueue>::ThreadManager(const ThreadManagerMode threadManagerMode) :
         mThreadManagerMode{threadManagerMode},
         spIsRunning{std::make_shared<std::atomic<bool>>(false)},
-        mDefaultMaxSizeQueues{-1ll}
+        mDefaultMaxSizeQueues{-1ll},
+        mInlineThreadId{std::thread::id{}}
     {
     }
 
@@ -130,6 +175,20 @@ namespace op
         }
     }
 
+    template<typename TDatums, typename TWorker, typename TQueue>
+    void ThreadManager<TDatums, TWorker, TQueue>::setThreadAffinities(
+        const std::vector<ThreadAffinity>& threadAffinities)
+    {
+        try
+        {
+            mThreadAffinities = threadAffinities;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     template<typename TDatums, typename TWorker, typename TQueue>
     void ThreadManager<TDatums, TWorker, TQueue>::add(const unsigned long long threadId,
                                                       const std::vector<TWorker>& tWorkers,
@@ -162,6 +221,68 @@ namespace op
         }
     }
 
+    template<typename TDatums, typename TWorker, typename TQueue>
+    bool ThreadManager<TDatums, TWorker, TQueue>::setTWorkers(
+        const std::vector<TWorker>& tWorkers, const std::vector<TWorker>& newTWorkers)
+    {
+        try
+        {
+            if (!mInlineTWorkers.empty())
+                error("TWorkers cannot be replaced after startInline().", __LINE__, __FUNCTION__, __FILE__);
+            // Configuration (used by the next start() or exec())
+            auto found = false;
+            for (auto threadWorkerQueue = mThreadWorkerQueues.begin() ; threadWorkerQueue != mThreadWorkerQueues.end()
+                 ; threadWorkerQueue++)
+            {
+                if (std::get<1>(*threadWorkerQueue) == tWorkers)
+                {
+                    const auto threadId = std::get<0>(*threadWorkerQueue);
+                    const auto queueInId = std::get<2>(*threadWorkerQueue);
+                    const auto queueOutId = std::get<3>(*threadWorkerQueue);
+                    mThreadWorkerQueues.erase(threadWorkerQueue);
+                    mThreadWorkerQueues.insert(std::make_tuple(threadId, newTWorkers, queueInId, queueOutId));
+                    found = true;
+                    break;
+                }
+            }
+            // Running SubThread
+            for (auto& subThread : mSubThreads)
+            {
+                if (subThread.first == tWorkers)
+                {
+                    subThread.second->setTWorkers(newTWorkers);
+                    subThread.first = newTWorkers;
+                    break;
+                }
+            }
+            return found;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    template<typename TDatums, typename TWorker, typename TQueue>
+    bool ThreadManager<TDatums, TWorker, TQueue>::isWorkerThread() const
+    {
+        try
+        {
+            if (mInlineThreadId.load() == std::this_thread::get_id())
+                return true;
+            for (const auto& thread : mThreads)
+                if (thread->isCurrentThread())
+                    return true;
+            return false;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
     template<typename TDatums, typename TWorker, typename TQueue>
     void ThreadManager<TDatums, TWorker, TQueue>::reset()
     {
@@ -170,6 +291,9 @@ namespace op
             mThreadWorkerQueues.clear();
             mThreads.clear();
             mTQueues.clear();
+            mSubThreads.clear();
+            mThreadAffinities.clear();
+            mInlineTWorkers.clear();
         }
         catch (const std::exception& e)
         {
@@ -234,6 +358,7 @@ namespace op
             *spIsRunning = false;
             for (auto& thread : mThreads)
                 thread->stopAndJoin();
+            mInlineTWorkers.clear();
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             checkWorkerErrors();
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
@@ -244,6 +369,69 @@ namespace op
         }
     }
 
+    template<typename TDatums, typename TWorker, typename TQueue>
+    void ThreadManager<TDatums, TWorker, TQueue>::startInline()
+    {
+        try
+        {
+            opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            if (mThreadWorkerQueues.empty())
+                error("Empty, no TWorker(s) added.", __LINE__, __FUNCTION__, __FILE__);
+            // This avoids extra std::cout if errors occur on different threads
+            setMainThread();
+            // Sort TWorkers by input queue (they might have been added in different threads)
+            std::vector<std::pair<unsigned long long, std::vector<TWorker>>> queueInTWorkers;
+            for (const auto& threadWorkerQueue : mThreadWorkerQueues)
+                queueInTWorkers.emplace_back(std::get<2>(threadWorkerQueue), std::get<1>(threadWorkerQueue));
+            std::sort(queueInTWorkers.begin(), queueInTWorkers.end(),
+                      [](const std::pair<unsigned long long, std::vector<TWorker>>& a,
+                         const std::pair<unsigned long long, std::vector<TWorker>>& b)
+                      {
+                          return a.first < b.first;
+                      });
+            mInlineTWorkers.clear();
+            for (auto i = 0u ; i < queueInTWorkers.size() ; i++)
+            {
+                if (i > 0 && queueInTWorkers[i].first == queueInTWorkers[i-1].first)
+                    error("Several TWorkers consume queue id " + std::to_string(queueInTWorkers[i].first) + ", so"
+                          " they cannot be run inline (disable multi-threading).", __LINE__, __FUNCTION__, __FILE__);
+                mInlineTWorkers.emplace_back(queueInTWorkers[i].second);
+            }
+            // Calling thread affinity
+            if (!mThreadAffinities.empty() && !mThreadAffinities[0].empty())
+                applyThreadAffinity(mThreadAffinities[0]);
+            // Initialize TWorkers
+            for (auto& tWorkers : mInlineTWorkers)
+                for (auto& tWorker : tWorkers)
+                    tWorker->initializationOnThreadNoException();
+            *spIsRunning = true;
+            opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename TDatums, typename TWorker, typename TQueue>
+    bool ThreadManager<TDatums, TWorker, TQueue>::workInline(TDatums& tDatums)
+    {
+        try
+        {
+            // So isWorkerThread() can be checked from the TWorkers
+            mInlineThreadId = std::this_thread::get_id();
+            const auto processed = workInlineTWorkers(tDatums);
+            mInlineThreadId = std::thread::id{};
+            return processed;
+        }
+        catch (const std::exception& e)
+        {
+            mInlineThreadId = std::thread::id{};
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
     template<typename TDatums, typename TWorker, typename TQueue>
     bool ThreadManager<TDatums, TWorker, TQueue>::tryEmplace(TDatums& tDatums)
     {
@@ -409,6 +597,7 @@ namespace op
 
                 // Data
                 const auto maxQueueIdSynchronous = mTQueues.size()+1;
+                mSubThreads.clear();
 
                 // Set up threads
                 for (const auto& threadWorkerQueue : mThreadWorkerQueues)
@@ -451,6 +640,7 @@ namespace op
                     else // if (queueIn == 0 && queueOut == maxQueueIdSynchronous)
                         subThread = {std::make_shared<SubThreadNoQueue<TDatums, TWorker>>(tWorkers)};
                     thread->add(subThread);
+                    mSubThreads.emplace_back(tWorkers, subThread);
                 }
             }
             else
@@ -485,6 +675,9 @@ namespace op
             for (auto& thread : mThreads)
                 thread = std::make_shared<Thread<TDatums, TWorker>>();
             mThreads.emplace_back(std::make_shared<Thread<TDatums, TWorker>>(spIsRunning));
+            // Set thread affinities
+            for (auto threadId = 0u ; threadId < mThreads.size() && threadId < mThreadAffinities.size() ; threadId++)
+                mThreads[threadId]->setThreadAffinity(mThreadAffinities[threadId]);
         }
         catch (const std::exception& e)
         {
@@ -548,6 +741,41 @@ namespace op
         }
     }
 
+    template<typename TDatums, typename TWorker, typename TQueue>
+    bool ThreadManager<TDatums, TWorker, TQueue>::workInlineTWorkers(TDatums& tDatums)
+    {
+        try
+        {
+            // Stopped (e.g., by a TWorker)
+            if (!isRunning())
+                return false;
+            if (mInlineTWorkers.empty())
+                error("ThreadManager not started with startInline().", __LINE__, __FUNCTION__, __FILE__);
+            for (auto& tWorkers : mInlineTWorkers)
+            {
+                for (auto& tWorker : tWorkers)
+                {
+                    // TWorker stopped (e.g., GUI closed or error)
+                    if (!tWorker->checkAndWork(tDatums))
+                    {
+                        stop();
+                        return false;
+                    }
+                    // TDatums discarded
+                    if (tDatums == nullptr)
+                        return false;
+                }
+            }
+            checkWorkerErrors();
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
     COMPILE_TEMPLATE_DATUM(ThreadManager);
 }
 
@@ -0,0 +1,21 @@
+#ifndef OPENPOSE_UTILITIES_CPU_FEATURES_HPP
+#define OPENPOSE_UTILITIES_CPU_FEATURES_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/utilities/enumClasses.hpp>
+
+namespace op
+{
+    /**
+     * It returns the widest SIMD instruction set supported by both the CPU and the OS (e.g., AVX-512 requires the OS
+     * to save the AVX-512 registers). It is detected from CPUID (and logged) the first time it is called, and cached
+     * afterwards. All the SIMD kernels of the library select their implementation with it at runtime (through
+     * selectCpuKernel() in openpose_private/utilities/simd.hpp), so a single portable build runs with the widest
+     * vectors available on each host. The Wrapper calls it at startup.
+     */
+    OP_API CpuInstructionSet getCpuInstructionSet();
+
+    OP_API std::string cpuInstructionSetToString(const CpuInstructionSet cpuInstructionSet);
+}
+
+#endif // OPENPOSE_UTILITIES_CPU_FEATURES_HPP
@@ -28,6 +28,19 @@ namespace op
         NoOutput = 255,
     };
 
+    /**
+     * SIMD instruction sets used by the vectorized CPU kernels, from the most conservative to the widest one.
+     * See getCpuInstructionSet().
+     */
+    enum class CpuInstructionSet : unsigned char
+    {
+        Scalar, /**< No SIMD (or unknown architecture). */
+        Sse42,  /**< x86 SSE4.2 (including SSSE3 and SSE4.1). */
+        Avx2,   /**< x86 AVX2 + FMA. */
+        Avx512, /**< x86 AVX-512 (F + BW). */
+        Neon,   /**< ARM NEON. */
+    };
+
     enum class Extensions : unsigned char
     {
         Images, // jpg, png, ...
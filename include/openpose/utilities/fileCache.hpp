@@ -0,0 +1,56 @@
+#ifndef OPENPOSE_UTILITIES_FILE_CACHE_HPP
+#define OPENPOSE_UTILITIES_FILE_CACHE_HPP
+
+#include <openpose/core/common.hpp>
+
+namespace op
+{
+    /**
+     * Read-only view of the whole content of a file, used by the binary caches (e.g., NetCaffe weight cache or
+     * CameraParameterReader bundle). The file is memory-mapped if the OS supports it, so only the pages actually
+     * accessed are read from disk (otherwise, it is fully read into memory).
+     */
+    class OP_API MappedFile
+    {
+    public:
+        /**
+         * @param filePath Path of the file. The MappedFile is empty if it does not exist or cannot be read.
+         * @param sequentialAccess If true, the OS is advised that the whole file will be read right away, so it
+         * starts reading it ahead in the background.
+         */
+        explicit MappedFile(const std::string& filePath, const bool sequentialAccess = false);
+
+        virtual ~MappedFile();
+
+        bool empty() const;
+
+        const char* data() const;
+
+        std::size_t size() const;
+
+    private:
+        // PIMPL idiom
+        // http://www.cppsamples.com/common-tasks/pimpl.html
+        struct ImplMappedFile;
+        std::unique_ptr<ImplMappedFile> upImpl;
+
+        DELETE_COPY(MappedFile);
+    };
+
+    /**
+     * Checksum of a binary cache payload. It is a word-wise (64-bit) variant of FNV-1a, so it is several times faster
+     * than the classic byte-wise one (but their results are not compatible).
+     */
+    OP_API unsigned long long getFileCacheChecksum(const char* const data, const std::size_t size);
+
+    /**
+     * It writes the concatenation of all blocks into filePath. The data is written into a temporary file next to it
+     * (unique to the calling process and thread) which is then renamed, so other processes (or threads) reading or
+     * writing filePath never see a partially written file.
+     * @return False if the file could not be written (e.g., read-only folder).
+     */
+    OP_API bool writeFileAtomically(
+        const std::string& filePath, const std::vector<std::pair<const char*, std::size_t>>& blocks);
+}
+
+#endif // OPENPOSE_UTILITIES_FILE_CACHE_HPP
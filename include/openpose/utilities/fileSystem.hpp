@@ -11,6 +11,29 @@ namespace op
 
     OP_API bool existFile(const std::string& filePath);
 
+    /**
+     * This function returns the last modification time of a file or directory. The modification time of a directory
+     * changes whenever a file is added to, removed from, or renamed in it.
+     * @param path std::string with the file or directory path.
+     * @return Nanoseconds since the epoch (seconds precision on Windows), or -1 if the path does not exist.
+     */
+    OP_API long long getLastModificationTime(const std::string& path);
+
+    /**
+     * This function returns the absolute path of an existing file or directory (with symbolic links resolved on Unix
+     * and Mac).
+     * @param path std::string with the relative or absolute path.
+     * @return std::string with the absolute path, or an empty string if the path does not exist.
+     */
+    OP_API std::string getAbsolutePath(const std::string& path);
+
+    /**
+     * This function returns the size of a file.
+     * @param filePath std::string with the file path.
+     * @return Size in bytes, or -1 if the file does not exist.
+     */
+    OP_API long long getFileSize(const std::string& filePath);
+
     /**
      * This function makes sure that the directoryPathString is properly formatted. I.e., it
      * changes all '\' by '/', and it makes sure that the string finishes with '/'.
@@ -58,12 +81,17 @@ namespace op
     /**
      * This function extracts all the files in a directory path with the desired
      * extensions. If no extensions is specified, then all the file names are returned.
+     * The files are sorted in natural order (see sortNatural()). Hidden files (starting with '.') are ignored on
+     * Unix and Mac.
      * @param directoryPath std::string with the directory path.
      * @param extensions std::vector<std::string> with the extensions of the desired files.
+     * @param errorIfNoFiles Whether to report an error if the directory has no files (rather than returning an
+     * empty std::vector).
      * @return std::vector<std::string> with the existing file names.
      */
     OP_API std::vector<std::string> getFilesOnDirectory(
-        const std::string& directoryPath, const std::vector<std::string>& extensions = {});
+        const std::string& directoryPath, const std::vector<std::string>& extensions = {},
+        const bool errorIfNoFiles = true);
 
     /**
      * Analogous to getFilesOnDirectory(const std::string& directoryPath, const std::vector<std::string>& extensions)
@@ -80,10 +108,37 @@ namespace op
      * group of extensions (e.g., Extensions::Images).
      * @param directoryPath std::string with the directory path.
      * @param extensions Extensions with the kind of extensions desired (e.g., Extensions:Images).
+     * @param errorIfNoFiles Whether to report an error if the directory has no files (rather than returning an
+     * empty std::vector).
      * @return std::vector<std::string> with the existing file names.
      */
     OP_API std::vector<std::string> getFilesOnDirectory(
-        const std::string& directoryPath, const Extensions extensions);
+        const std::string& directoryPath, const Extensions extensions, const bool errorIfNoFiles = true);
+
+    /**
+     * This function returns the (lowercase) extension names of a group of extensions (e.g., Extensions::Images),
+     * as used by getFilesOnDirectory().
+     * @param extensions Extensions with the kind of extensions desired (e.g., Extensions:Images).
+     * @return std::vector<std::string> with the extension names (without dot).
+     */
+    OP_API std::vector<std::string> getExtensionNames(const Extensions extensions);
+
+    /**
+     * This function returns a key such that comparing the keys of 2 strings alphabetically (e.g., with
+     * std::string::operator<) is equivalent to comparing the strings in natural order. I.e., case insensitive and
+     * with the numbers compared by value (e.g., "image_2.jpg" < "IMAGE_10.jpg"), and with digits before any other
+     * character.
+     * @param string std::string to be sorted.
+     * @return std::string with the natural sort key.
+     */
+    OP_API std::string getNaturalSortKey(const std::string& string);
+
+    /**
+     * This function sorts strings in natural order (see getNaturalSortKey()), as done by getFilesOnDirectory(). The
+     * key of each string is only computed once, so it scales to millions of strings.
+     * @param strings std::vector<std::string> to be sorted.
+     */
+    OP_API void sortNatural(std::vector<std::string>& strings);
 
     OP_API std::string removeSpecialsCharacters(const std::string& stringToVariate);
 
@@ -3,16 +3,20 @@
 
 // utilities module
 #include <openpose/utilities/check.hpp>
+#include <openpose/utilities/cpuFeatures.hpp>
 #include <openpose/utilities/enumClasses.hpp>
 #include <openpose/utilities/errorAndLog.hpp>
 #include <openpose/utilities/fastMath.hpp>
+#include <openpose/utilities/fileCache.hpp>
 #include <openpose/utilities/fileSystem.hpp>
 #include <openpose/utilities/flagsToOpenPose.hpp>
 #include <openpose/utilities/keypoint.hpp>
 #include <openpose/utilities/openCv.hpp>
+#include <openpose/utilities/peopleSpatialIndex.hpp>
 #include <openpose/utilities/pointerContainer.hpp>
 #include <openpose/utilities/profiler.hpp>
 #include <openpose/utilities/standard.hpp>
 #include <openpose/utilities/string.hpp>
+#include <openpose/utilities/threadAffinity.hpp>
 
 #endif // OPENPOSE_UTILITIES_HEADERS_HPP
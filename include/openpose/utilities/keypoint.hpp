@@ -2,6 +2,8 @@
 #define OPENPOSE_UTILITIES_KEYPOINT_HPP
 
 #include <openpose/core/common.hpp>
+#include <openpose/core/planarKeypoints.hpp>
+#include <openpose/utilities/peopleSpatialIndex.hpp>
 
 namespace op
 {
@@ -77,6 +79,51 @@ namespace op
     template <typename T>
     float getKeypointsRoi(
         const Rectangle<T>& rectangleA, const Rectangle<T>& rectangleB);
+
+    /**
+     * Analog to getKeypointsRoi(keypointsA, personA, keypointsB, personB, threshold), but using the rectangles
+     * cached in PeopleSpatialIndex (so they are not recomputed for each pair of people). Use
+     * PeopleSpatialIndex::getOverlappingPeople() or getOverlappingPairs() to only compare the people with ROI > 0.
+     */
+    template <typename T>
+    float getKeypointsRoi(
+        const PeopleSpatialIndex<T>& peopleA, const int personA, const PeopleSpatialIndex<T>& peopleB,
+        const int personB);
+
+    /**
+     * Analog to getBiggestPerson(keypoints, threshold), but using the rectangles cached in PeopleSpatialIndex.
+     */
+    template <typename T>
+    int getBiggestPerson(const PeopleSpatialIndex<T>& people);
+
+    // PlanarKeypoints (structure-of-arrays) overloads. Equivalent to their Array<T> analogs, but reading contiguous
+    // x, y and score planes with branchless loops, so they can be auto-vectorized.
+    template <typename T>
+    void scaleKeypoints2d(
+        PlanarKeypoints<T>& keypoints, const T scaleX, const T scaleY, const T offsetX = T(0),
+        const T offsetY = T(0));
+
+    template <typename T>
+    Rectangle<T> getKeypointsRectangle(
+        const PlanarKeypoints<T>& keypoints, const int person, const T threshold, const int firstIndex = 0,
+        const int lastIndex = -1);
+
+    template <typename T>
+    T getAverageScore(const PlanarKeypoints<T>& keypoints, const int person);
+
+    template <typename T>
+    T getKeypointsArea(const PlanarKeypoints<T>& keypoints, const int person, const T threshold);
+
+    template <typename T>
+    int getBiggestPerson(const PlanarKeypoints<T>& keypoints, const T threshold);
+
+    template <typename T>
+    int getNonZeroKeypoints(const PlanarKeypoints<T>& keypoints, const int person, const T threshold);
+
+    template <typename T>
+    T getDistanceAverage(
+        const PlanarKeypoints<T>& keypointsA, const int personA, const PlanarKeypoints<T>& keypointsB,
+        const int personB, const T threshold);
 }
 
 #endif // OPENPOSE_UTILITIES_KEYPOINT_HPP
@@ -0,0 +1,81 @@
+#ifndef OPENPOSE_UTILITIES_PEOPLE_SPATIAL_INDEX_HPP
+#define OPENPOSE_UTILITIES_PEOPLE_SPATIAL_INDEX_HPP
+
+#include <openpose/core/common.hpp>
+
+namespace op
+{
+    /**
+     * PeopleSpatialIndex<T>: Per-frame cache of the bounding box of each person, plus a uniform grid over them.
+     * The rectangles are computed once (rather than calling getKeypointsRectangle for each comparison), and the grid
+     * (with cells as big as the average person) lets overlap queries only visit the people in the nearby cells. This
+     * way, finding the overlapping pairs of a frame is close to linear in the number of people rather than quadratic.
+     * Empty rectangles (e.g., people without keypoints above the threshold) never overlap with anything.
+     */
+    template<typename T>
+    class OP_API PeopleSpatialIndex
+    {
+    public:
+        /**
+         * Constructor from the bounding boxes of each person (e.g., faces or hands).
+         */
+        explicit PeopleSpatialIndex(const std::vector<Rectangle<T>>& rectangles = {});
+
+        /**
+         * Constructor from a keypoint Array<T>. The rectangle of each person is equivalent to
+         * getKeypointsRectangle(keypoints, person, threshold, firstIndex, lastIndex).
+         */
+        PeopleSpatialIndex(
+            const Array<T>& keypoints, const T threshold, const int firstIndex = 0, const int lastIndex = -1);
+
+        /**
+         * It re-creates the index from new rectangles.
+         */
+        void reset(const std::vector<Rectangle<T>>& rectangles);
+
+        inline int getNumberPeople() const
+        {
+            return (int)mRectangles.size();
+        }
+
+        inline const Rectangle<T>& getRectangle(const int person) const
+        {
+            return mRectangles[person];
+        }
+
+        inline const std::vector<Rectangle<T>>& getRectangles() const
+        {
+            return mRectangles;
+        }
+
+        /**
+         * It returns the (sorted) indexes of the people whose rectangle overlaps with rectangle.
+         */
+        std::vector<int> getOverlappingPeople(const Rectangle<T>& rectangle) const;
+
+        /**
+         * Similar to getOverlappingPeople(const Rectangle<T>& rectangle), but for the rectangle of a person of this
+         * index (excluding the person itself).
+         */
+        std::vector<int> getOverlappingPeople(const int person) const;
+
+        /**
+         * It returns all the pairs (personA, personB) of overlapping people, with personA < personB.
+         */
+        std::vector<std::pair<int, int>> getOverlappingPairs() const;
+
+    private:
+        std::vector<Rectangle<T>> mRectangles;
+        // Grid
+        Point<T> mOrigin;
+        T mCellSize;
+        Point<int> mGridSize;
+        // People in each cell (compressed): cell c contains mCellPeople[mCellStarts[c] : mCellStarts[c+1]]
+        std::vector<int> mCellStarts;
+        std::vector<int> mCellPeople;
+
+        Rectangle<int> getCellRange(const Rectangle<T>& rectangle) const;
+    };
+}
+
+#endif // OPENPOSE_UTILITIES_PEOPLE_SPATIAL_INDEX_HPP
@@ -0,0 +1,69 @@
+#ifndef OPENPOSE_UTILITIES_THREAD_AFFINITY_HPP
+#define OPENPOSE_UTILITIES_THREAD_AFFINITY_HPP
+
+#include <openpose/core/common.hpp>
+
+namespace op
+{
+    /**
+     * ThreadAffinity: CPU and memory placement of a single pipeline thread (i.e., of a thread id as assigned by the
+     * WrapperT).
+     */
+    struct OP_API ThreadAffinity
+    {
+        /**
+         * CPU cores where the thread is allowed to run. Empty (default) means no pinning.
+         */
+        std::vector<int> cores;
+
+        /**
+         * NUMA node where the memory allocated by the thread should be placed. -1 (default) means no binding.
+         * Memory is allocated by each Worker in initializationOnThread(), which already runs on the pinned thread.
+         */
+        int numaNode;
+
+        /**
+         * Number of intra-operation threads (OpenMP/BLAS) that the inference engine can use from this thread when
+         * running on CPU. 0 (default) keeps the library default.
+         */
+        int intraOpThreads;
+
+        ThreadAffinity(const std::vector<int>& cores = {}, const int numaNode = -1, const int intraOpThreads = 0);
+
+        bool empty() const;
+    };
+
+    /**
+     * It applies the ThreadAffinity to the calling thread. Unsupported options in the current OS are ignored with a
+     * warning message.
+     */
+    OP_API void applyThreadAffinity(const ThreadAffinity& threadAffinity);
+
+    /**
+     * It returns the number of logical CPU cores.
+     */
+    OP_API int getNumberCpuCores();
+
+    /**
+     * It returns the number of NUMA nodes. It returns 1 if the OS does not expose them.
+     */
+    OP_API int getNumberNumaNodes();
+
+    /**
+     * It returns the logical CPU cores of the desired NUMA node. If the OS does not expose them, it returns all the
+     * cores for numaNode 0.
+     */
+    OP_API std::vector<int> getNumaNodeCores(const int numaNode);
+
+    /**
+     * It parses a core list string in the Linux `cpulist` format, e.g., "0-3,8,10-11".
+     */
+    OP_API std::vector<int> coreListToVector(const std::string& coreList);
+
+    /**
+     * It returns the NUMA node that contains most of the cores of the list, or -1 if unknown.
+     */
+    OP_API int getNumaNodeFromCores(const std::vector<int>& cores);
+}
+
+#endif // OPENPOSE_UTILITIES_THREAD_AFFINITY_HPP
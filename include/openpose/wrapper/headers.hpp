@@ -5,6 +5,7 @@
 #include <openpose/wrapper/enumClasses.hpp>
 #include <openpose/wrapper/wrapper.hpp>
 #include <openpose/wrapper/wrapperAuxiliary.hpp>
+#include <openpose/wrapper/wrapperRuntimeHandles.hpp>
 #include <openpose/wrapper/wrapperStructFace.hpp>
 #include <openpose/wrapper/wrapperStructGui.hpp>
 #include <openpose/wrapper/wrapperStructHand.hpp>
@@ -1,7 +1,9 @@
 #ifndef OPENPOSE_WRAPPER_WRAPPER_HPP
 #define OPENPOSE_WRAPPER_WRAPPER_HPP
 
+#include <mutex>
 #include <openpose/core/common.hpp>
+#include <openpose/producer/datumPool.hpp>
 #include <openpose/thread/headers.hpp>
 #include <openpose/wrapper/enumClasses.hpp>
 #include <openpose/wrapper/wrapperStructExtra.hpp>
@@ -11,6 +13,7 @@
 #include <openpose/wrapper/wrapperStructInput.hpp>
 #include <openpose/wrapper/wrapperStructOutput.hpp>
 #include <openpose/wrapper/wrapperStructPose.hpp>
+#include <openpose/wrapper/wrapperRuntimeHandles.hpp>
 
 namespace op
 {
@@ -102,6 +105,42 @@ namespace op
          */
         void configure(const WrapperStructGui& wrapperStructGui);
 
+        /**
+         * It modifies the pose parameters of a running WrapperT without restarting it.
+         * The runtime-modifiable parameters (netInputSize, scalesNumber, scaleGap, numberPeopleMax,
+         * blendOriginalFrame, alphaKeypoint, alphaHeatMap and defaultPartToRender) are applied by each Worker at its
+         * next frame, and the networks are kept loaded.
+         * If any other parameter is modified, only the Workers of the GPU threads (body, face and hand networks and
+         * their GPU rendering) are re-created if no other Worker depends on it: each GPU thread loads its new networks
+         * and switches to them between 2 frames, while the rest of the threads (e.g., the producer) keep running. The
+         * networks whose own parameters did not change (e.g., the body one when enabling hand) are kept loaded.
+         * That is not possible if the GUI is enabled, if any keypoint is rendered on CPU, or if poseModel, outputSize,
+         * keypointScaleMode, netInputSizeDynamicBehavior, heatMapTypes, heatMapScaleMode, fpsMax or the number of
+         * GPUs are modified. In those cases, the WrapperT must be re-configured: if it was started with start(), it
+         * is automatically restarted (networks are re-loaded, see WrapperStructPose::fastStartup to minimize that
+         * time); if it was started with exec(), the new parameters will be used in the next exec() call; and if it is
+         * used inline (i.e., with emplaceAndPop(const Matrix&) or process()), it is re-configured on the next call.
+         * A restart cannot be done from one of the OpenPose threads (e.g., from a user Worker), as it would wait for
+         * itself to finish. In that case, the new parameters are ignored (call reconfigure() from another thread).
+         * If the WrapperT is not running, it is equivalent to configure().
+         * It is thread-safe: concurrent reconfigure() calls are applied one after the other.
+         * @return Whether the new parameters were applied without restarting the WrapperT.
+         */
+        bool reconfigure(const WrapperStructPose& wrapperStructPose);
+
+        /**
+         * Analogous to reconfigure(WrapperStructPose) but applied to face (WrapperStructFace).
+         * Only `enable` can be modified at runtime, and only if face was enabled when the WrapperT was started (so its
+         * networks are loaded). I.e., configure face enabled and reconfigure it as disabled to be able to toggle it
+         * without restarts.
+         */
+        bool reconfigure(const WrapperStructFace& wrapperStructFace);
+
+        /**
+         * Analogous to reconfigure(WrapperStructFace) but applied to hand (WrapperStructHand).
+         */
+        bool reconfigure(const WrapperStructHand& wrapperStructHand);
+
         /**
          * Function to start multi-threading.
          * Similar to start(), but exec() blocks the thread that calls the function (it saves 1 thread). Use exec()
@@ -226,6 +265,28 @@ namespace op
          */
         TDatumsSP emplaceAndPop(const Matrix& matrix);
 
+        /**
+         * Inline alternative to start() + emplaceAndPop(), i.e., it runs the whole OpenPose pipeline sequentially on
+         * the calling thread, with no additional threads nor queues (e.g., for embedded or batch use, where the
+         * thread synchronization overhead is not worth it).
+         * The first call initializes the WrapperT (networks are loaded on the calling thread), and it must always be
+         * called from that same thread. Only valid if ThreadManagerMode::Asynchronous and the WrapperT was not
+         * started with start() or exec(). Multi-threading is automatically disabled.
+         * @param tDatums TDatumsSP element to be processed. It is edited in-place.
+         * @return Boolean specifying whether the tDatums could be processed.
+         */
+        bool process(TDatumsSP& tDatums);
+
+        /**
+         * Similar to process(TDatumsSP& tDatums), but it takes a Matrix as input.
+         * The returned TDatumsSP and its TDatum are re-used by the next call if the previous result was already
+         * released (so no allocations are required for each frame).
+         * @param matrix Matrix with the image to be processed.
+         * @return TDatumsSP element where the processed information will be placed (nullptr if the frame could not
+         * be processed).
+         */
+        TDatumsSP process(const Matrix& matrix);
+
     private:
         const ThreadManagerMode mThreadManagerMode;
         ThreadManager<TDatumsSP> mThreadManager;
@@ -241,6 +302,21 @@ namespace op
         // User configurable workers
         std::array<bool, int(WorkerType::Size)> mUserWsOnNewThread;
         std::array<std::vector<TWorker>, int(WorkerType::Size)> mUserWs;
+        // Runtime reconfiguration
+        std::mutex mReconfigureMutex;
+        WrapperRuntimeHandles mWrapperRuntimeHandles;
+        std::vector<std::vector<TWorker>> mPoseExtractorsWs;
+        bool mStartedAsynchronously;
+        // Inline processing
+        bool mStartedInline;
+        DatumPool<TDatum> mDatumPool;
+        TDatumsSP spInlineDatums;
+
+        void startInline();
+
+        bool reconfigure(
+            const WrapperStructPose& wrapperStructPose, const WrapperStructFace& wrapperStructFace,
+            const WrapperStructHand& wrapperStructHand);
 
         DELETE_COPY(WrapperT);
     };
@@ -261,7 +337,9 @@ namespace op
     WrapperT<TDatum, TDatums, TDatumsSP, TWorker>::WrapperT(const ThreadManagerMode threadManagerMode) :
         mThreadManagerMode{threadManagerMode},
         mThreadManager{threadManagerMode},
-        mMultiThreadEnabled{true}
+        mMultiThreadEnabled{true},
+        mStartedAsynchronously{false},
+        mStartedInline{false}
     {
     }
 
@@ -273,6 +351,9 @@ namespace op
             stop();
             // Reset mThreadManager
             mThreadManager.reset();
+            spInlineDatums.reset();
+            mWrapperRuntimeHandles.clear();
+            mPoseExtractorsWs.clear();
             // Reset user workers
             for (auto& userW : mUserWs)
                 userW.clear();
@@ -407,15 +488,89 @@ namespace op
         }
     }
 
+    template<typename TDatum, typename TDatums, typename TDatumsSP, typename TWorker>
+    bool WrapperT<TDatum, TDatums, TDatumsSP, TWorker>::reconfigure(const WrapperStructPose& wrapperStructPose)
+    {
+        try
+        {
+            // Concurrent reconfigure() calls (e.g., from different threads) are applied one after the other
+            const std::lock_guard<std::mutex> lock{mReconfigureMutex};
+            // Not running or runtime-modifiable parameters
+            if (!isRunning() || wrapperReconfigureOnRuntime(
+                    mWrapperRuntimeHandles, mWrapperStructPose, wrapperStructPose, mWrapperStructExtra))
+            {
+                mWrapperStructPose = wrapperStructPose;
+                return true;
+            }
+            // Otherwise, re-create the GPU threads Workers or restart
+            return reconfigure(wrapperStructPose, mWrapperStructFace, mWrapperStructHand);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    template<typename TDatum, typename TDatums, typename TDatumsSP, typename TWorker>
+    bool WrapperT<TDatum, TDatums, TDatumsSP, TWorker>::reconfigure(const WrapperStructFace& wrapperStructFace)
+    {
+        try
+        {
+            // Concurrent reconfigure() calls (e.g., from different threads) are applied one after the other
+            const std::lock_guard<std::mutex> lock{mReconfigureMutex};
+            // Not running or runtime-modifiable parameters
+            if (!isRunning() || wrapperReconfigureOnRuntime(
+                    mWrapperRuntimeHandles, mWrapperStructFace, wrapperStructFace))
+            {
+                mWrapperStructFace = wrapperStructFace;
+                return true;
+            }
+            // Otherwise, re-create the GPU threads Workers or restart
+            return reconfigure(mWrapperStructPose, wrapperStructFace, mWrapperStructHand);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    template<typename TDatum, typename TDatums, typename TDatumsSP, typename TWorker>
+    bool WrapperT<TDatum, TDatums, TDatumsSP, TWorker>::reconfigure(const WrapperStructHand& wrapperStructHand)
+    {
+        try
+        {
+            // Concurrent reconfigure() calls (e.g., from different threads) are applied one after the other
+            const std::lock_guard<std::mutex> lock{mReconfigureMutex};
+            // Not running or runtime-modifiable parameters
+            if (!isRunning() || wrapperReconfigureOnRuntime(
+                    mWrapperRuntimeHandles, mWrapperStructHand, wrapperStructHand))
+            {
+                mWrapperStructHand = wrapperStructHand;
+                return true;
+            }
+            // Otherwise, re-create the GPU threads Workers or restart
+            return reconfigure(mWrapperStructPose, mWrapperStructFace, wrapperStructHand);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
     template<typename TDatum, typename TDatums, typename TDatumsSP, typename TWorker>
     void WrapperT<TDatum, TDatums, TDatumsSP, TWorker>::exec()
     {
         try
         {
+            mStartedAsynchronously = false;
+            mStartedInline = false;
             configureThreadManager<TDatum, TDatums, TDatumsSP, TWorker>(
                 mThreadManager, mMultiThreadEnabled, mThreadManagerMode, mWrapperStructPose, mWrapperStructFace,
                 mWrapperStructHand, mWrapperStructExtra, mWrapperStructInput, mWrapperStructOutput, mWrapperStructGui,
-                mUserWs, mUserWsOnNewThread);
+                mUserWs, mUserWsOnNewThread, &mWrapperRuntimeHandles, &mPoseExtractorsWs);
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             mThreadManager.exec();
         }
@@ -430,10 +585,12 @@ namespace op
     {
         try
         {
+            mStartedAsynchronously = true;
+            mStartedInline = false;
             configureThreadManager<TDatum, TDatums, TDatumsSP, TWorker>(
                 mThreadManager, mMultiThreadEnabled, mThreadManagerMode, mWrapperStructPose, mWrapperStructFace,
                 mWrapperStructHand, mWrapperStructExtra, mWrapperStructInput, mWrapperStructOutput, mWrapperStructGui,
-                mUserWs, mUserWsOnNewThread);
+                mUserWs, mUserWsOnNewThread, &mWrapperRuntimeHandles, &mPoseExtractorsWs);
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             mThreadManager.start();
         }
@@ -449,6 +606,7 @@ namespace op
         try
         {
             mThreadManager.stop();
+            mStartedInline = false;
         }
         catch (const std::exception& e)
         {
@@ -710,6 +868,161 @@ namespace op
         }
     }
 
+    template<typename TDatum, typename TDatums, typename TDatumsSP, typename TWorker>
+    bool WrapperT<TDatum, TDatums, TDatumsSP, TWorker>::process(TDatumsSP& tDatums)
+    {
+        try
+        {
+            // Sanity checks
+            if (mThreadManagerMode != ThreadManagerMode::Asynchronous)
+                error("process() is only available for ThreadManagerMode::Asynchronous.",
+                      __LINE__, __FUNCTION__, __FILE__);
+            if (tDatums == nullptr || tDatums->empty())
+                error("tDatums cannot be empty.", __LINE__, __FUNCTION__, __FILE__);
+            // Initialize on first call (or after stop() or a reconfiguration)
+            if (!mStartedInline)
+            {
+                if (isRunning())
+                    error("process() cannot be called if the WrapperT was started with start() or exec().",
+                          __LINE__, __FUNCTION__, __FILE__);
+                startInline();
+            }
+            // It returns false if any Worker stopped it (e.g., GUI closed)
+            return mThreadManager.workInline(tDatums);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    template<typename TDatum, typename TDatums, typename TDatumsSP, typename TWorker>
+    TDatumsSP WrapperT<TDatum, TDatums, TDatumsSP, TWorker>::process(const Matrix& matrix)
+    {
+        try
+        {
+            // Re-use the previous TDatumsSP if the user already released it. Its TDatum is returned to mDatumPool
+            // before getting a new one, so the same TDatum is recycled
+            if (spInlineDatums == nullptr || spInlineDatums.use_count() > 1)
+                spInlineDatums = std::make_shared<TDatums>();
+            spInlineDatums->clear();
+            spInlineDatums->emplace_back(mDatumPool.get());
+            // Fill datum
+            spInlineDatums->at(0)->cvInputData = matrix;
+            // Process
+            auto tDatums = spInlineDatums;
+            if (!process(tDatums))
+                return TDatumsSP{};
+            // Return result
+            return tDatums;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return TDatumsSP{};
+        }
+    }
+
+    template<typename TDatum, typename TDatums, typename TDatumsSP, typename TWorker>
+    void WrapperT<TDatum, TDatums, TDatumsSP, TWorker>::startInline()
+    {
+        try
+        {
+            mStartedAsynchronously = false;
+            mStartedInline = true;
+            // Inline processing = single thread
+            const auto multiThreadEnabled = false;
+            configureThreadManager<TDatum, TDatums, TDatumsSP, TWorker>(
+                mThreadManager, multiThreadEnabled, mThreadManagerMode, mWrapperStructPose, mWrapperStructFace,
+                mWrapperStructHand, mWrapperStructExtra, mWrapperStructInput, mWrapperStructOutput, mWrapperStructGui,
+                mUserWs, mUserWsOnNewThread, &mWrapperRuntimeHandles, &mPoseExtractorsWs);
+            opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            mThreadManager.startInline();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename TDatum, typename TDatums, typename TDatumsSP, typename TWorker>
+    bool WrapperT<TDatum, TDatums, TDatumsSP, TWorker>::reconfigure(
+        const WrapperStructPose& wrapperStructPose, const WrapperStructFace& wrapperStructFace,
+        const WrapperStructHand& wrapperStructHand)
+    {
+        try
+        {
+            // Re-create only the Workers of the GPU threads (not possible inline, as there are no threads)
+            const auto wrapperPoseLayout = getWrapperPoseLayout(
+                wrapperStructPose, wrapperStructFace, wrapperStructHand);
+            if (!mStartedInline && !mPoseExtractorsWs.empty()
+                && wrapperReconfigurePoseExtractors(
+                    mWrapperRuntimeHandles,
+                    getWrapperPoseLayout(mWrapperStructPose, mWrapperStructFace, mWrapperStructHand),
+                    wrapperPoseLayout, mWrapperStructPose, wrapperStructPose, mWrapperStructGui))
+            {
+                opLog("The new parameters cannot be applied on runtime. Re-creating the body, face and hand"
+                      " Workers (only the modified networks are re-loaded)...", Priority::High);
+                // Networks whose parameters did not change are re-used (i.e., not re-loaded)
+                const auto wrapperPoseExtractors = createPoseExtractorsWs<TDatumsSP, TWorker>(
+                    wrapperStructPose, wrapperStructFace, wrapperStructHand, mWrapperStructExtra, wrapperPoseLayout,
+                    getReusablePoseExtractorNets(mWrapperRuntimeHandles, mWrapperStructPose, wrapperStructPose),
+                    getReusableFaceExtractorNets(
+                        mWrapperRuntimeHandles, mWrapperStructPose, mWrapperStructFace, wrapperStructPose,
+                        wrapperStructFace),
+                    getReusableHandExtractorNets(
+                        mWrapperRuntimeHandles, mWrapperStructPose, mWrapperStructHand, wrapperStructPose,
+                        wrapperStructHand));
+                // Runtime handles first, so the previous networks are released by their own threads
+                wrapperPoseExtractors.setRuntimeHandles(mWrapperRuntimeHandles);
+                for (auto i = 0u ; i < mPoseExtractorsWs.size() ; i++)
+                {
+                    mThreadManager.setTWorkers(mPoseExtractorsWs[i], wrapperPoseExtractors.poseExtractorsWs.at(i));
+                    mPoseExtractorsWs[i] = wrapperPoseExtractors.poseExtractorsWs.at(i);
+                }
+                mWrapperStructPose = wrapperStructPose;
+                mWrapperStructFace = wrapperStructFace;
+                mWrapperStructHand = wrapperStructHand;
+                return true;
+            }
+            // Restarting from one of its threads would wait for itself to finish (exec() is not restarted)
+            if ((mStartedInline || mStartedAsynchronously) && mThreadManager.isWorkerThread())
+            {
+                opLog("The new parameters cannot be applied on runtime, and OpenPose cannot be restarted from one of"
+                      " its own threads (e.g., a user Worker). They have been ignored, call reconfigure() from"
+                      " another thread instead.", Priority::High);
+                return false;
+            }
+            mWrapperStructPose = wrapperStructPose;
+            mWrapperStructFace = wrapperStructFace;
+            mWrapperStructHand = wrapperStructHand;
+            // Inline --> stop() makes the next process() call re-configure it
+            if (mStartedInline)
+            {
+                opLog("The new parameters cannot be applied on runtime. They will be used from the next process()"
+                      " call.", Priority::High);
+                stop();
+            }
+            // exec() blocks its calling thread, so it cannot be restarted from here
+            else if (!mStartedAsynchronously)
+                opLog("The new parameters cannot be applied on runtime. They will be used after exec() is called"
+                      " again.", Priority::High);
+            else
+            {
+                opLog("The new parameters cannot be applied on runtime. Restarting OpenPose...", Priority::High);
+                stop();
+                start();
+            }
+            return false;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
     extern template class WrapperT<BASE_DATUM>;
 }
 
@@ -1,6 +1,12 @@
 #ifndef OPENPOSE_WRAPPER_WRAPPER_AUXILIARY_HPP
 #define OPENPOSE_WRAPPER_WRAPPER_AUXILIARY_HPP
 
+#include <openpose/core/keepTopNPeople.hpp>
+#include <openpose/face/faceExtractorNet.hpp>
+#include <openpose/hand/handExtractorNet.hpp>
+#include <openpose/pose/poseCpuRenderer.hpp>
+#include <openpose/pose/poseExtractorNet.hpp>
+#include <openpose/pose/poseGpuRenderer.hpp>
 #include <openpose/thread/headers.hpp>
 #include <openpose/wrapper/enumClasses.hpp>
 #include <openpose/wrapper/wrapperStructExtra.hpp>
@@ -10,6 +16,7 @@
 #include <openpose/wrapper/wrapperStructInput.hpp>
 #include <openpose/wrapper/wrapperStructOutput.hpp>
 #include <openpose/wrapper/wrapperStructPose.hpp>
+#include <openpose/wrapper/wrapperRuntimeHandles.hpp>
 
 namespace op
 {
@@ -44,11 +51,166 @@ namespace op
      */
     OP_API void threadIdPP(unsigned long long& threadId, const bool multiThreadEnabled);
 
+    /**
+     * It returns the ThreadAffinity of each thread id (private internal function), following
+     * WrapperStructExtra::threadAffinity and WrapperStructExtra::intraOpThreads.
+     * @param numberThreads Total number of threads of the ThreadManager.
+     * @param poseThreadIds Thread ids running the pose (and face and hand) extraction Workers.
+     */
+    OP_API std::vector<ThreadAffinity> getThreadAffinities(
+        const WrapperStructExtra& wrapperStructExtra, const unsigned long long numberThreads,
+        const std::vector<unsigned long long>& poseThreadIds);
+
+    /**
+     * Rendering and GPU thread properties derived from the WrapperStructs (private internal struct).
+     */
+    struct OP_API WrapperPoseLayout
+    {
+        RenderMode renderModePose;
+        RenderMode renderModeFace;
+        RenderMode renderModeHand;
+        bool renderOutput;
+        bool renderOutputGpu;
+        bool renderFace;
+        bool renderHand;
+        bool renderHandGpu;
+        /**
+         * Whether any keypoint is rendered on CPU (those renderers run after the GPU threads).
+         */
+        bool renderCpu;
+        /**
+         * Number of GPU threads (0 if no pose extraction) and GPU of the first one.
+         */
+        int numberGpuThreads;
+        int gpuNumberStart;
+        /**
+         * Whether the input and output images are resized on CPU (before the GPU threads) rather than on GPU.
+         */
+        bool resizeInputOnCpu;
+        bool addCvMatToOpOutput;
+        bool addCvMatToOpOutputInCpu;
+    };
+
+    /**
+     * It returns the WrapperPoseLayout of the given WrapperStructs (private internal function). Common code for
+     * configureThreadManager and WrapperT::reconfigure.
+     */
+    OP_API WrapperPoseLayout getWrapperPoseLayout(
+        const WrapperStructPose& wrapperStructPose, const WrapperStructFace& wrapperStructFace,
+        const WrapperStructHand& wrapperStructHand);
+
+    /**
+     * It applies the differences between the running and the new WrapperStructPose to the running Workers (private
+     * internal function). Each Worker applies them at its next frame.
+     * Runtime-modifiable parameters: netInputSize, scalesNumber, scaleGap, numberPeopleMax, blendOriginalFrame,
+     * alphaKeypoint, alphaHeatMap and defaultPartToRender.
+     * @return Whether all the differences could be applied at runtime. If false (i.e., any other parameter was
+     * modified), nothing is applied and the ThreadManager must be re-configured.
+     */
+    OP_API bool wrapperReconfigureOnRuntime(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperStructPose& wrapperStructPoseRunning,
+        const WrapperStructPose& wrapperStructPose, const WrapperStructExtra& wrapperStructExtra);
+
+    /**
+     * Analogous to wrapperReconfigureOnRuntime(WrapperStructPose) but applied to face (WrapperStructFace).
+     * Face can only be enabled or disabled at runtime if it was enabled when the ThreadManager was configured (so its
+     * networks are already loaded).
+     */
+    OP_API bool wrapperReconfigureOnRuntime(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperStructFace& wrapperStructFaceRunning,
+        const WrapperStructFace& wrapperStructFace);
+
+    /**
+     * Analogous to wrapperReconfigureOnRuntime(WrapperStructFace) but applied to hand (WrapperStructHand).
+     */
+    OP_API bool wrapperReconfigureOnRuntime(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperStructHand& wrapperStructHandRunning,
+        const WrapperStructHand& wrapperStructHand);
+
+    /**
+     * Whether the differences between the running and the new WrapperStructs only affect the TWorkers of the GPU
+     * threads (body, face and hand keypoint detection and their GPU rendering), so they can be re-created with
+     * createPoseExtractorsWs without restarting any other TWorker (private internal function). It also applies the
+     * runtime-modifiable parameters of the TWorkers that are kept (i.e., the net input resolution and scales).
+     * It is false if the GUI is enabled, as it shares the networks and renderers with the GPU threads.
+     */
+    OP_API bool wrapperReconfigurePoseExtractors(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperPoseLayout& wrapperPoseLayoutRunning,
+        const WrapperPoseLayout& wrapperPoseLayout, const WrapperStructPose& wrapperStructPoseRunning,
+        const WrapperStructPose& wrapperStructPose, const WrapperStructGui& wrapperStructGui);
+
+    /**
+     * It returns the running body keypoint extractors of wrapperRuntimeHandles if the new WrapperStructPose did not
+     * modify any of the parameters they were created with (so createPoseExtractorsWs re-uses them and their loaded
+     * networks), or an empty std::vector otherwise (private internal function).
+     */
+    OP_API std::vector<std::shared_ptr<PoseExtractorNet>> getReusablePoseExtractorNets(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperStructPose& wrapperStructPoseRunning,
+        const WrapperStructPose& wrapperStructPose);
+
+    /**
+     * Analogous to getReusablePoseExtractorNets but applied to face (WrapperStructFace). They are not re-used if face
+     * is not enabled in the new WrapperStructFace.
+     */
+    OP_API std::vector<std::shared_ptr<FaceExtractorNet>> getReusableFaceExtractorNets(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperStructPose& wrapperStructPoseRunning,
+        const WrapperStructFace& wrapperStructFaceRunning, const WrapperStructPose& wrapperStructPose,
+        const WrapperStructFace& wrapperStructFace);
+
+    /**
+     * Analogous to getReusableFaceExtractorNets but applied to hand (WrapperStructHand).
+     */
+    OP_API std::vector<std::shared_ptr<HandExtractorNet>> getReusableHandExtractorNets(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperStructPose& wrapperStructPoseRunning,
+        const WrapperStructHand& wrapperStructHandRunning, const WrapperStructPose& wrapperStructPose,
+        const WrapperStructHand& wrapperStructHand);
+
+    /**
+     * TWorkers of each GPU thread and the elements that they share with the rest of the ThreadManager (private
+     * internal struct), as created by createPoseExtractorsWs.
+     */
+    template<typename TWorker>
+    struct WrapperPoseExtractors
+    {
+        std::vector<std::vector<TWorker>> poseExtractorsWs; // 1 std::vector<TWorker> per GPU thread
+        std::vector<TWorker> cpuRenderers; // Run after the GPU threads
+        std::shared_ptr<KeepTopNPeople> keepTopNPeople;
+        std::vector<std::shared_ptr<PoseExtractorNet>> poseExtractorNets;
+        std::vector<std::shared_ptr<FaceExtractorNet>> faceExtractorNets;
+        std::vector<std::shared_ptr<HandExtractorNet>> handExtractorNets;
+        std::vector<std::shared_ptr<PoseGpuRenderer>> poseGpuRenderers;
+        std::shared_ptr<PoseCpuRenderer> poseCpuRenderer;
+
+        /**
+         * It fills the keypoint-related elements of wrapperRuntimeHandles (i.e., all but spScaleAndSizeExtractor).
+         */
+        void setRuntimeHandles(WrapperRuntimeHandles& wrapperRuntimeHandles) const;
+    };
+
+    /**
+     * It creates the TWorkers of each GPU thread (private internal function). Common code for configureThreadManager
+     * and WrapperT::reconfigure, which re-creates them when a parameter that cannot be modified at runtime changes
+     * (see wrapperReconfigurePoseExtractors).
+     * If any of the XXXExtractorNets is not empty (1 per GPU thread, see getReusableXXXExtractorNets), it is used
+     * instead of creating (and loading) new ones.
+     */
+    template<typename TDatumsSP, typename TWorker>
+    WrapperPoseExtractors<TWorker> createPoseExtractorsWs(
+        const WrapperStructPose& wrapperStructPose, const WrapperStructFace& wrapperStructFace,
+        const WrapperStructHand& wrapperStructHand, const WrapperStructExtra& wrapperStructExtra,
+        const WrapperPoseLayout& wrapperPoseLayout,
+        const std::vector<std::shared_ptr<PoseExtractorNet>>& reusedPoseExtractorNets = {},
+        const std::vector<std::shared_ptr<FaceExtractorNet>>& reusedFaceExtractorNets = {},
+        const std::vector<std::shared_ptr<HandExtractorNet>>& reusedHandExtractorNets = {});
+
     /**
      * Set ThreadManager from TWorkers (private internal function).
      * After any configure() has been called, the TWorkers are initialized. This function resets the ThreadManager
      * and adds them.
      * Common code for start() and exec().
+     * If wrapperRuntimeHandles is not nullptr, it is filled with the elements that can be modified at runtime.
+     * If addedPoseExtractorsWs is not nullptr, it is filled with the TWorkers of the GPU threads added to the
+     * ThreadManager (so they can be replaced with ThreadManager::setTWorkers).
      */
     template<typename TDatum,
              typename TDatums = std::vector<std::shared_ptr<TDatum>>,
@@ -61,7 +223,9 @@ namespace op
         const WrapperStructExtra& wrapperStructExtra, const WrapperStructInput& wrapperStructInput,
         const WrapperStructOutput& wrapperStructOutput, const WrapperStructGui& wrapperStructGui,
         const std::array<std::vector<TWorker>, int(WorkerType::Size)>& userWs,
-        const std::array<bool, int(WorkerType::Size)>& userWsOnNewThread);
+        const std::array<bool, int(WorkerType::Size)>& userWsOnNewThread,
+        WrapperRuntimeHandles* wrapperRuntimeHandles = nullptr,
+        std::vector<std::vector<TWorker>>* addedPoseExtractorsWs = nullptr);
 
     /**
      * It fills camera parameters and splits the cvMat depending on how many camera parameter matrices are found.
@@ -90,10 +254,446 @@ namespace op
 #include <openpose/pose/headers.hpp>
 #include <openpose/producer/headers.hpp>
 #include <openpose/tracking/headers.hpp>
+#include <openpose/utilities/cpuFeatures.hpp>
 #include <openpose/utilities/fileSystem.hpp>
 #include <openpose/utilities/standard.hpp>
 namespace op
 {
+    template<typename TWorker>
+    void WrapperPoseExtractors<TWorker>::setRuntimeHandles(WrapperRuntimeHandles& wrapperRuntimeHandles) const
+    {
+        try
+        {
+            wrapperRuntimeHandles.spKeepTopNPeople = keepTopNPeople;
+            wrapperRuntimeHandles.poseRenderers.clear();
+            if (poseCpuRenderer != nullptr)
+                wrapperRuntimeHandles.poseRenderers.emplace_back(
+                    std::static_pointer_cast<Renderer>(poseCpuRenderer));
+            for (const auto& poseGpuRenderer : poseGpuRenderers)
+                wrapperRuntimeHandles.poseRenderers.emplace_back(
+                    std::static_pointer_cast<Renderer>(poseGpuRenderer));
+            wrapperRuntimeHandles.poseExtractorNets = poseExtractorNets;
+            wrapperRuntimeHandles.faceExtractorNets = faceExtractorNets;
+            wrapperRuntimeHandles.handExtractorNets = handExtractorNets;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename TDatumsSP, typename TWorker>
+    WrapperPoseExtractors<TWorker> createPoseExtractorsWs(
+        const WrapperStructPose& wrapperStructPose, const WrapperStructFace& wrapperStructFace,
+        const WrapperStructHand& wrapperStructHand, const WrapperStructExtra& wrapperStructExtra,
+        const WrapperPoseLayout& wrapperPoseLayout,
+        const std::vector<std::shared_ptr<PoseExtractorNet>>& reusedPoseExtractorNets,
+        const std::vector<std::shared_ptr<FaceExtractorNet>>& reusedFaceExtractorNets,
+        const std::vector<std::shared_ptr<HandExtractorNet>>& reusedHandExtractorNets)
+    {
+        try
+        {
+            WrapperPoseExtractors<TWorker> wrapperPoseExtractors;
+            auto& poseExtractorsWs = wrapperPoseExtractors.poseExtractorsWs;
+            auto& cpuRenderers = wrapperPoseExtractors.cpuRenderers;
+            auto& keepTopNPeople = wrapperPoseExtractors.keepTopNPeople;
+            auto& poseExtractorNets = wrapperPoseExtractors.poseExtractorNets;
+            auto& faceExtractorNets = wrapperPoseExtractors.faceExtractorNets;
+            auto& handExtractorNets = wrapperPoseExtractors.handExtractorNets;
+            auto& poseGpuRenderers = wrapperPoseExtractors.poseGpuRenderers;
+            auto& poseCpuRenderer = wrapperPoseExtractors.poseCpuRenderer;
+            // CUDA vs. CPU resize
+            std::vector<std::shared_ptr<CvMatToOpOutput>> cvMatToOpOutputs;
+            std::vector<std::shared_ptr<OpOutputToCvMat>> opOutputToCvMats;
+            // Required parameters
+            const auto renderModePose = wrapperPoseLayout.renderModePose;
+            const auto renderModeFace = wrapperPoseLayout.renderModeFace;
+            const auto renderModeHand = wrapperPoseLayout.renderModeHand;
+            const auto renderOutputGpu = wrapperPoseLayout.renderOutputGpu;
+            const auto renderFace = wrapperPoseLayout.renderFace;
+            const auto renderHand = wrapperPoseLayout.renderHand;
+            const auto renderHandGpu = wrapperPoseLayout.renderHandGpu;
+            const auto numberGpuThreads = wrapperPoseLayout.numberGpuThreads;
+            const auto gpuNumberStart = wrapperPoseLayout.gpuNumberStart;
+            const auto addCvMatToOpOutput = wrapperPoseLayout.addCvMatToOpOutput;
+            const auto addCvMatToOpOutputInCpu = wrapperPoseLayout.addCvMatToOpOutputInCpu;
+            const auto modelFolder = formatAsDirectory(wrapperStructPose.modelFolder.getStdString());
+
+            // Pose estimators & renderers
+            poseExtractorsWs.resize(numberGpuThreads);
+            if (wrapperStructPose.poseMode != PoseMode::Disabled)
+            {
+                // Pose estimators (re-used ones keep their loaded networks)
+                if (!reusedPoseExtractorNets.empty())
+                    poseExtractorNets = reusedPoseExtractorNets;
+                else
+                {
+                    for (auto gpuId = 0; gpuId < numberGpuThreads; gpuId++)
+                        poseExtractorNets.emplace_back(std::make_shared<PoseExtractorCaffe>(
+                            wrapperStructPose.poseModel, modelFolder, gpuId + gpuNumberStart,
+                            wrapperStructPose.heatMapTypes, wrapperStructPose.heatMapScaleMode,
+                            wrapperStructPose.addPartCandidates, wrapperStructPose.maximizePositives,
+                            wrapperStructPose.protoTxtPath.getStdString(),
+                            wrapperStructPose.caffeModelPath.getStdString(),
+                            wrapperStructPose.upsamplingRatio, wrapperStructPose.poseMode == PoseMode::Enabled,
+                            wrapperStructPose.enableGoogleLogging, wrapperStructPose.fastStartup,
+                            wrapperStructPose.netInputSize
+                        ));
+                }
+
+                // Pose renderers
+                if (renderOutputGpu || renderModePose == RenderMode::Cpu)
+                {
+                    // If renderModePose != RenderMode::Gpu but renderOutput, then we create an
+                    // alpha = 0 pose renderer in order to keep the removing background option
+                    const auto alphaKeypoint = (renderModePose != RenderMode::None
+                                                ? wrapperStructPose.alphaKeypoint : 0.f);
+                    const auto alphaHeatMap = (renderModePose != RenderMode::None
+                                                ? wrapperStructPose.alphaHeatMap : 0.f);
+                    // GPU rendering
+                    if (renderOutputGpu)
+                    {
+                        for (const auto& poseExtractorNet : poseExtractorNets)
+                        {
+                            poseGpuRenderers.emplace_back(std::make_shared<PoseGpuRenderer>(
+                                wrapperStructPose.poseModel, poseExtractorNet, wrapperStructPose.renderThreshold,
+                                wrapperStructPose.blendOriginalFrame, alphaKeypoint,
+                                alphaHeatMap, wrapperStructPose.defaultPartToRender
+                            ));
+                        }
+                    }
+                    // CPU rendering
+                    if (renderModePose == RenderMode::Cpu)
+                    {
+                        poseCpuRenderer = std::make_shared<PoseCpuRenderer>(
+                            wrapperStructPose.poseModel, wrapperStructPose.renderThreshold,
+                            wrapperStructPose.blendOriginalFrame, alphaKeypoint, alphaHeatMap,
+                            wrapperStructPose.defaultPartToRender);
+                        cpuRenderers.emplace_back(std::make_shared<WPoseRenderer<TDatumsSP>>(poseCpuRenderer));
+                    }
+                }
+                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+
+                // Pose extractor(s)
+                poseExtractorsWs.resize(poseExtractorNets.size());
+                const auto personIdExtractor = (wrapperStructExtra.identification
+                    ? std::make_shared<PersonIdExtractor>() : nullptr);
+                // Keep top N people
+                // Added right after PoseExtractorNet to avoid:
+                // 1) Rendering people that are later deleted (wrong visualization).
+                // 2) Processing faces and hands on people that will be deleted (speed up).
+                // 3) Running tracking before deleting the people.
+                // Add KeepTopNPeople for each PoseExtractorNet
+                // Created even if numberPeopleMax <= 0 (no-op), so it can be modified at runtime
+                keepTopNPeople = std::make_shared<KeepTopNPeople>(wrapperStructPose.numberPeopleMax);
+                // Person tracker
+                auto personTrackers = std::make_shared<std::vector<std::shared_ptr<PersonTracker>>>();
+                if (wrapperStructExtra.tracking > -1)
+                    personTrackers->emplace_back(
+                        std::make_shared<PersonTracker>(wrapperStructExtra.tracking == 0));
+                for (auto i = 0u; i < poseExtractorsWs.size(); i++)
+                {
+                    // OpenPose keypoint detector + keepTopNPeople
+                    //    + ID extractor (experimental) + tracking (experimental)
+                    const auto poseExtractor = std::make_shared<PoseExtractor>(
+                        poseExtractorNets.at(i), keepTopNPeople, personIdExtractor, personTrackers,
+                        wrapperStructPose.numberPeopleMax, wrapperStructExtra.tracking);
+                    // If we want the initial image resize on GPU
+                    if (!wrapperPoseLayout.resizeInputOnCpu)
+                    {
+                        const auto gpuResize = true;
+                        const auto cvMatToOpInput = std::make_shared<CvMatToOpInput>(
+                            wrapperStructPose.poseModel, gpuResize);
+                        poseExtractorsWs.at(i).emplace_back(
+                            std::make_shared<WCvMatToOpInput<TDatumsSP>>(cvMatToOpInput));
+                    }
+                    // If we want the final image resize on GPU
+                    if (addCvMatToOpOutput && !addCvMatToOpOutputInCpu)
+                    {
+                        const auto gpuResize = true;
+                        cvMatToOpOutputs.emplace_back(std::make_shared<CvMatToOpOutput>(gpuResize));
+                        poseExtractorsWs.at(i).emplace_back(
+                            std::make_shared<WCvMatToOpOutput<TDatumsSP>>(cvMatToOpOutputs.back()));
+                    }
+                    poseExtractorsWs.at(i).emplace_back(
+                        std::make_shared<WPoseExtractor<TDatumsSP>>(poseExtractor));
+                    // poseExtractorsWs.at(i) = {std::make_shared<WPoseExtractor<TDatumsSP>>(poseExtractor)};
+                    // // Just OpenPose keypoint detector
+                    // poseExtractorsWs.at(i) = {std::make_shared<WPoseExtractorNet<TDatumsSP>>(
+                    //     poseExtractorNets.at(i))};
+                }
+
+                // // (Before tracking / id extractor)
+                // // Added right after PoseExtractorNet to avoid:
+                // // 1) Rendering people that are later deleted (wrong visualization).
+                // // 2) Processing faces and hands on people that will be deleted (speed up).
+                // if (wrapperStructPose.numberPeopleMax > 0)
+                // {
+                //     // Add KeepTopNPeople for each PoseExtractorNet
+                //     const auto keepTopNPeople = std::make_shared<KeepTopNPeople>(
+                //         wrapperStructPose.numberPeopleMax);
+                //     for (auto& wPose : poseExtractorsWs)
+                //         wPose.emplace_back(std::make_shared<WKeepTopNPeople<TDatumsSP>>(keepTopNPeople));
+                // }
+            }
+            opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+
+            // Pose renderer(s)
+            if (!poseGpuRenderers.empty())
+            {
+                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                for (auto i = 0u; i < poseExtractorsWs.size(); i++)
+                {
+                    poseExtractorsWs.at(i).emplace_back(std::make_shared<WPoseRenderer<TDatumsSP>>(
+                        poseGpuRenderers.at(i)));
+                    // Get shared params
+                    if (!cvMatToOpOutputs.empty())
+                        poseGpuRenderers.at(i)->setSharedParameters(
+                            cvMatToOpOutputs.at(i)->getSharedParameters());
+                }
+            }
+            opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+
+            // Face extractor(s)
+            if (wrapperStructFace.enable)
+            {
+                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                // Face detector
+                // OpenPose body-based face detector
+                if (wrapperStructFace.detector == Detector::Body)
+                {
+                    // Sanity check
+                    if (wrapperStructPose.poseMode == PoseMode::Disabled)
+                        error("Body keypoint detection is disabled but face Detector is set to Body. Either"
+                              " re-enable OpenPose body or select a different face Detector (`--face_detector`).",
+                              __LINE__, __FUNCTION__, __FILE__);
+                    // Constructors
+                    const auto faceDetector = std::make_shared<FaceDetector>(wrapperStructPose.poseModel);
+                    for (auto& wPose : poseExtractorsWs)
+                        wPose.emplace_back(std::make_shared<WFaceDetector<TDatumsSP>>(faceDetector));
+                }
+                // OpenCV face detector
+                else if (wrapperStructFace.detector == Detector::OpenCV)
+                {
+                    opLog("Body keypoint detection is disabled. Hence, using OpenCV face detector (much less"
+                        " accurate but faster).", Priority::High);
+                    for (auto& wPose : poseExtractorsWs)
+                    {
+                        // 1 FaceDetectorOpenCV per thread, OpenCV face detector is not thread-safe
+                        const auto faceDetectorOpenCV = std::make_shared<FaceDetectorOpenCV>(modelFolder);
+                        wPose.emplace_back(
+                            std::make_shared<WFaceDetectorOpenCV<TDatumsSP>>(faceDetectorOpenCV)
+                        );
+                    }
+                }
+                // If provided by user: We do not need to create a FaceDetector
+                // Unknown face Detector
+                else if (wrapperStructFace.detector != Detector::Provided)
+                    error("Unknown face Detector. Select a valid face Detector (`--face_detector`).",
+                          __LINE__, __FUNCTION__, __FILE__);
+                // Face keypoint extractor
+                for (auto gpu = 0u; gpu < poseExtractorsWs.size(); gpu++)
+                {
+                    // Face keypoint extractor (re-used ones keep their loaded networks, but they might have been
+                    // disabled on runtime)
+                    std::shared_ptr<FaceExtractorNet> faceExtractorNet;
+                    if (!reusedFaceExtractorNets.empty())
+                    {
+                        faceExtractorNet = reusedFaceExtractorNets.at(gpu);
+                        faceExtractorNet->setEnabled(true);
+                    }
+                    else
+                    {
+                        const auto netOutputSize = wrapperStructFace.netInputSize;
+                        faceExtractorNet = std::make_shared<FaceExtractorCaffe>(
+                            wrapperStructFace.netInputSize, netOutputSize, modelFolder,
+                            gpu + gpuNumberStart, wrapperStructPose.heatMapTypes, wrapperStructPose.heatMapScaleMode,
+                            wrapperStructPose.enableGoogleLogging, wrapperStructPose.fastStartup
+                        );
+                    }
+                    faceExtractorNets.emplace_back(faceExtractorNet);
+                    poseExtractorsWs.at(gpu).emplace_back(
+                        std::make_shared<WFaceExtractorNet<TDatumsSP>>(faceExtractorNet));
+                }
+            }
+            opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+
+            // Hand extractor(s)
+            if (wrapperStructHand.enable)
+            {
+                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                const auto handDetector = std::make_shared<HandDetector>(wrapperStructPose.poseModel);
+                for (auto gpu = 0u; gpu < poseExtractorsWs.size(); gpu++)
+                {
+                    // Sanity check
+                    if ((wrapperStructHand.detector == Detector::BodyWithTracking
+                         || wrapperStructHand.detector == Detector::Body)
+                        && wrapperStructPose.poseMode == PoseMode::Disabled)
+                        error("Body keypoint detection is disabled but hand Detector is set to Body. Either"
+                              " re-enable OpenPose body or select a different hand Detector (`--hand_detector`).",
+                              __LINE__, __FUNCTION__, __FILE__);
+                    // Hand detector
+                    // OpenPose body-based hand detector with tracking
+                    if (wrapperStructHand.detector == Detector::BodyWithTracking)
+                    {
+                        poseExtractorsWs.at(gpu).emplace_back(
+                            std::make_shared<WHandDetectorTracking<TDatumsSP>>(handDetector));
+                    }
+                    // OpenPose body-based hand detector
+                    else if (wrapperStructHand.detector == Detector::Body)
+                    {
+                        poseExtractorsWs.at(gpu).emplace_back(
+                            std::make_shared<WHandDetector<TDatumsSP>>(handDetector));
+                    }
+                    // If provided by user: We do not need to create a FaceDetector
+                    // Unknown hand Detector
+                    else if (wrapperStructHand.detector != Detector::Provided)
+                        error("Unknown hand Detector. Select a valid hand Detector (`--hand_detector`).",
+                              __LINE__, __FUNCTION__, __FILE__);
+                    // Hand keypoint extractor (re-used ones keep their loaded networks, but they might have been
+                    // disabled on runtime)
+                    std::shared_ptr<HandExtractorNet> handExtractorNet;
+                    if (!reusedHandExtractorNets.empty())
+                    {
+                        handExtractorNet = reusedHandExtractorNets.at(gpu);
+                        handExtractorNet->setEnabled(true);
+                    }
+                    else
+                    {
+                        const auto netOutputSize = wrapperStructHand.netInputSize;
+                        handExtractorNet = std::make_shared<HandExtractorCaffe>(
+                            wrapperStructHand.netInputSize, netOutputSize, modelFolder,
+                            gpu + gpuNumberStart, wrapperStructHand.scalesNumber, wrapperStructHand.scaleRange,
+                            wrapperStructPose.heatMapTypes, wrapperStructPose.heatMapScaleMode,
+                            wrapperStructPose.enableGoogleLogging, wrapperStructPose.fastStartup
+                        );
+                    }
+                    handExtractorNets.emplace_back(handExtractorNet);
+                    poseExtractorsWs.at(gpu).emplace_back(
+                        std::make_shared<WHandExtractorNet<TDatumsSP>>(handExtractorNet)
+                        );
+                    // If OpenPose body-based hand detector with tracking
+                    if (wrapperStructHand.detector == Detector::BodyWithTracking)
+                        poseExtractorsWs.at(gpu).emplace_back(
+                            std::make_shared<WHandDetectorUpdate<TDatumsSP>>(handDetector));
+                }
+            }
+            opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+
+            // Face renderer(s)
+            if (renderFace)
+            {
+                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                // CPU rendering
+                if (renderModeFace == RenderMode::Cpu)
+                {
+                    // Construct face renderer
+                    const auto faceRenderer = std::make_shared<FaceCpuRenderer>(
+                        wrapperStructFace.renderThreshold, wrapperStructFace.alphaKeypoint,
+                        wrapperStructFace.alphaHeatMap);
+                    // Add worker
+                    cpuRenderers.emplace_back(std::make_shared<WFaceRenderer<TDatumsSP>>(faceRenderer));
+                }
+                // GPU rendering
+                else if (renderModeFace == RenderMode::Gpu)
+                {
+                    for (auto i = 0u; i < poseExtractorsWs.size(); i++)
+                    {
+                        // Construct face renderer
+                        const auto faceRenderer = std::make_shared<FaceGpuRenderer>(
+                            wrapperStructFace.renderThreshold, wrapperStructFace.alphaKeypoint,
+                            wrapperStructFace.alphaHeatMap
+                        );
+                        // Performance boost -> share spGpuMemory for all renderers
+                        if (!poseGpuRenderers.empty())
+                        {
+                            // const bool isLastRenderer = !renderHandGpu;
+                            const bool isLastRenderer = !renderHandGpu && !(addCvMatToOpOutput && !addCvMatToOpOutputInCpu);
+                            const auto renderer = std::static_pointer_cast<PoseGpuRenderer>(
+                                poseGpuRenderers.at(i));
+                            faceRenderer->setSharedParametersAndIfLast(
+                                renderer->getSharedParameters(), isLastRenderer);
+                        }
+                        // Add worker
+                        poseExtractorsWs.at(i).emplace_back(
+                            std::make_shared<WFaceRenderer<TDatumsSP>>(faceRenderer));
+                    }
+                }
+                else
+                    error("Unknown RenderMode.", __LINE__, __FUNCTION__, __FILE__);
+            }
+            opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+
+            // Hand renderer(s)
+            if (renderHand)
+            {
+                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                // CPU rendering
+                if (renderModeHand == RenderMode::Cpu)
+                {
+                    // Construct hand renderer
+                    const auto handRenderer = std::make_shared<HandCpuRenderer>(
+                        wrapperStructHand.renderThreshold, wrapperStructHand.alphaKeypoint,
+                        wrapperStructHand.alphaHeatMap);
+                    // Add worker
+                    cpuRenderers.emplace_back(std::make_shared<WHandRenderer<TDatumsSP>>(handRenderer));
+                }
+                // GPU rendering
+                else if (renderModeHand == RenderMode::Gpu)
+                {
+                    for (auto i = 0u; i < poseExtractorsWs.size(); i++)
+                    {
+                        // Construct hands renderer
+                        const auto handRenderer = std::make_shared<HandGpuRenderer>(
+                            wrapperStructHand.renderThreshold, wrapperStructHand.alphaKeypoint,
+                            wrapperStructHand.alphaHeatMap
+                        );
+                        // Performance boost -> share spGpuMemory for all renderers
+                        if (!poseGpuRenderers.empty())
+                        {
+                            // const bool isLastRenderer = true;
+                            const bool isLastRenderer = !(addCvMatToOpOutput && !addCvMatToOpOutputInCpu);
+                            const auto renderer = std::static_pointer_cast<PoseGpuRenderer>(
+                                poseGpuRenderers.at(i));
+                            handRenderer->setSharedParametersAndIfLast(
+                                renderer->getSharedParameters(), isLastRenderer);
+                        }
+                        // Add worker
+                        poseExtractorsWs.at(i).emplace_back(
+                            std::make_shared<WHandRenderer<TDatumsSP>>(handRenderer));
+                    }
+                }
+                else
+                    error("Unknown RenderMode.", __LINE__, __FUNCTION__, __FILE__);
+            }
+            opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+
+            // Frames processor (OpenPose format -> cv::Mat format)
+            if (addCvMatToOpOutput && !addCvMatToOpOutputInCpu)
+            {
+                // for (auto& poseExtractorsW : poseExtractorsWs)
+                for (auto i = 0u ; i < poseExtractorsWs.size() ; ++i)
+                {
+                    const auto gpuResize = true;
+                    opOutputToCvMats.emplace_back(std::make_shared<OpOutputToCvMat>(gpuResize));
+                    poseExtractorsWs.at(i).emplace_back(
+                        std::make_shared<WOpOutputToCvMat<TDatumsSP>>(opOutputToCvMats.back()));
+                    // Assign shared parameters
+                    opOutputToCvMats.back()->setSharedParameters(
+                        cvMatToOpOutputs.at(i)->getSharedParameters());
+                }
+            }
+            opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+
+            return wrapperPoseExtractors;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return WrapperPoseExtractors<TWorker>{};
+        }
+    }
+
     template<typename TDatum, typename TDatums, typename TDatumsSP, typename TWorker>
     void configureThreadManager(
         ThreadManager<TDatumsSP>& threadManager, const bool multiThreadEnabledTemp,
@@ -102,17 +702,22 @@ namespace op
         const WrapperStructExtra& wrapperStructExtra, const WrapperStructInput& wrapperStructInput,
         const WrapperStructOutput& wrapperStructOutput, const WrapperStructGui& wrapperStructGui,
         const std::array<std::vector<TWorker>, int(WorkerType::Size)>& userWs,
-        const std::array<bool, int(WorkerType::Size)>& userWsOnNewThread)
+        const std::array<bool, int(WorkerType::Size)>& userWsOnNewThread,
+        WrapperRuntimeHandles* wrapperRuntimeHandles, std::vector<std::vector<TWorker>>* addedPoseExtractorsWs)
     {
         try
         {
             opLog("Running configureThreadManager...", Priority::Normal);
 
+            // Select (and log) the SIMD instruction set of the CPU kernels once at startup
+            getCpuInstructionSet();
+
             // Create producer
             auto producerSharedPtr = createProducer(
                 wrapperStructInput.producerType, wrapperStructInput.producerString.getStdString(),
                 wrapperStructInput.cameraResolution, wrapperStructInput.cameraParameterPath.getStdString(),
-                wrapperStructInput.undistortImage, wrapperStructInput.numberViews);
+                wrapperStructInput.undistortImage, wrapperStructInput.numberViews,
+                wrapperStructInput.watchDirectoryProcessed.getStdString());
 
             // Editable arguments
             auto wrapperStructPose = wrapperStructPoseTemp;
@@ -136,35 +741,10 @@ namespace op
 
             // Required parameters
             const auto gpuMode = getGpuMode();
-            const auto renderModePose = (
-                wrapperStructPose.renderMode != RenderMode::Auto
-                    ? wrapperStructPose.renderMode
-                    : (gpuMode == GpuMode::Cuda ? RenderMode::Gpu : RenderMode::Cpu));
-            const auto renderModeFace = (
-                wrapperStructFace.renderMode != RenderMode::Auto
-                    ? wrapperStructFace.renderMode
-                    : (gpuMode == GpuMode::Cuda ? RenderMode::Gpu : RenderMode::Cpu));
-            const auto renderModeHand = (
-                wrapperStructHand.renderMode != RenderMode::Auto
-                    ? wrapperStructHand.renderMode
-                    : (gpuMode == GpuMode::Cuda ? RenderMode::Gpu : RenderMode::Cpu));
-            const auto renderOutput = renderModePose != RenderMode::None
-                                        || renderModeFace != RenderMode::None
-                                        || renderModeHand != RenderMode::None;
-            const bool renderOutputGpu = renderModePose == RenderMode::Gpu
-                || (wrapperStructFace.enable && renderModeFace == RenderMode::Gpu)
-                || (wrapperStructHand.enable && renderModeHand == RenderMode::Gpu);
-            const bool renderFace = wrapperStructFace.enable && renderModeFace != RenderMode::None;
-            const bool renderHand = wrapperStructHand.enable && renderModeHand != RenderMode::None;
-            const bool renderHandGpu = wrapperStructHand.enable && renderModeHand == RenderMode::Gpu;
-            opLog("renderModePose = " + std::to_string(int(renderModePose)), Priority::Normal);
-            opLog("renderModeFace = " + std::to_string(int(renderModeFace)), Priority::Normal);
-            opLog("renderModeHand = " + std::to_string(int(renderModeHand)), Priority::Normal);
-            opLog("renderOutput = " + std::to_string(int(renderOutput)), Priority::Normal);
-            opLog("renderOutputGpu = " + std::to_string(int(renderOutput)), Priority::Normal);
-            opLog("renderFace = " + std::to_string(int(renderFace)), Priority::Normal);
-            opLog("renderHand = " + std::to_string(int(renderHand)), Priority::Normal);
-            opLog("renderHandGpu = " + std::to_string(int(renderHandGpu)), Priority::Normal);
+            const auto wrapperPoseLayout = getWrapperPoseLayout(
+                wrapperStructPose, wrapperStructFace, wrapperStructHand);
+            const auto renderModePose = wrapperPoseLayout.renderModePose;
+            const auto renderOutput = wrapperPoseLayout.renderOutput;
 
             // Check no wrong/contradictory flags enabled
             const bool userInputAndPreprocessingWsEmpty = userInputWs.empty() && userPreProcessingWs.empty();
@@ -178,47 +758,15 @@ namespace op
             opLog("userOutputWsEmpty = " + std::to_string(int(userOutputWsEmpty)), Priority::Normal);
 
             // Get number threads
-            auto numberGpuThreads = wrapperStructPose.gpuNumber;
-            auto gpuNumberStart = wrapperStructPose.gpuNumberStart;
-            opLog("numberGpuThreads = " + std::to_string(numberGpuThreads), Priority::Normal);
-            opLog("gpuNumberStart = " + std::to_string(gpuNumberStart), Priority::Normal);
+            const auto numberGpuThreads = wrapperPoseLayout.numberGpuThreads;
             // CPU --> 1 thread or no pose extraction
             if (gpuMode == GpuMode::NoGpu)
             {
-                numberGpuThreads = (wrapperStructPose.gpuNumber == 0 ? 0 : 1);
-                gpuNumberStart = 0;
                 // Disabling multi-thread makes the code 400 ms faster (2.3 sec vs. 2.7 in i7-6850K)
                 // and fixes the bug that the screen was not properly displayed and only refreshed sometimes
                 // Note: The screen bug could be also fixed by using waitKey(30) rather than waitKey(1)
                 multiThreadEnabled = false;
             }
-            // GPU --> user picks (<= #GPUs)
-            else
-            {
-                // Get total number GPUs
-                const auto totalGpuNumber = getGpuNumber();
-                // If number GPU < 0 --> set it to all the available GPUs
-                if (numberGpuThreads < 0)
-                {
-                    if (totalGpuNumber <= gpuNumberStart)
-                        error("Number of initial GPU (`--number_gpu_start`) must be lower than the total number of"
-                              " used GPUs (`--number_gpu`)", __LINE__, __FUNCTION__, __FILE__);
-                    numberGpuThreads = totalGpuNumber - gpuNumberStart;
-                    // Reset initial GPU to 0 (we want them all)
-                    // Logging message
-                    opLog("Auto-detecting all available GPUs... Detected " + std::to_string(totalGpuNumber)
-                        + " GPU(s), using " + std::to_string(numberGpuThreads) + " of them starting at GPU "
-                        + std::to_string(gpuNumberStart) + ".", Priority::High);
-                }
-                // Sanity check
-                if (gpuNumberStart + numberGpuThreads > totalGpuNumber)
-                    error("Initial GPU selected (`--number_gpu_start`) + number GPUs to use (`--number_gpu`) must"
-                          " be lower or equal than the total number of GPUs in your machine ("
-                          + std::to_string(gpuNumberStart) + " + "
-                          + std::to_string(numberGpuThreads) + " vs. "
-                          + std::to_string(totalGpuNumber) + ").",
-                          __LINE__, __FUNCTION__, __FILE__);
-            }
 
             // Proper format
             const auto writeImagesCleaned = formatAsDirectory(wrapperStructOutput.writeImages.getStdString());
@@ -268,49 +816,41 @@ namespace op
             else
                 datumProducerW = nullptr;
 
-            std::vector<std::shared_ptr<PoseExtractorNet>> poseExtractorNets;
-            std::vector<std::shared_ptr<FaceExtractorNet>> faceExtractorNets;
-            std::vector<std::shared_ptr<HandExtractorNet>> handExtractorNets;
-            std::vector<std::shared_ptr<PoseGpuRenderer>> poseGpuRenderers;
-            // CUDA vs. CPU resize
-            std::vector<std::shared_ptr<CvMatToOpOutput>> cvMatToOpOutputs;
-            std::vector<std::shared_ptr<OpOutputToCvMat>> opOutputToCvMats;
-            std::shared_ptr<PoseCpuRenderer> poseCpuRenderer;
+            std::shared_ptr<ScaleAndSizeExtractor> scaleAndSizeExtractor;
+            // Pose estimators & renderers
+            WrapperPoseExtractors<TWorker> wrapperPoseExtractors;
+            const auto& poseExtractorsWs = wrapperPoseExtractors.poseExtractorsWs;
+            const auto& poseExtractorNets = wrapperPoseExtractors.poseExtractorNets;
+            const auto& faceExtractorNets = wrapperPoseExtractors.faceExtractorNets;
+            const auto& handExtractorNets = wrapperPoseExtractors.handExtractorNets;
+            const auto& poseGpuRenderers = wrapperPoseExtractors.poseGpuRenderers;
+            const auto& poseCpuRenderer = wrapperPoseExtractors.poseCpuRenderer;
             // Workers
             TWorker scaleAndSizeExtractorW;
             TWorker cvMatToOpInputW;
             TWorker cvMatToOpOutputW;
-            bool addCvMatToOpOutput = renderOutput;
-            bool addCvMatToOpOutputInCpu = addCvMatToOpOutput;
-            std::vector<std::vector<TWorker>> poseExtractorsWs;
+            TWorker poseViewRefinerCropW;
+            const auto addCvMatToOpOutputInCpu = wrapperPoseLayout.addCvMatToOpOutputInCpu;
             std::vector<std::vector<TWorker>> poseTriangulationsWs;
             std::vector<std::vector<TWorker>> jointAngleEstimationsWs;
             std::vector<TWorker> postProcessingWs;
             if (numberGpuThreads > 0)
             {
                 // Get input scales and sizes
-                const auto scaleAndSizeExtractor = std::make_shared<ScaleAndSizeExtractor>(
+                scaleAndSizeExtractor = std::make_shared<ScaleAndSizeExtractor>(
                     wrapperStructPose.netInputSize, (float)wrapperStructPose.netInputSizeDynamicBehavior, finalOutputSize,
                     wrapperStructPose.scalesNumber, wrapperStructPose.scaleGap);
                 scaleAndSizeExtractorW = std::make_shared<WScaleAndSizeExtractor<TDatumsSP>>(scaleAndSizeExtractor);
 
                 // Input cvMat to OpenPose input & output format
                 // Note: resize on GPU reduces accuracy about 0.1%
-                bool resizeOnCpu = true;
-                // const auto resizeOnCpu = (wrapperStructPose.poseMode != PoseMode::Enabled);
-                if (resizeOnCpu)
+                if (wrapperPoseLayout.resizeInputOnCpu)
                 {
                     const auto gpuResize = false;
                     const auto cvMatToOpInput = std::make_shared<CvMatToOpInput>(
                         wrapperStructPose.poseModel, gpuResize);
                     cvMatToOpInputW = std::make_shared<WCvMatToOpInput<TDatumsSP>>(cvMatToOpInput);
                 }
-                // Note: We realized that somehow doing it on GPU for any number of GPUs does speedup the whole OP
-                resizeOnCpu = false;
-                addCvMatToOpOutputInCpu = addCvMatToOpOutput
-                    && (resizeOnCpu || !renderOutputGpu || wrapperStructPose.poseMode != PoseMode::Enabled
-                        // Resize in GPU causing bug
-                        || wrapperStructPose.outputSize.x != -1 || wrapperStructPose.outputSize.y != -1);
                 if (addCvMatToOpOutputInCpu)
                 {
                     const auto gpuResize = false;
@@ -318,347 +858,9 @@ namespace op
                     cvMatToOpOutputW = std::make_shared<WCvMatToOpOutput<TDatumsSP>>(cvMatToOpOutput);
                 }
 
-                // Pose estimators & renderers
-                std::vector<TWorker> cpuRenderers;
-                poseExtractorsWs.clear();
-                poseExtractorsWs.resize(numberGpuThreads);
-                if (wrapperStructPose.poseMode != PoseMode::Disabled)
-                {
-                    // Pose estimators
-                    for (auto gpuId = 0; gpuId < numberGpuThreads; gpuId++)
-                        poseExtractorNets.emplace_back(std::make_shared<PoseExtractorCaffe>(
-                            wrapperStructPose.poseModel, modelFolder, gpuId + gpuNumberStart,
-                            wrapperStructPose.heatMapTypes, wrapperStructPose.heatMapScaleMode,
-                            wrapperStructPose.addPartCandidates, wrapperStructPose.maximizePositives,
-                            wrapperStructPose.protoTxtPath.getStdString(),
-                            wrapperStructPose.caffeModelPath.getStdString(),
-                            wrapperStructPose.upsamplingRatio, wrapperStructPose.poseMode == PoseMode::Enabled,
-                            wrapperStructPose.enableGoogleLogging
-                        ));
-
-                    // Pose renderers
-                    if (renderOutputGpu || renderModePose == RenderMode::Cpu)
-                    {
-                        // If renderModePose != RenderMode::Gpu but renderOutput, then we create an
-                        // alpha = 0 pose renderer in order to keep the removing background option
-                        const auto alphaKeypoint = (renderModePose != RenderMode::None
-                                                    ? wrapperStructPose.alphaKeypoint : 0.f);
-                        const auto alphaHeatMap = (renderModePose != RenderMode::None
-                                                    ? wrapperStructPose.alphaHeatMap : 0.f);
-                        // GPU rendering
-                        if (renderOutputGpu)
-                        {
-                            for (const auto& poseExtractorNet : poseExtractorNets)
-                            {
-                                poseGpuRenderers.emplace_back(std::make_shared<PoseGpuRenderer>(
-                                    wrapperStructPose.poseModel, poseExtractorNet, wrapperStructPose.renderThreshold,
-                                    wrapperStructPose.blendOriginalFrame, alphaKeypoint,
-                                    alphaHeatMap, wrapperStructPose.defaultPartToRender
-                                ));
-                            }
-                        }
-                        // CPU rendering
-                        if (renderModePose == RenderMode::Cpu)
-                        {
-                            poseCpuRenderer = std::make_shared<PoseCpuRenderer>(
-                                wrapperStructPose.poseModel, wrapperStructPose.renderThreshold,
-                                wrapperStructPose.blendOriginalFrame, alphaKeypoint, alphaHeatMap,
-                                wrapperStructPose.defaultPartToRender);
-                            cpuRenderers.emplace_back(std::make_shared<WPoseRenderer<TDatumsSP>>(poseCpuRenderer));
-                        }
-                    }
-                    opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-
-                    // Pose extractor(s)
-                    poseExtractorsWs.resize(poseExtractorNets.size());
-                    const auto personIdExtractor = (wrapperStructExtra.identification
-                        ? std::make_shared<PersonIdExtractor>() : nullptr);
-                    // Keep top N people
-                    // Added right after PoseExtractorNet to avoid:
-                    // 1) Rendering people that are later deleted (wrong visualization).
-                    // 2) Processing faces and hands on people that will be deleted (speed up).
-                    // 3) Running tracking before deleting the people.
-                    // Add KeepTopNPeople for each PoseExtractorNet
-                    const auto keepTopNPeople = (wrapperStructPose.numberPeopleMax > 0 ?
-                        std::make_shared<KeepTopNPeople>(wrapperStructPose.numberPeopleMax)
-                        : nullptr);
-                    // Person tracker
-                    auto personTrackers = std::make_shared<std::vector<std::shared_ptr<PersonTracker>>>();
-                    if (wrapperStructExtra.tracking > -1)
-                        personTrackers->emplace_back(
-                            std::make_shared<PersonTracker>(wrapperStructExtra.tracking == 0));
-                    for (auto i = 0u; i < poseExtractorsWs.size(); i++)
-                    {
-                        // OpenPose keypoint detector + keepTopNPeople
-                        //    + ID extractor (experimental) + tracking (experimental)
-                        const auto poseExtractor = std::make_shared<PoseExtractor>(
-                            poseExtractorNets.at(i), keepTopNPeople, personIdExtractor, personTrackers,
-                            wrapperStructPose.numberPeopleMax, wrapperStructExtra.tracking);
-                        // If we want the initial image resize on GPU
-                        if (cvMatToOpInputW == nullptr)
-                        {
-                            const auto gpuResize = true;
-                            const auto cvMatToOpInput = std::make_shared<CvMatToOpInput>(
-                                wrapperStructPose.poseModel, gpuResize);
-                            poseExtractorsWs.at(i).emplace_back(
-                                std::make_shared<WCvMatToOpInput<TDatumsSP>>(cvMatToOpInput));
-                        }
-                        // If we want the final image resize on GPU
-                        if (addCvMatToOpOutput && cvMatToOpOutputW == nullptr)
-                        {
-                            const auto gpuResize = true;
-                            cvMatToOpOutputs.emplace_back(std::make_shared<CvMatToOpOutput>(gpuResize));
-                            poseExtractorsWs.at(i).emplace_back(
-                                std::make_shared<WCvMatToOpOutput<TDatumsSP>>(cvMatToOpOutputs.back()));
-                        }
-                        poseExtractorsWs.at(i).emplace_back(
-                            std::make_shared<WPoseExtractor<TDatumsSP>>(poseExtractor));
-                        // poseExtractorsWs.at(i) = {std::make_shared<WPoseExtractor<TDatumsSP>>(poseExtractor)};
-                        // // Just OpenPose keypoint detector
-                        // poseExtractorsWs.at(i) = {std::make_shared<WPoseExtractorNet<TDatumsSP>>(
-                        //     poseExtractorNets.at(i))};
-                    }
-
-                    // // (Before tracking / id extractor)
-                    // // Added right after PoseExtractorNet to avoid:
-                    // // 1) Rendering people that are later deleted (wrong visualization).
-                    // // 2) Processing faces and hands on people that will be deleted (speed up).
-                    // if (wrapperStructPose.numberPeopleMax > 0)
-                    // {
-                    //     // Add KeepTopNPeople for each PoseExtractorNet
-                    //     const auto keepTopNPeople = std::make_shared<KeepTopNPeople>(
-                    //         wrapperStructPose.numberPeopleMax);
-                    //     for (auto& wPose : poseExtractorsWs)
-                    //         wPose.emplace_back(std::make_shared<WKeepTopNPeople<TDatumsSP>>(keepTopNPeople));
-                    // }
-                }
-                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-
-                // Pose renderer(s)
-                if (!poseGpuRenderers.empty())
-                {
-                    opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-                    for (auto i = 0u; i < poseExtractorsWs.size(); i++)
-                    {
-                        poseExtractorsWs.at(i).emplace_back(std::make_shared<WPoseRenderer<TDatumsSP>>(
-                            poseGpuRenderers.at(i)));
-                        // Get shared params
-                        if (!cvMatToOpOutputs.empty())
-                            poseGpuRenderers.at(i)->setSharedParameters(
-                                cvMatToOpOutputs.at(i)->getSharedParameters());
-                    }
-                }
-                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-
-                // Face extractor(s)
-                if (wrapperStructFace.enable)
-                {
-                    opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-                    // Face detector
-                    // OpenPose body-based face detector
-                    if (wrapperStructFace.detector == Detector::Body)
-                    {
-                        // Sanity check
-                        if (wrapperStructPose.poseMode == PoseMode::Disabled)
-                            error("Body keypoint detection is disabled but face Detector is set to Body. Either"
-                                  " re-enable OpenPose body or select a different face Detector (`--face_detector`).",
-                                  __LINE__, __FUNCTION__, __FILE__);
-                        // Constructors
-                        const auto faceDetector = std::make_shared<FaceDetector>(wrapperStructPose.poseModel);
-                        for (auto& wPose : poseExtractorsWs)
-                            wPose.emplace_back(std::make_shared<WFaceDetector<TDatumsSP>>(faceDetector));
-                    }
-                    // OpenCV face detector
-                    else if (wrapperStructFace.detector == Detector::OpenCV)
-                    {
-                        opLog("Body keypoint detection is disabled. Hence, using OpenCV face detector (much less"
-                            " accurate but faster).", Priority::High);
-                        for (auto& wPose : poseExtractorsWs)
-                        {
-                            // 1 FaceDetectorOpenCV per thread, OpenCV face detector is not thread-safe
-                            const auto faceDetectorOpenCV = std::make_shared<FaceDetectorOpenCV>(modelFolder);
-                            wPose.emplace_back(
-                                std::make_shared<WFaceDetectorOpenCV<TDatumsSP>>(faceDetectorOpenCV)
-                            );
-                        }
-                    }
-                    // If provided by user: We do not need to create a FaceDetector
-                    // Unknown face Detector
-                    else if (wrapperStructFace.detector != Detector::Provided)
-                        error("Unknown face Detector. Select a valid face Detector (`--face_detector`).",
-                              __LINE__, __FUNCTION__, __FILE__);
-                    // Face keypoint extractor
-                    for (auto gpu = 0u; gpu < poseExtractorsWs.size(); gpu++)
-                    {
-                        // Face keypoint extractor
-                        const auto netOutputSize = wrapperStructFace.netInputSize;
-                        const auto faceExtractorNet = std::make_shared<FaceExtractorCaffe>(
-                            wrapperStructFace.netInputSize, netOutputSize, modelFolder,
-                            gpu + gpuNumberStart, wrapperStructPose.heatMapTypes, wrapperStructPose.heatMapScaleMode,
-                            wrapperStructPose.enableGoogleLogging
-                        );
-                        faceExtractorNets.emplace_back(faceExtractorNet);
-                        poseExtractorsWs.at(gpu).emplace_back(
-                            std::make_shared<WFaceExtractorNet<TDatumsSP>>(faceExtractorNet));
-                    }
-                }
-                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-
-                // Hand extractor(s)
-                if (wrapperStructHand.enable)
-                {
-                    opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-                    const auto handDetector = std::make_shared<HandDetector>(wrapperStructPose.poseModel);
-                    for (auto gpu = 0u; gpu < poseExtractorsWs.size(); gpu++)
-                    {
-                        // Sanity check
-                        if ((wrapperStructHand.detector == Detector::BodyWithTracking
-                             || wrapperStructHand.detector == Detector::Body)
-                            && wrapperStructPose.poseMode == PoseMode::Disabled)
-                            error("Body keypoint detection is disabled but hand Detector is set to Body. Either"
-                                  " re-enable OpenPose body or select a different hand Detector (`--hand_detector`).",
-                                  __LINE__, __FUNCTION__, __FILE__);
-                        // Hand detector
-                        // OpenPose body-based hand detector with tracking
-                        if (wrapperStructHand.detector == Detector::BodyWithTracking)
-                        {
-                            poseExtractorsWs.at(gpu).emplace_back(
-                                std::make_shared<WHandDetectorTracking<TDatumsSP>>(handDetector));
-                        }
-                        // OpenPose body-based hand detector
-                        else if (wrapperStructHand.detector == Detector::Body)
-                        {
-                            poseExtractorsWs.at(gpu).emplace_back(
-                                std::make_shared<WHandDetector<TDatumsSP>>(handDetector));
-                        }
-                        // If provided by user: We do not need to create a FaceDetector
-                        // Unknown hand Detector
-                        else if (wrapperStructHand.detector != Detector::Provided)
-                            error("Unknown hand Detector. Select a valid hand Detector (`--hand_detector`).",
-                                  __LINE__, __FUNCTION__, __FILE__);
-                        // Hand keypoint extractor
-                        const auto netOutputSize = wrapperStructHand.netInputSize;
-                        const auto handExtractorNet = std::make_shared<HandExtractorCaffe>(
-                            wrapperStructHand.netInputSize, netOutputSize, modelFolder,
-                            gpu + gpuNumberStart, wrapperStructHand.scalesNumber, wrapperStructHand.scaleRange,
-                            wrapperStructPose.heatMapTypes, wrapperStructPose.heatMapScaleMode,
-                            wrapperStructPose.enableGoogleLogging
-                        );
-                        handExtractorNets.emplace_back(handExtractorNet);
-                        poseExtractorsWs.at(gpu).emplace_back(
-                            std::make_shared<WHandExtractorNet<TDatumsSP>>(handExtractorNet)
-                            );
-                        // If OpenPose body-based hand detector with tracking
-                        if (wrapperStructHand.detector == Detector::BodyWithTracking)
-                            poseExtractorsWs.at(gpu).emplace_back(
-                                std::make_shared<WHandDetectorUpdate<TDatumsSP>>(handDetector));
-                    }
-                }
-                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-
-                // Face renderer(s)
-                if (renderFace)
-                {
-                    opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-                    // CPU rendering
-                    if (renderModeFace == RenderMode::Cpu)
-                    {
-                        // Construct face renderer
-                        const auto faceRenderer = std::make_shared<FaceCpuRenderer>(
-                            wrapperStructFace.renderThreshold, wrapperStructFace.alphaKeypoint,
-                            wrapperStructFace.alphaHeatMap);
-                        // Add worker
-                        cpuRenderers.emplace_back(std::make_shared<WFaceRenderer<TDatumsSP>>(faceRenderer));
-                    }
-                    // GPU rendering
-                    else if (renderModeFace == RenderMode::Gpu)
-                    {
-                        for (auto i = 0u; i < poseExtractorsWs.size(); i++)
-                        {
-                            // Construct face renderer
-                            const auto faceRenderer = std::make_shared<FaceGpuRenderer>(
-                                wrapperStructFace.renderThreshold, wrapperStructFace.alphaKeypoint,
-                                wrapperStructFace.alphaHeatMap
-                            );
-                            // Performance boost -> share spGpuMemory for all renderers
-                            if (!poseGpuRenderers.empty())
-                            {
-                                // const bool isLastRenderer = !renderHandGpu;
-                                const bool isLastRenderer = !renderHandGpu && !(addCvMatToOpOutput && !addCvMatToOpOutputInCpu);
-                                const auto renderer = std::static_pointer_cast<PoseGpuRenderer>(
-                                    poseGpuRenderers.at(i));
-                                faceRenderer->setSharedParametersAndIfLast(
-                                    renderer->getSharedParameters(), isLastRenderer);
-                            }
-                            // Add worker
-                            poseExtractorsWs.at(i).emplace_back(
-                                std::make_shared<WFaceRenderer<TDatumsSP>>(faceRenderer));
-                        }
-                    }
-                    else
-                        error("Unknown RenderMode.", __LINE__, __FUNCTION__, __FILE__);
-                }
-                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-
-                // Hand renderer(s)
-                if (renderHand)
-                {
-                    opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-                    // CPU rendering
-                    if (renderModeHand == RenderMode::Cpu)
-                    {
-                        // Construct hand renderer
-                        const auto handRenderer = std::make_shared<HandCpuRenderer>(
-                            wrapperStructHand.renderThreshold, wrapperStructHand.alphaKeypoint,
-                            wrapperStructHand.alphaHeatMap);
-                        // Add worker
-                        cpuRenderers.emplace_back(std::make_shared<WHandRenderer<TDatumsSP>>(handRenderer));
-                    }
-                    // GPU rendering
-                    else if (renderModeHand == RenderMode::Gpu)
-                    {
-                        for (auto i = 0u; i < poseExtractorsWs.size(); i++)
-                        {
-                            // Construct hands renderer
-                            const auto handRenderer = std::make_shared<HandGpuRenderer>(
-                                wrapperStructHand.renderThreshold, wrapperStructHand.alphaKeypoint,
-                                wrapperStructHand.alphaHeatMap
-                            );
-                            // Performance boost -> share spGpuMemory for all renderers
-                            if (!poseGpuRenderers.empty())
-                            {
-                                // const bool isLastRenderer = true;
-                                const bool isLastRenderer = !(addCvMatToOpOutput && !addCvMatToOpOutputInCpu);
-                                const auto renderer = std::static_pointer_cast<PoseGpuRenderer>(
-                                    poseGpuRenderers.at(i));
-                                handRenderer->setSharedParametersAndIfLast(
-                                    renderer->getSharedParameters(), isLastRenderer);
-                            }
-                            // Add worker
-                            poseExtractorsWs.at(i).emplace_back(
-                                std::make_shared<WHandRenderer<TDatumsSP>>(handRenderer));
-                        }
-                    }
-                    else
-                        error("Unknown RenderMode.", __LINE__, __FUNCTION__, __FILE__);
-                }
-                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-
-                // Frames processor (OpenPose format -> cv::Mat format)
-                if (addCvMatToOpOutput && !addCvMatToOpOutputInCpu)
-                {
-                    // for (auto& poseExtractorsW : poseExtractorsWs)
-                    for (auto i = 0u ; i < poseExtractorsWs.size() ; ++i)
-                    {
-                        const auto gpuResize = true;
-                        opOutputToCvMats.emplace_back(std::make_shared<OpOutputToCvMat>(gpuResize));
-                        poseExtractorsWs.at(i).emplace_back(
-                            std::make_shared<WOpOutputToCvMat<TDatumsSP>>(opOutputToCvMats.back()));
-                        // Assign shared parameters
-                        opOutputToCvMats.back()->setSharedParameters(
-                            cvMatToOpOutputs.at(i)->getSharedParameters());
-                    }
-                }
+                // Pose estimators & renderers (1 std::vector<TWorker> per GPU thread)
+                wrapperPoseExtractors = createPoseExtractorsWs<TDatumsSP, TWorker>(
+                    wrapperStructPose, wrapperStructFace, wrapperStructHand, wrapperStructExtra, wrapperPoseLayout);
                 opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
 
                 // 3-D reconstruction
@@ -668,12 +870,22 @@ namespace op
                     opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
                     // For all (body/face/hands): PoseTriangulations ~30 msec, 8 GPUS ~30 msec for keypoint estimation
                     poseTriangulationsWs.resize(fastMax(1, int(poseExtractorsWs.size() / 4)));
+                    // 3-D guided 2-D refinement (shared by the input and all 3-D reconstruction threads)
+                    std::shared_ptr<PoseViewRefiner> poseViewRefiner;
+                    if (wrapperStructExtra.refinement3d > 0)
+                    {
+                        poseViewRefiner = std::make_shared<PoseViewRefiner>(wrapperStructExtra.refinement3d);
+                        poseViewRefinerCropW = std::make_shared<WPoseViewRefinerCrop<TDatumsSP>>(poseViewRefiner);
+                    }
                     for (auto i = 0u ; i < poseTriangulationsWs.size() ; i++)
                     {
                         const auto poseTriangulation = std::make_shared<PoseTriangulation>(
                             wrapperStructExtra.minViews3d);
                         poseTriangulationsWs.at(i) = {std::make_shared<WPoseTriangulation<TDatumsSP>>(
                             poseTriangulation)};
+                        if (poseViewRefiner != nullptr)
+                            poseTriangulationsWs.at(i).emplace_back(
+                                std::make_shared<WPoseViewRefinerUpdate<TDatumsSP>>(poseViewRefiner));
                     }
                 }
                 opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
@@ -687,11 +899,20 @@ namespace op
                 //         std::make_shared<WPersonIdExtractor<TDatumsSP>>(personIdExtractor)
                 //     );
                 // }
+                // Monocular 3-D lifting (floor position of each person)
+                if (wrapperStructExtra.groundPlane3d)
+                {
+                    opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                    const auto groundPlaneLifting = std::make_shared<GroundPlaneLifting>(
+                        wrapperStructPose.poseModel);
+                    postProcessingWs.emplace_back(
+                        std::make_shared<WGroundPlaneLifting<TDatumsSP>>(groundPlaneLifting));
+                }
                 // Frames processor (OpenPose format -> cv::Mat format)
                 if (addCvMatToOpOutputInCpu)
                 {
                     opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-                    postProcessingWs = mergeVectors(postProcessingWs, cpuRenderers);
+                    postProcessingWs = mergeVectors(postProcessingWs, wrapperPoseExtractors.cpuRenderers);
                     const auto opOutputToCvMat = std::make_shared<OpOutputToCvMat>();
                     postProcessingWs.emplace_back(std::make_shared<WOpOutputToCvMat<TDatumsSP>>(opOutputToCvMat));
                 }
@@ -723,13 +944,12 @@ namespace op
             {
                 opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
                 jointAngleEstimationsWs.resize(wrapperStructExtra.ikThreads);
-                // Pose extractor(s)
+                // Pose extractor(s) - A single JointAngleEstimation shared by all of them, so the last fit of each
+                // person is available to all of them
+                const auto jointAngleEstimation = std::make_shared<JointAngleEstimation>(displayAdam);
                 for (auto i = 0u; i < jointAngleEstimationsWs.size(); i++)
-                {
-                    const auto jointAngleEstimation = std::make_shared<JointAngleEstimation>(displayAdam);
                     jointAngleEstimationsWs.at(i) = {std::make_shared<WJointAngleEstimation<TDatumsSP>>(
                         jointAngleEstimation)};
-                }
             }
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
 #endif
@@ -746,23 +966,29 @@ namespace op
             }
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             // Send information (e.g., to Unity) though UDP client-server communication
-
 #ifdef USE_3D_ADAM_MODEL
-            if (!wrapperStructOutput.udpHost.empty() && !wrapperStructOutput.udpPort.empty())
+            const auto udpJointAngles = true;
+#else
+            const auto udpJointAngles = false;
+#endif
+            if (!wrapperStructOutput.udpHost.empty() && !wrapperStructOutput.udpPort.empty()
+                && (udpJointAngles || wrapperStructOutput.udpKeypoints))
             {
                 opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-                const auto udpSender = std::make_shared<UdpSender>(wrapperStructOutput.udpHost,
-                                                                   wrapperStructOutput.udpPort);
-                outputWs.emplace_back(std::make_shared<WUdpSender<TDatumsSP>>(udpSender));
+                const auto udpSender = std::make_shared<UdpSender>(
+                    wrapperStructOutput.udpHost.getStdString(), wrapperStructOutput.udpPort.getStdString());
+                const auto keypointResolution = (wrapperStructOutput.udpKeypoints
+                    ? (float)wrapperStructOutput.packedKeypointResolution : 0.f);
+                outputWs.emplace_back(std::make_shared<WUdpSender<TDatumsSP>>(udpSender, keypointResolution));
             }
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-#endif
             // Write people pose data on disk (json for OpenCV >= 3, xml, yml...)
             if (!writeKeypointCleaned.empty())
             {
                 opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-                const auto keypointSaver = std::make_shared<KeypointSaver>(writeKeypointCleaned,
-                                                                           wrapperStructOutput.writeKeypointFormat);
+                const auto keypointSaver = std::make_shared<KeypointSaver>(
+                    writeKeypointCleaned, wrapperStructOutput.writeKeypointFormat,
+                    (float)wrapperStructOutput.packedKeypointResolution);
                 outputWs.emplace_back(std::make_shared<WPoseSaver<TDatumsSP>>(keypointSaver));
                 if (wrapperStructFace.enable)
                     outputWs.emplace_back(std::make_shared<WFaceSaver<TDatumsSP>>(keypointSaver));
@@ -961,6 +1187,13 @@ namespace op
             TWorker wFpsMax;
             if (wrapperStructPose.fpsMax > 0.)
                 wFpsMax = std::make_shared<WFpsMax<TDatumsSP>>(wrapperStructPose.fpsMax);
+            // Elements modifiable at runtime
+            if (wrapperRuntimeHandles != nullptr)
+            {
+                wrapperRuntimeHandles->clear();
+                wrapperRuntimeHandles->spScaleAndSizeExtractor = scaleAndSizeExtractor;
+                wrapperPoseExtractors.setRuntimeHandles(*wrapperRuntimeHandles);
+            }
             // Set wrapper as configured
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
 
@@ -1012,6 +1245,8 @@ namespace op
             // Scale & cv::Mat to OP format
             if (scaleAndSizeExtractorW != nullptr)
                 workersAux = mergeVectors(workersAux, {scaleAndSizeExtractorW});
+            if (poseViewRefinerCropW != nullptr)
+                workersAux = mergeVectors(workersAux, {poseViewRefinerCropW});
             if (cvMatToOpInputW != nullptr)
                 workersAux = mergeVectors(workersAux, {cvMatToOpInputW});
             // cv::Mat to output format
@@ -1045,14 +1280,20 @@ namespace op
 
             // Pose estimation & rendering
             // Thread 1 or 2...X, queues 1 -> 2, X = 2 + #GPUs
+            std::vector<unsigned long long> poseThreadIds;
+            if (addedPoseExtractorsWs != nullptr)
+                addedPoseExtractorsWs->clear();
             if (!poseExtractorsWs.empty())
             {
                 if (multiThreadEnabled)
                 {
-                    for (auto& wPose : poseExtractorsWs)
+                    for (const auto& wPose : poseExtractorsWs)
                     {
                         opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
                         threadManager.add(threadId, wPose, queueIn, queueOut);
+                        poseThreadIds.emplace_back(threadId);
+                        if (addedPoseExtractorsWs != nullptr)
+                            addedPoseExtractorsWs->emplace_back(wPose);
                         threadIdPP(threadId, multiThreadEnabled);
                     }
                     queueIn++;
@@ -1074,6 +1315,9 @@ namespace op
                             " with the `--num_gpu_start` flag).", Priority::High);
                     opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
                     threadManager.add(threadId, poseExtractorsWs.at(0), queueIn++, queueOut++);
+                    poseThreadIds.emplace_back(threadId);
+                    if (addedPoseExtractorsWs != nullptr)
+                        addedPoseExtractorsWs->emplace_back(poseExtractorsWs.at(0));
                 }
             }
             // Assemble all frames from same time instant (3-D module)
@@ -1215,6 +1459,14 @@ namespace op
                 threadManager.add(threadId, wFpsMax, queueIn++, queueOut++);
                 threadIdPP(threadId, multiThreadEnabled);
             }
+            // Thread affinities (CPU cores, NUMA node and intra-op threads)
+            if (!wrapperStructExtra.threadAffinity.empty() || wrapperStructExtra.intraOpThreads != 0)
+            {
+                // Multi-threading: threadId has already been increased after the last thread
+                const auto numberThreads = (multiThreadEnabled ? threadId : 1ull);
+                threadManager.setThreadAffinities(
+                    getThreadAffinities(wrapperStructExtra, numberThreads, poseThreadIds));
+            }
         }
         catch (const std::exception& e)
         {
@@ -0,0 +1,55 @@
+#ifndef OPENPOSE_WRAPPER_WRAPPER_RUNTIME_HANDLES_HPP
+#define OPENPOSE_WRAPPER_WRAPPER_RUNTIME_HANDLES_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/core/keepTopNPeople.hpp>
+#include <openpose/core/renderer.hpp>
+#include <openpose/core/scaleAndSizeExtractor.hpp>
+#include <openpose/face/faceExtractorNet.hpp>
+#include <openpose/hand/handExtractorNet.hpp>
+#include <openpose/pose/poseExtractorNet.hpp>
+
+namespace op
+{
+    /**
+     * WrapperRuntimeHandles: Elements shared with the running Workers whose parameters can be modified at runtime
+     * (private internal struct). configureThreadManager fills it, and WrapperT::reconfigure uses it to apply the new
+     * parameters without re-creating the ThreadManager (and hence without re-loading the networks).
+     */
+    struct OP_API WrapperRuntimeHandles
+    {
+        /**
+         * Net input resolution and scales.
+         */
+        std::shared_ptr<ScaleAndSizeExtractor> spScaleAndSizeExtractor;
+
+        /**
+         * Maximum number of people (shared by all the GPU threads).
+         */
+        std::shared_ptr<KeepTopNPeople> spKeepTopNPeople;
+
+        /**
+         * Body pose renderers (CPU or 1 per GPU).
+         */
+        std::vector<std::shared_ptr<Renderer>> poseRenderers;
+
+        /**
+         * Body keypoint extractors (1 per GPU), empty if body was disabled on configuration. Only used to re-use
+         * their loaded networks when the GPU threads are re-created.
+         */
+        std::vector<std::shared_ptr<PoseExtractorNet>> poseExtractorNets;
+
+        /**
+         * Face and hand keypoint extractors (1 per GPU), empty if face/hand was disabled on configuration.
+         */
+        std::vector<std::shared_ptr<FaceExtractorNet>> faceExtractorNets;
+        std::vector<std::shared_ptr<HandExtractorNet>> handExtractorNets;
+
+        /**
+         * It releases all the elements.
+         */
+        void clear();
+    };
+}
+
+#endif // OPENPOSE_WRAPPER_WRAPPER_RUNTIME_HANDLES_HPP
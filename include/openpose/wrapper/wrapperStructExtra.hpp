@@ -46,6 +46,40 @@ namespace op
          */
         int ikThreads;
 
+        /**
+         * CPU affinity of the pipeline threads (thread ids as assigned by the WrapperT, where the pose extraction
+         * threads are the ones after the input thread(s)). By default (empty), threads are not pinned.
+         * Select "auto" to distribute the pose extraction threads (one per GPU or CPU instance) across the NUMA nodes
+         * (binding their memory allocations to that node), or a ';'-separated list of cores for each thread id in
+         * the Linux `cpulist` format (e.g., "0;1-7;8-15;16" for 4 threads, empty entries are not pinned), where the
+         * NUMA node of each thread is deduced from its cores.
+         * Note that exec() runs the last thread on the calling thread, so its affinity is modified too.
+         */
+        String threadAffinity;
+
+        /**
+         * Number of intra-operation threads (OpenMP/BLAS) of the inference engine for each pose extraction thread
+         * when running on CPU. 0 (default) keeps the library default, while -1 splits the CPU cores among the pose
+         * extraction threads after subtracting the rest of pipeline threads (to avoid oversubscription).
+         */
+        int intraOpThreads;
+
+        /**
+         * Whether to refine the 2-D detection of each view with the 3-D reconstruction (only if reconstruct3d).
+         * By default (0), it is disabled. If N > 0, the missing or low-confidence 2-D keypoints of each view are
+         * replaced by the reprojection of the 3-D keypoints, and the pose network of each view is only run on the
+         * region around that reprojection on the following frames, except once every N frames (where the whole
+         * image is processed in order to detect new people).
+         */
+        int refinement3d;
+
+        /**
+         * Whether to obtain the floor position of each person from a single camera (monocular 3-D lifting of the
+         * foot keypoints to the ground plane, see GroundPlaneLifting). Its camera matrix must be referred to the
+         * ground plane (see the calibration toolbox). Not compatible with reconstruct3d.
+         */
+        bool groundPlane3d;
+
         /**
          * Constructor of the struct.
          * It has the recommended and default values we recommend for each element of the struct.
@@ -53,7 +87,9 @@ namespace op
          */
         WrapperStructExtra(
             const bool reconstruct3d = false, const int minViews3d = -1, const bool identification = false,
-            const int tracking = -1, const int ikThreads = 0);
+            const int tracking = -1, const int ikThreads = 0, const String& threadAffinity = "",
+            const int intraOpThreads = 0, const int refinement3d = 0,
+            const bool groundPlane3d = false);
     };
 }
 
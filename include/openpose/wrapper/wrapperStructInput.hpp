@@ -91,6 +91,13 @@ namespace op
          */
         int numberViews;
 
+        /**
+         * Only for ProducerType::WatchFolder. What to do with each image once read: "" to keep it, "delete" to
+         * remove it, or a folder path to move it there.
+         * Default: "".
+         */
+        String watchDirectoryProcessed;
+
         /**
          * Constructor of the struct.
          * It has the recommended and default values we recommend for each element of the struct.
@@ -103,7 +110,8 @@ namespace op
             const bool realTimeProcessing = false, const bool frameFlip = false, const int frameRotate = 0,
             const bool framesRepeat = false, const Point<int>& cameraResolution = Point<int>{-1,-1},
             const String& cameraParameterPath = "models/cameraParameters/",
-            const bool undistortImage = false, const int numberViews = -1);
+            const bool undistortImage = false, const int numberViews = -1,
+            const String& watchDirectoryProcessed = "");
     };
 }
 
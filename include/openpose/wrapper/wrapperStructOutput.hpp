@@ -31,6 +31,7 @@ namespace op
          * Data format to save Pose (x, y, score) locations.
          * Options: DataFormat::Json (default), DataFormat::Xml and DataFormat::Yml (equivalent to DataFormat::Yaml)
          * JSON option only available for OpenCV >= 3.0.
+         * DataFormat::Bin saves the keypoints packed as int16 fixed-point coordinates (see packedKeypointResolution).
          */
         DataFormat writeKeypointFormat;
 
@@ -142,6 +143,17 @@ namespace op
          */
         String udpPort;
 
+        /**
+         * Resolution (steps per pixel) of the int16 fixed-point coordinates of the packed keypoints, used by
+         * DataFormat::Bin and udpKeypoints. See packKeypoints for more details.
+         */
+        double packedKeypointResolution;
+
+        /**
+         * Whether to send the packed keypoints of each frame through UDP (to udpHost and udpPort).
+         */
+        bool udpKeypoints;
+
         /**
          * Constructor of the struct.
          * It has the recommended and default values we recommend for each element of the struct.
@@ -157,7 +169,8 @@ namespace op
             const String& writeHeatMaps = "", const String& writeHeatMapsFormat = "png",
             const String& writeVideo3D = "", const String& writeVideoAdam = "",
             const String& writeBvh = "", const String& udpHost = "",
-            const String& udpPort = "8051");
+            const String& udpPort = "8051", const double packedKeypointResolution = 4.,
+            const bool udpKeypoints = false);
     };
 }
 
@@ -213,6 +213,14 @@ namespace op
          */
         bool enableGoogleLogging;
 
+        /**
+         * Whether to reduce the start-up latency of the Caffe networks.
+         * If true, the prototxts and trained models are loaded in parallel in background threads, their weights are
+         * memory-mapped from a binary cache next to the caffemodel (created in the first run) and the body, face and
+         * hand networks run a warm-up pass on initialization.
+         */
+        bool fastStartup;
+
         /**
          * Constructor of the struct.
          * It has the recommended and default values we recommend for each element of the struct.
@@ -231,7 +239,7 @@ namespace op
             const ScaleMode heatMapScaleMode = ScaleMode::UnsignedChar, const bool addPartCandidates = false,
             const float renderThreshold = 0.05f, const int numberPeopleMax = -1, const bool maximizePositives = false,
             const double fpsMax = -1., const String& protoTxtPath = "", const String& caffeModelPath = "",
-            const float upsamplingRatio = 0.f, const bool enableGoogleLogging = true);
+            const float upsamplingRatio = 0.f, const bool enableGoogleLogging = true, const bool fastStartup = false);
     };
 }
 
@@ -24,6 +24,7 @@
     #define CV_CAP_PROP_FRAME_HEIGHT cv::CAP_PROP_FRAME_HEIGHT
     #define CV_CAP_PROP_FRAME_WIDTH cv::CAP_PROP_FRAME_WIDTH
     #define CV_CAP_PROP_POS_FRAMES cv::CAP_PROP_POS_FRAMES
+    #define CV_CAP_PROP_POS_MSEC cv::CAP_PROP_POS_MSEC
     #define CV_FOURCC cv::VideoWriter::fourcc
     #define CV_GRAY2BGR cv::COLOR_GRAY2BGR
     #define CV_HAAR_SCALE_IMAGE cv::CASCADE_SCALE_IMAGE
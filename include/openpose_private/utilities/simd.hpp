@@ -0,0 +1,82 @@
+#ifndef OPENPOSE_PRIVATE_UTILITIES_SIMD_HPP
+#define OPENPOSE_PRIVATE_UTILITIES_SIMD_HPP
+
+// Warning:
+// This file contains the dispatch layer of the SIMD kernels, selected at runtime (see getCpuInstructionSet()).
+// This file should only be included from cpp files.
+// Default #include <openpose/headers.hpp> does not include it.
+
+#include <openpose/utilities/cpuFeatures.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define OP_SIMD_X86
+    #include <immintrin.h>
+    // Each kernel is compiled for its own instruction set (regardless of the compiler flags), and it must only be
+    // called if getCpuInstructionSet() supports it
+    #if defined(__GNUC__) || defined(__clang__)
+        #define OP_TARGET_SSE42 __attribute__((target("sse4.2")))
+        #define OP_TARGET_AVX2 __attribute__((target("avx2,fma")))
+        #define OP_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+    // MSVC does not need it, any intrinsic can be used in any function
+    #else
+        #define OP_TARGET_SSE42
+        #define OP_TARGET_AVX2
+        #define OP_TARGET_AVX512
+    #endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define OP_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+// Kernels only compiled for some architectures, nullptr otherwise (for selectCpuKernel)
+#ifdef OP_SIMD_X86
+    #define OP_X86_KERNEL(kernel) (&kernel)
+#else
+    #define OP_X86_KERNEL(kernel) nullptr
+#endif
+#ifdef OP_SIMD_NEON
+    #define OP_NEON_KERNEL(kernel) (&kernel)
+#else
+    #define OP_NEON_KERNEL(kernel) nullptr
+#endif
+
+namespace op
+{
+    // Not deduced from the arguments, so any of the kernels can be nullptr
+    template<typename T>
+    struct SimdKernelType
+    {
+        typedef T type;
+    };
+
+    /**
+     * It returns the kernel of the widest instruction set supported by the CPU (see getCpuInstructionSet()). Missing
+     * kernels (nullptr, e.g., not implemented or not compiled for the current architecture) fall back to the next
+     * narrower one, and ultimately to the scalar one.
+     * It should be called once (e.g., in a static variable), rather than each time the kernel is run. E.g.,
+     *     static const auto kernel = selectCpuKernel(
+     *         &kernelScalar, OP_X86_KERNEL(kernelSse42), OP_X86_KERNEL(kernelAvx2), OP_X86_KERNEL(kernelAvx512),
+     *         OP_NEON_KERNEL(kernelNeon));
+     */
+    template<typename TKernel>
+    TKernel selectCpuKernel(
+        const TKernel scalar, const typename SimdKernelType<TKernel>::type sse42,
+        const typename SimdKernelType<TKernel>::type avx2, const typename SimdKernelType<TKernel>::type avx512,
+        const typename SimdKernelType<TKernel>::type neon = nullptr)
+    {
+        const auto cpuInstructionSet = getCpuInstructionSet();
+        if (cpuInstructionSet == CpuInstructionSet::Avx512 && avx512 != nullptr)
+            return avx512;
+        if ((cpuInstructionSet == CpuInstructionSet::Avx512 || cpuInstructionSet == CpuInstructionSet::Avx2)
+            && avx2 != nullptr)
+            return avx2;
+        if ((cpuInstructionSet == CpuInstructionSet::Avx512 || cpuInstructionSet == CpuInstructionSet::Avx2
+             || cpuInstructionSet == CpuInstructionSet::Sse42) && sse42 != nullptr)
+            return sse42;
+        if (cpuInstructionSet == CpuInstructionSet::Neon && neon != nullptr)
+            return neon;
+        return scalar;
+    }
+}
+
+#endif // OPENPOSE_PRIVATE_UTILITIES_SIMD_HPP
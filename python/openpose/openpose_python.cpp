@@ -383,6 +383,7 @@ namespace op
             .def_readwrite("poseKeypoints3D", &Datum::poseKeypoints3D)
             .def_readwrite("faceKeypoints3D", &Datum::faceKeypoints3D)
             .def_readwrite("handKeypoints3D", &Datum::handKeypoints3D)
+            .def_readwrite("poseFloorPositions", &Datum::poseFloorPositions)
             .def_readwrite("cameraMatrix", &Datum::cameraMatrix)
             .def_readwrite("cameraExtrinsics", &Datum::cameraExtrinsics)
             .def_readwrite("cameraIntrinsics", &Datum::cameraIntrinsics)
@@ -1,14 +1,221 @@
 #include <openpose/3d/cameraParameterReader.hpp>
+#include <algorithm> // std::find, std::find_if
+#include <array>
+#include <cstdio> // std::remove
+#include <cstring> // std::memcmp, std::memcpy
 #include <openpose_private/utilities/openCvMultiversionHeaders.hpp> // OPEN_CV_IS_4_OR_HIGHER
 #ifdef OPEN_CV_IS_4_OR_HIGHER
     #include <opencv2/calib3d.hpp> // cv::initUndistortRectifyMap in OpenCV 4
 #endif
 #include <opencv2/imgproc/imgproc.hpp> // cv::initUndistortRectifyMap (OpenCV <= 3), cv::undistort
 #include <openpose/filestream/fileStream.hpp>
+#include <openpose/utilities/fileCache.hpp>
 #include <openpose/utilities/fileSystem.hpp>
 
 namespace op
 {
+    // Fast startup - Binary camera parameter bundle of the whole camera rig (1 per camera parameter folder)
+    // Format: CameraParameterBundleHeader + for each camera: [serial number size (uint64) + serial number, XML file
+    // size (int64) + modification time (int64, nanoseconds), 5 matrices (extrinsics, intrinsics, distortion, initial
+    // extrinsics, and camera matrix), #undistortion maps (uint64) + for each one: [width, height (2 x int32), map 1,
+    // map 2]].
+    // Each matrix is [rows, cols, type, 0 (4 x int32), data (aligned to CAMERA_PARAMETER_BUNDLE_ALIGNMENT bytes)].
+    const std::string CAMERA_PARAMETER_BUNDLE_FILE_NAME{"cameraParameters.opcache"};
+    const char CAMERA_PARAMETER_BUNDLE_MAGIC[8] = {'O', 'P', 'C', 'A', 'M', 'P', 'A', 'R'};
+    const unsigned int CAMERA_PARAMETER_BUNDLE_VERSION = 2u;
+    const size_t CAMERA_PARAMETER_BUNDLE_ALIGNMENT = 16;
+
+    struct CameraParameterBundleHeader
+    {
+        char magic[8];
+        unsigned int version;
+        unsigned int numberCameras;
+        unsigned long long payloadSize;
+        // getFileCacheChecksum() of the whole payload after the header
+        unsigned long long checksum;
+    };
+
+    struct UndistortionMaps
+    {
+        cv::Size imageSize;
+        cv::Mat map1;
+        cv::Mat map2;
+    };
+
+    struct CameraParameterBundleCamera
+    {
+        std::string serialNumber;
+        long long xmlFileSize;
+        long long xmlModificationTime;
+        std::array<cv::Mat, 5> matrices;
+        std::vector<UndistortionMaps> undistortionMaps;
+    };
+
+    // Returns nullptr if the bundle does not exist or is corrupted. The undistortion maps read from it point to its
+    // memory (no copy), so it must be kept alive while they are used.
+    std::shared_ptr<MappedFile> mapCameraParameterBundle(const std::string& bundlePath)
+    {
+        try
+        {
+            if (!existFile(bundlePath))
+                return nullptr;
+            auto bundleFile = std::make_shared<MappedFile>(bundlePath);
+            if (bundleFile->size() < sizeof(CameraParameterBundleHeader))
+                return nullptr;
+            // Check header and checksum
+            CameraParameterBundleHeader header;
+            std::memcpy(&header, bundleFile->data(), sizeof(CameraParameterBundleHeader));
+            const auto* const payloadPtr = bundleFile->data() + sizeof(CameraParameterBundleHeader);
+            if (std::memcmp(header.magic, CAMERA_PARAMETER_BUNDLE_MAGIC, sizeof(header.magic)) != 0
+                || header.version != CAMERA_PARAMETER_BUNDLE_VERSION
+                || header.payloadSize != bundleFile->size() - sizeof(CameraParameterBundleHeader)
+                || header.checksum != getFileCacheChecksum(payloadPtr, (size_t)header.payloadSize))
+            {
+                opLog("Invalid or corrupted camera parameter bundle, the XML files will be used instead: "
+                      + bundlePath, Priority::High);
+                return nullptr;
+            }
+            return bundleFile;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+
+    // Offsets are relative to the beginning of the file
+    const char* readFromCameraParameterBundle(
+        size_t& offset, const MappedFile& bundleFile, const size_t numberBytes, const size_t alignment = 1)
+    {
+        try
+        {
+            offset = alignment * ((offset + alignment - 1) / alignment);
+            if (offset > bundleFile.size() || numberBytes > bundleFile.size() - offset)
+                error("Unexpected end of the camera parameter bundle.", __LINE__, __FUNCTION__, __FILE__);
+            const auto* dataPtr = bundleFile.data() + offset;
+            offset += numberBytes;
+            return dataPtr;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+
+    template<typename T>
+    T readValueFromCameraParameterBundle(size_t& offset, const MappedFile& bundleFile)
+    {
+        try
+        {
+            T value;
+            std::memcpy(&value, readFromCameraParameterBundle(offset, bundleFile, sizeof(T)), sizeof(T));
+            return value;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return T{};
+        }
+    }
+
+    // The returned cv::Mat points to the bundle memory (no copy)
+    cv::Mat readMatrixFromCameraParameterBundle(size_t& offset, const MappedFile& bundleFile)
+    {
+        try
+        {
+            int matrixHeader[4];
+            std::memcpy(matrixHeader, readFromCameraParameterBundle(offset, bundleFile, sizeof(matrixHeader)),
+                        sizeof(matrixHeader));
+            const auto rows = matrixHeader[0];
+            const auto cols = matrixHeader[1];
+            const auto type = matrixHeader[2];
+            if (rows <= 0 || cols <= 0)
+                return cv::Mat();
+            const auto* dataPtr = readFromCameraParameterBundle(
+                offset, bundleFile, (size_t)rows * cols * CV_ELEM_SIZE(type), CAMERA_PARAMETER_BUNDLE_ALIGNMENT);
+            return cv::Mat(rows, cols, type, (void*)dataPtr);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return cv::Mat();
+        }
+    }
+
+    std::vector<CameraParameterBundleCamera> readCamerasFromCameraParameterBundle(const MappedFile& bundleFile)
+    {
+        try
+        {
+            CameraParameterBundleHeader header;
+            std::memcpy(&header, bundleFile.data(), sizeof(CameraParameterBundleHeader));
+            auto offset = sizeof(CameraParameterBundleHeader);
+            std::vector<CameraParameterBundleCamera> bundleCameras(header.numberCameras);
+            for (auto& bundleCamera : bundleCameras)
+            {
+                const auto serialNumberSize = readValueFromCameraParameterBundle<unsigned long long>(
+                    offset, bundleFile);
+                const auto* serialNumberPtr = readFromCameraParameterBundle(
+                    offset, bundleFile, (size_t)serialNumberSize);
+                bundleCamera.serialNumber = std::string(serialNumberPtr, (size_t)serialNumberSize);
+                bundleCamera.xmlFileSize = readValueFromCameraParameterBundle<long long>(offset, bundleFile);
+                bundleCamera.xmlModificationTime = readValueFromCameraParameterBundle<long long>(offset, bundleFile);
+                for (auto& matrix : bundleCamera.matrices)
+                    matrix = readMatrixFromCameraParameterBundle(offset, bundleFile);
+                bundleCamera.undistortionMaps.resize(
+                    (size_t)readValueFromCameraParameterBundle<unsigned long long>(offset, bundleFile));
+                for (auto& undistortionMaps : bundleCamera.undistortionMaps)
+                {
+                    undistortionMaps.imageSize.width = readValueFromCameraParameterBundle<int>(offset, bundleFile);
+                    undistortionMaps.imageSize.height = readValueFromCameraParameterBundle<int>(offset, bundleFile);
+                    undistortionMaps.map1 = readMatrixFromCameraParameterBundle(offset, bundleFile);
+                    undistortionMaps.map2 = readMatrixFromCameraParameterBundle(offset, bundleFile);
+                }
+            }
+            return bundleCameras;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    void appendToCameraParameterBundle(
+        std::vector<char>& payload, const void* const data, const size_t numberBytes, const size_t alignment = 1)
+    {
+        try
+        {
+            const auto offset = sizeof(CameraParameterBundleHeader) + payload.size();
+            const auto alignedOffset = alignment * ((offset + alignment - 1) / alignment);
+            payload.resize(payload.size() + (alignedOffset - offset) + numberBytes, 0);
+            if (numberBytes > 0)
+                std::memcpy(&payload[alignedOffset - sizeof(CameraParameterBundleHeader)], data, numberBytes);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    void appendMatrixToCameraParameterBundle(std::vector<char>& payload, const cv::Mat& cvMat)
+    {
+        try
+        {
+            const cv::Mat cvMatContinuous = (cvMat.isContinuous() ? cvMat : cvMat.clone());
+            const int matrixHeader[4]{cvMat.rows, cvMat.cols, cvMat.type(), 0};
+            appendToCameraParameterBundle(payload, matrixHeader, sizeof(matrixHeader));
+            appendToCameraParameterBundle(
+                payload, cvMatContinuous.data, cvMatContinuous.total() * cvMatContinuous.elemSize(),
+                CAMERA_PARAMETER_BUNDLE_ALIGNMENT);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     struct CameraParameterReader::ImplCameraParameterReader
     {
         std::vector<std::string> mSerialNumbers;
@@ -20,13 +227,182 @@ namespace op
 
         // Undistortion (optional)
         bool mUndistortImage;
-        std::vector<cv::Mat> mRemoveDistortionMaps1;
-        std::vector<cv::Mat> mRemoveDistortionMaps2;
+        // For each camera, 1 pair of maps per image resolution
+        std::vector<std::vector<UndistortionMaps>> mUndistortionMaps;
+
+        // Binary bundle (optional)
+        std::shared_ptr<MappedFile> spBundleFile;
 
         ImplCameraParameterReader(const bool undistortImage) :
             mUndistortImage{undistortImage}
         {
         }
+
+        // Returns false if the bundle does not exist, is corrupted, or is outdated w.r.t. the XML files
+        bool readBundle(const std::string& cameraParameterPath, const std::vector<std::string>& serialNumbers)
+        {
+            try
+            {
+                const auto bundlePath = cameraParameterPath + CAMERA_PARAMETER_BUNDLE_FILE_NAME;
+                const auto bundleFile = mapCameraParameterBundle(bundlePath);
+                if (bundleFile == nullptr)
+                    return false;
+                const auto bundleCameras = readCamerasFromCameraParameterBundle(*bundleFile);
+                // Desired cameras (all of them if serialNumbers is empty)
+                std::vector<std::string> bundleSerialNumbers;
+                for (const auto& bundleCamera : bundleCameras)
+                    bundleSerialNumbers.emplace_back(bundleCamera.serialNumber);
+                const auto& desiredSerialNumbers = (serialNumbers.empty() ? bundleSerialNumbers : serialNumbers);
+                std::vector<const CameraParameterBundleCamera*> desiredBundleCameras;
+                for (const auto& serialNumber : desiredSerialNumbers)
+                {
+                    const auto iterator = std::find(
+                        bundleSerialNumbers.begin(), bundleSerialNumbers.end(), serialNumber);
+                    // Camera not in the bundle or XML file modified after creating the bundle
+                    const auto xmlPath = cameraParameterPath + serialNumber + ".xml";
+                    const auto xmlFileSize = getFileSize(xmlPath);
+                    if (iterator == bundleSerialNumbers.end()
+                        || (xmlFileSize >= 0
+                            && (xmlFileSize != bundleCameras[iterator - bundleSerialNumbers.begin()].xmlFileSize
+                                || getLastModificationTime(xmlPath)
+                                    != bundleCameras[iterator - bundleSerialNumbers.begin()].xmlModificationTime)))
+                    {
+                        opLog("Outdated camera parameter bundle, the XML files will be used instead (re-generate it"
+                              " with CameraParameterReader::writeParameterBundle()): " + bundlePath, Priority::High);
+                        return false;
+                    }
+                    desiredBundleCameras.emplace_back(&bundleCameras[iterator - bundleSerialNumbers.begin()]);
+                }
+                // Load parameters
+                mSerialNumbers = desiredSerialNumbers;
+                mCameraExtrinsics.clear();
+                mCameraIntrinsics.clear();
+                mCameraDistortions.clear();
+                mCameraExtrinsicsInitial.clear();
+                mCameraMatrices.clear();
+                mUndistortionMaps.clear();
+                for (const auto* bundleCamera : desiredBundleCameras)
+                {
+                    // Deep copy of the (small) parameter matrices, so they are independent of the bundle
+                    mCameraExtrinsics.emplace_back(OP_CV2OPCONSTMAT(bundleCamera->matrices[0]).clone());
+                    mCameraIntrinsics.emplace_back(OP_CV2OPCONSTMAT(bundleCamera->matrices[1]).clone());
+                    mCameraDistortions.emplace_back(OP_CV2OPCONSTMAT(bundleCamera->matrices[2]).clone());
+                    mCameraExtrinsicsInitial.emplace_back(OP_CV2OPCONSTMAT(bundleCamera->matrices[3]).clone());
+                    mCameraMatrices.emplace_back(OP_CV2OPCONSTMAT(bundleCamera->matrices[4]).clone());
+                    // Undistortion maps used directly from the mapped bundle
+                    mUndistortionMaps.emplace_back(bundleCamera->undistortionMaps);
+                }
+                spBundleFile = bundleFile;
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return false;
+            }
+        }
+
+        // Only computed the first time for each camera and image resolution. Returned by value (the cv::Mat
+        // headers share the data) given that adding new resolutions can reallocate the std::vector
+        UndistortionMaps getUndistortionMaps(const unsigned int cameraIndex, const cv::Size& imageSize)
+        {
+            try
+            {
+                auto& cameraUndistortionMaps = mUndistortionMaps.at(cameraIndex);
+                const auto undistortionMapsIterator = std::find_if(
+                    cameraUndistortionMaps.begin(), cameraUndistortionMaps.end(),
+                    [&imageSize](const UndistortionMaps& undistortionMaps)
+                    {
+                        return undistortionMaps.imageSize == imageSize;
+                    });
+                if (undistortionMapsIterator != cameraUndistortionMaps.end())
+                    return *undistortionMapsIterator;
+                const auto cvCameraIntrinsics = OP_OP2CVCONSTMAT(mCameraIntrinsics.at(cameraIndex));
+                const auto cvCameraDistorsions = OP_OP2CVCONSTMAT(mCameraDistortions.at(cameraIndex));
+                UndistortionMaps undistortionMaps;
+                undistortionMaps.imageSize = imageSize;
+                // // Option a - 80 ms / 3 images
+                // // http://docs.opencv.org/2.4/modules/imgproc/doc/geometric_transformations.html#undistort
+                // cv::undistort(cvMatDistorted, mCvMats[i], cvCameraIntrinsics, cvCameraDistorsions);
+                // // In OpenCV 2.4, cv::undistort is exactly equal than cv::initUndistortRectifyMap
+                // (with CV_16SC2) + cv::remap (with LINEAR). I.e., opLog(cv::norm(cvMatMethod1-cvMatMethod2)) = 0.
+                // Option b - 15 ms / 3 images (LINEAR) or 25 ms (CUBIC)
+                // Distorsion removal - not required and more expensive (applied to the whole image instead of
+                // only to our interest points)
+                cv::initUndistortRectifyMap(
+                    cvCameraIntrinsics, cvCameraDistorsions, cv::Mat(),
+                    // cvCameraIntrinsics instead of cv::getOptimalNewCameraMatrix to
+                    // avoid black borders
+                    cvCameraIntrinsics,
+                    // #include <opencv2/calib3d/calib3d.hpp> for next line
+                    // cv::getOptimalNewCameraMatrix(cvCameraIntrinsics,
+                    //                               cvCameraDistorsions,
+                    //                               imageSize, 1,
+                    //                               imageSize, 0),
+                    imageSize,
+                    CV_16SC2, // Faster, less memory
+                    // CV_32FC1, // More accurate
+                    undistortionMaps.map1,
+                    undistortionMaps.map2);
+                cameraUndistortionMaps.emplace_back(undistortionMaps);
+                return undistortionMaps;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return UndistortionMaps{};
+            }
+        }
+
+        // Returns false if the bundle could not be written
+        bool writeBundle(const std::string& cameraParameterPath) const
+        {
+            try
+            {
+                CameraParameterBundleHeader header;
+                std::memcpy(header.magic, CAMERA_PARAMETER_BUNDLE_MAGIC, sizeof(header.magic));
+                header.version = CAMERA_PARAMETER_BUNDLE_VERSION;
+                header.numberCameras = (unsigned int)mSerialNumbers.size();
+                // Payload
+                std::vector<char> payload;
+                for (auto i = 0u ; i < mSerialNumbers.size() ; i++)
+                {
+                    const auto serialNumberSize = (unsigned long long)mSerialNumbers[i].size();
+                    appendToCameraParameterBundle(payload, &serialNumberSize, sizeof(serialNumberSize));
+                    appendToCameraParameterBundle(payload, mSerialNumbers[i].data(), mSerialNumbers[i].size());
+                    const auto xmlPath = cameraParameterPath + mSerialNumbers[i] + ".xml";
+                    const auto xmlFileSize = getFileSize(xmlPath);
+                    const auto xmlModificationTime = getLastModificationTime(xmlPath);
+                    appendToCameraParameterBundle(payload, &xmlFileSize, sizeof(xmlFileSize));
+                    appendToCameraParameterBundle(payload, &xmlModificationTime, sizeof(xmlModificationTime));
+                    for (const auto* opMatrices : {&mCameraExtrinsics, &mCameraIntrinsics, &mCameraDistortions,
+                                                   &mCameraExtrinsicsInitial, &mCameraMatrices})
+                        appendMatrixToCameraParameterBundle(payload, OP_OP2CVCONSTMAT(opMatrices->at(i)));
+                    const auto numberUndistortionMaps = (unsigned long long)mUndistortionMaps.at(i).size();
+                    appendToCameraParameterBundle(payload, &numberUndistortionMaps, sizeof(numberUndistortionMaps));
+                    for (const auto& undistortionMaps : mUndistortionMaps.at(i))
+                    {
+                        appendToCameraParameterBundle(
+                            payload, &undistortionMaps.imageSize.width, sizeof(undistortionMaps.imageSize.width));
+                        appendToCameraParameterBundle(
+                            payload, &undistortionMaps.imageSize.height, sizeof(undistortionMaps.imageSize.height));
+                        appendMatrixToCameraParameterBundle(payload, undistortionMaps.map1);
+                        appendMatrixToCameraParameterBundle(payload, undistortionMaps.map2);
+                    }
+                }
+                header.payloadSize = payload.size();
+                header.checksum = getFileCacheChecksum(payload.data(), payload.size());
+                return writeFileAtomically(
+                    cameraParameterPath + CAMERA_PARAMETER_BUNDLE_FILE_NAME,
+                    {std::make_pair((const char*)&header, sizeof(header)),
+                     std::make_pair((const char*)payload.data(), payload.size())});
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return false;
+            }
+        }
     };
 
     CameraParameterReader::CameraParameterReader() :
@@ -73,8 +449,7 @@ namespace op
             const Matrix opCameraMatrices = OP_CV2OPCONSTMAT(cvCameraMatrices);
             spImpl->mCameraMatrices.emplace_back(opCameraMatrices);
             // Undistortion Mats
-            spImpl->mRemoveDistortionMaps1.resize(getNumberCameras());
-            spImpl->mRemoveDistortionMaps2.resize(getNumberCameras());
+            spImpl->mUndistortionMaps.resize(getNumberCameras());
         }
         catch (const std::exception& e)
         {
@@ -88,14 +463,15 @@ namespace op
         try
         {
             // Serial numbers
-            if (serialNumbers.empty())
-            {
-                spImpl->mSerialNumbers = getFilesOnDirectory(cameraParameterPath, "xml");
-                for (auto& serialNumber : spImpl->mSerialNumbers)
-                    serialNumber = getFileNameNoExtension(serialNumber);
-            }
-            else
-                spImpl->mSerialNumbers = serialNumbers;
+            auto xmlSerialNumbers = getFilesOnDirectory(cameraParameterPath, "xml");
+            for (auto& serialNumber : xmlSerialNumbers)
+                serialNumber = getFileNameNoExtension(serialNumber);
+            spImpl->mSerialNumbers = (serialNumbers.empty() ? xmlSerialNumbers : serialNumbers);
+
+            // Fast startup - Binary bundle (if valid and up to date)
+            if (spImpl->readBundle(cameraParameterPath, spImpl->mSerialNumbers))
+                return;
+            spImpl->spBundleFile.reset();
 
             // Commong saving/loading
             const auto dataFormat = DataFormat::Xml;
@@ -151,8 +527,8 @@ namespace op
                 // opLog(cameraParameters.at(0));
             }
             // Undistortion Mats
-            spImpl->mRemoveDistortionMaps1.resize(getNumberCameras());
-            spImpl->mRemoveDistortionMaps2.resize(getNumberCameras());
+            spImpl->mUndistortionMaps.clear();
+            spImpl->mUndistortionMaps.resize(getNumberCameras());
             // // spImpl->mCameraMatrices
             // opLog("\nFull camera matrices:");
             // for (const auto& cvMat : spImpl->mCameraMatrices)
@@ -185,6 +561,31 @@ namespace op
         }
     }
 
+    void CameraParameterReader::writeParameterBundle(
+        const std::string& cameraParameterPath, const std::vector<Point<int>>& imageSizes)
+    {
+        try
+        {
+            // Whole camera rig
+            readParameters(cameraParameterPath);
+            // Undistortion maps
+            for (const auto& imageSize : imageSizes)
+                for (auto cameraIndex = 0u ; cameraIndex < getNumberCameras() ; cameraIndex++)
+                    spImpl->getUndistortionMaps(cameraIndex, cv::Size{imageSize.x, imageSize.y});
+            // Bundle
+            const auto bundlePath = cameraParameterPath + CAMERA_PARAMETER_BUNDLE_FILE_NAME;
+            if (spImpl->writeBundle(cameraParameterPath))
+                opLog("Camera parameter bundle written: " + bundlePath, Priority::High);
+            else
+                error("Camera parameter bundle could not be written (read-only folder?): " + bundlePath,
+                      __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     void CameraParameterReader::writeParameters(const std::string& cameraParameterPath) const
     {
         try
@@ -211,6 +612,8 @@ namespace op
                 cameraParameters.emplace_back(spImpl->mCameraExtrinsicsInitial[i]);
                 saveData(cameraParameters, cvMatNames, cameraParameterPath + spImpl->mSerialNumbers[i], dataFormat);
             }
+            // Binary bundle outdated (writeParameterBundle() must be called again to re-generate it)
+            std::remove((cameraParameterPath + CAMERA_PARAMETER_BUNDLE_FILE_NAME).c_str());
         }
         catch (const std::exception& e)
         {
@@ -341,49 +744,20 @@ namespace op
             if (spImpl->mUndistortImage)
             {
                 // Sanity check
-                if (spImpl->mRemoveDistortionMaps1.size() <= cameraIndex
-                    || spImpl->mRemoveDistortionMaps2.size() <= cameraIndex)
+                if (spImpl->mUndistortionMaps.size() <= cameraIndex)
                 {
-                    error("Variable cameraIndex is out of bounds, it should be smaller than spImpl->mRemoveDistortionMapsX.",
+                    error("Variable cameraIndex is out of bounds, it should be smaller than the number of cameras.",
                           __LINE__, __FUNCTION__, __FILE__);
                 }
-                // Only first time
-                if (spImpl->mRemoveDistortionMaps1[cameraIndex].empty()
-                    || spImpl->mRemoveDistortionMaps2[cameraIndex].empty())
-                {
-                    const auto cvCameraIntrinsics = OP_OP2CVCONSTMAT(spImpl->mCameraIntrinsics.at(0));
-                    const auto cvCameraDistorsions = OP_OP2CVCONSTMAT(spImpl->mCameraDistortions.at(0));
-                    //const auto imageSize = OP_OP2CVMAT(frame).size();
-                    cv::Size imageSize;
-                    OP_CONST_MAT_RETURN_FUNCTION(imageSize, frame, size()); // = frame.size();
-                    // // Option a - 80 ms / 3 images
-                    // // http://docs.opencv.org/2.4/modules/imgproc/doc/geometric_transformations.html#undistort
-                    // cv::undistort(cvMatDistorted, mCvMats[i], cvCameraIntrinsics, cvCameraDistorsions);
-                    // // In OpenCV 2.4, cv::undistort is exactly equal than cv::initUndistortRectifyMap
-                    // (with CV_16SC2) + cv::remap (with LINEAR). I.e., opLog(cv::norm(cvMatMethod1-cvMatMethod2)) = 0.
-                    // Option b - 15 ms / 3 images (LINEAR) or 25 ms (CUBIC)
-                    // Distorsion removal - not required and more expensive (applied to the whole image instead of
-                    // only to our interest points)
-                    cv::initUndistortRectifyMap(
-                        cvCameraIntrinsics, cvCameraDistorsions, cv::Mat(),
-                        // cvCameraIntrinsics instead of cv::getOptimalNewCameraMatrix to
-                        // avoid black borders
-                        cvCameraIntrinsics,
-                        // #include <opencv2/calib3d/calib3d.hpp> for next line
-                        // cv::getOptimalNewCameraMatrix(cvCameraIntrinsics,
-                        //                               cvCameraDistorsions,
-                        //                               imageSize, 1,
-                        //                               imageSize, 0),
-                        imageSize,
-                        CV_16SC2, // Faster, less memory
-                        // CV_32FC1, // More accurate
-                        spImpl->mRemoveDistortionMaps1[cameraIndex],
-                        spImpl->mRemoveDistortionMaps2[cameraIndex]);
-                }
+                cv::Size imageSize;
+                OP_CONST_MAT_RETURN_FUNCTION(imageSize, frame, size()); // = frame.size();
+                // Only computed the first time for each image resolution (or never if they were stored in the binary
+                // bundle)
+                const auto undistortionMaps = spImpl->getUndistortionMaps(cameraIndex, imageSize);
                 cv::Mat undistortedCvMat;
                 const cv::Mat cvFrame = OP_OP2CVCONSTMAT(frame);
                 cv::remap(cvFrame, undistortedCvMat,
-                          spImpl->mRemoveDistortionMaps1[cameraIndex], spImpl->mRemoveDistortionMaps2[cameraIndex],
+                          undistortionMaps.map1, undistortionMaps.map2,
                           // cv::INTER_NEAREST);
                           cv::INTER_LINEAR);
                           // cv::INTER_CUBIC);
@@ -5,5 +5,8 @@ namespace op
 #ifdef USE_3D_ADAM_MODEL
     DEFINE_TEMPLATE_DATUM(WJointAngleEstimation);
 #endif
+    DEFINE_TEMPLATE_DATUM(WGroundPlaneLifting);
     DEFINE_TEMPLATE_DATUM(WPoseTriangulation);
+    DEFINE_TEMPLATE_DATUM(WPoseViewRefinerCrop);
+    DEFINE_TEMPLATE_DATUM(WPoseViewRefinerUpdate);
 }
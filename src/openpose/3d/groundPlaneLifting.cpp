@@ -0,0 +1,118 @@
+#include <openpose/3d/groundPlaneLifting.hpp>
+#include <opencv2/core/core.hpp>
+#include <openpose/pose/poseParameters.hpp>
+
+namespace op
+{
+    std::vector<unsigned int> getFootBodyParts(const PoseModel poseModel)
+    {
+        try
+        {
+            // Heels and toes lie on the floor, ankles are only used if the model does not have them
+            std::vector<unsigned int> footBodyParts;
+            std::vector<unsigned int> ankleBodyParts;
+            for (const auto& bodyPart : getPoseBodyPartMapping(poseModel))
+            {
+                if (bodyPart.second.find("Heel") != std::string::npos
+                    || bodyPart.second.find("Toe") != std::string::npos)
+                    footBodyParts.emplace_back(bodyPart.first);
+                else if (bodyPart.second.find("Ankle") != std::string::npos)
+                    ankleBodyParts.emplace_back(bodyPart.first);
+            }
+            if (footBodyParts.empty())
+                footBodyParts = ankleBodyParts;
+            // Sanity check
+            if (footBodyParts.empty())
+                error("The selected pose model has no foot nor ankle keypoints.", __LINE__, __FUNCTION__, __FILE__);
+            return footBodyParts;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    GroundPlaneLifting::GroundPlaneLifting(const PoseModel poseModel, const float minConfidence) :
+        mFootBodyParts{getFootBodyParts(poseModel)},
+        mMinConfidence{minConfidence}
+    {
+    }
+
+    GroundPlaneLifting::~GroundPlaneLifting()
+    {
+    }
+
+    void GroundPlaneLifting::lift(
+        Array<float>& poseKeypoints3D, Array<float>& floorPositions, const Array<float>& poseKeypoints,
+        const Matrix& cameraMatrix) const
+    {
+        try
+        {
+            if (poseKeypoints.empty())
+            {
+                poseKeypoints3D.reset();
+                floorPositions.reset();
+                return;
+            }
+            // Sanity checks
+            if (cameraMatrix.empty())
+                error("Camera matrix was found empty during ground-plane lifting (`--3d_ground_plane`). Make sure"
+                      " `--camera_parameter_path` points to the XML file of the camera.",
+                      __LINE__, __FUNCTION__, __FILE__);
+            if (poseKeypoints.getSize(2) != 3)
+                error("poseKeypoints must be a {#people, #body parts, 3} array.", __LINE__, __FUNCTION__, __FILE__);
+            // Ground-plane homography (image --> floor): inverse of the camera matrix restricted to Z = 0
+            cv::Mat cvCameraMatrix;
+            OP_OP2CVCONSTMAT(cameraMatrix).convertTo(cvCameraMatrix, CV_64F);
+            cv::Mat floorToImage{3, 3, CV_64F};
+            cvCameraMatrix.colRange(0, 2).copyTo(floorToImage.colRange(0, 2));
+            cvCameraMatrix.col(3).copyTo(floorToImage.col(2));
+            cv::Mat imageToFloor;
+            if (cv::invert(floorToImage, imageToFloor) == 0.)
+                error("The camera matrix is not referred to a valid ground plane.", __LINE__, __FUNCTION__, __FILE__);
+            const auto* const h = imageToFloor.ptr<double>();
+            // Lift foot keypoints
+            const auto numberPeople = poseKeypoints.getSize(0);
+            const auto numberBodyParts = poseKeypoints.getSize(1);
+            poseKeypoints3D.reset({numberPeople, numberBodyParts, 4}, 0.f);
+            floorPositions.reset({numberPeople, 3}, 0.f);
+            for (auto person = 0 ; person < numberPeople ; person++)
+            {
+                auto* floorPositionPtr = &floorPositions[3*person];
+                auto numberLiftedKeypoints = 0;
+                for (const auto bodyPart : mFootBodyParts)
+                {
+                    const auto baseIndex = person*numberBodyParts + (int)bodyPart;
+                    const auto* const keypointPtr = &poseKeypoints[3*baseIndex];
+                    if (keypointPtr[2] >= mMinConfidence)
+                    {
+                        const auto x = keypointPtr[0];
+                        const auto y = keypointPtr[1];
+                        const auto w = h[6]*x + h[7]*y + h[8];
+                        // Ray not intersecting the floor in front of the camera (e.g., above the horizon)
+                        if (w <= 0.)
+                            continue;
+                        auto* keypoint3DPtr = &poseKeypoints3D[4*baseIndex];
+                        keypoint3DPtr[0] = float((h[0]*x + h[1]*y + h[2]) / w);
+                        keypoint3DPtr[1] = float((h[3]*x + h[4]*y + h[5]) / w);
+                        keypoint3DPtr[2] = 0.f;
+                        keypoint3DPtr[3] = keypointPtr[2];
+                        floorPositionPtr[0] += keypoint3DPtr[0];
+                        floorPositionPtr[1] += keypoint3DPtr[1];
+                        floorPositionPtr[2] += keypoint3DPtr[3];
+                        numberLiftedKeypoints++;
+                    }
+                }
+                // Floor position = average of the lifted keypoints
+                if (numberLiftedKeypoints > 0)
+                    for (auto i = 0 ; i < 3 ; i++)
+                        floorPositionPtr[i] /= numberLiftedKeypoints;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+}
@@ -1,5 +1,12 @@
 #ifdef USE_3D_ADAM_MODEL
 #include <openpose/3d/jointAngleEstimation.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
 #ifdef USE_3D_ADAM_MODEL
     #include <adam/FitToBody.h>
     #include <adam/totalmodel.h>
@@ -15,6 +22,33 @@ namespace op
         const int NUMBER_FOOT_KEYPOINTS = 3;
         // targetJoints: Only for Body, LHand, RHand. No Face, no Foot
         const int NUMBER_KEYPOINTS = 3*(NUMBER_BODY_KEYPOINTS + 2*NUMBER_HAND_KEYPOINTS);
+        // Warm start - The last fit of a person is only re-used if it is at most this number of frames old and its
+        // root (mid-hip) did not move more than this distance (in cm)
+        const unsigned long long WARM_START_MAX_FRAME_GAP = 5ull;
+        const double WARM_START_MAX_ROOT_DISPLACEMENT = 50.;
+        // Early termination - Adam_FastFit does not return the Ceres cost, so its change is measured by how much the
+        // solve moved the fit. If the last solve of a person barely changed any pose parameter or the translation (in
+        // cm), i.e., the warm start was already a minimum of the cost, and no target joint moved more than this
+        // distance (in cm) since then, the last fit is re-used instead of solving again
+        const double EARLY_TERMINATION_MAX_POSE_UPDATE = 1e-3;
+        const double EARLY_TERMINATION_MAX_TRANSLATION_UPDATE = 0.1;
+        const double EARLY_TERMINATION_MAX_JOINT_DISPLACEMENT = 0.5;
+
+        // Last fit of a person
+        struct AdamPersonFit
+        {
+            unsigned long long frameNumber;
+            smpl::SMPLParams frameParams;
+            // Whether the last solve barely changed the fit (i.e., it converged)
+            bool converged;
+            // Target joints of the last solved fit
+            Eigen::MatrixXd bodyJoints;
+            Eigen::MatrixXd lHandJoints;
+            Eigen::MatrixXd rHandJoints;
+            // Only filled if returnJacobian
+            Eigen::Matrix<double, Eigen::Dynamic, 1> vtVec;
+            Eigen::Matrix<double, Eigen::Dynamic, 1> j0Vec;
+        };
 
         const std::shared_ptr<const TotalModel> loadTotalModel(const std::string& mObjectPath,
                                                                const std::string& mGTotalModelPath,
@@ -43,6 +77,60 @@ namespace op
             }
         }
 
+        // Returns false if there is no recent enough fit of that person (i.e., the fit must be initialized)
+        bool getAdamPersonFit(AdamPersonFit& adamPersonFit, std::map<long long, AdamPersonFit>& adamPersonFits,
+                              std::mutex& adamPersonFitsMutex, const long long personId,
+                              const unsigned long long frameNumber, const Eigen::MatrixXd& bodyJoints)
+        {
+            try
+            {
+                std::lock_guard<std::mutex> lock{adamPersonFitsMutex};
+                // Remove people not seen recently
+                for (auto iterator = adamPersonFits.begin() ; iterator != adamPersonFits.end() ; )
+                {
+                    if (iterator->second.frameNumber + WARM_START_MAX_FRAME_GAP < frameNumber)
+                        iterator = adamPersonFits.erase(iterator);
+                    else
+                        iterator++;
+                }
+                const auto iterator = adamPersonFits.find(personId);
+                if (iterator == adamPersonFits.end()
+                    || iterator->second.frameNumber > frameNumber + WARM_START_MAX_FRAME_GAP)
+                    return false;
+                // Abrupt root displacement (e.g., a different person got that id) - Mid-hip is Adam joint 2
+                const auto& lastBodyJoints = iterator->second.bodyJoints;
+                if (bodyJoints.col(2).head<3>().any() && lastBodyJoints.col(2).head<3>().any()
+                    && (bodyJoints.col(2).head<3>() - lastBodyJoints.col(2).head<3>()).norm()
+                        > WARM_START_MAX_ROOT_DISPLACEMENT)
+                    return false;
+                adamPersonFit = iterator->second;
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return false;
+            }
+        }
+
+        void setAdamPersonFit(std::map<long long, AdamPersonFit>& adamPersonFits, std::mutex& adamPersonFitsMutex,
+                              const AdamPersonFit& adamPersonFit, const long long personId)
+        {
+            try
+            {
+                std::lock_guard<std::mutex> lock{adamPersonFitsMutex};
+                auto& lastAdamPersonFit = adamPersonFits[personId];
+                // Do not overwrite a more recent fit (processed by another thread)
+                if (lastAdamPersonFit.bodyJoints.size() == 0
+                    || lastAdamPersonFit.frameNumber <= adamPersonFit.frameNumber)
+                    lastAdamPersonFit = adamPersonFit;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+
         void updateKeypoint(Eigen::MatrixXd& targetJoint, const float* const poseKeypoint3D, const int part)
         {
             try
@@ -75,42 +163,322 @@ namespace op
 
             // Processing
             const bool mReturnJacobian;
-            bool mInitialized;
-
-            Eigen::MatrixXd mBodyJoints;
-            Eigen::MatrixXd mFaceJoints;
-            Eigen::MatrixXd mLHandJoints;
-            Eigen::MatrixXd mRHandJoints;
-            Eigen::MatrixXd mLFootJoints;
-            Eigen::MatrixXd mRFootJoints;
 
-            // Other parameters
-            smpl::SMPLParams mFrameParams;
+            // Last fit of each person (by person id). The JointAngleEstimation instance is shared by all the
+            // `--ik_threads`, given that consecutive frames can be processed by different threads
+            std::mutex mAdamPersonFitsMutex;
+            std::map<long long, AdamPersonFit> mAdamPersonFits;
 
             // Shared parameters
-            Eigen::Matrix<double, Eigen::Dynamic, 1> mVtVec;
-            Eigen::Matrix<double, Eigen::Dynamic, 1> mJ0Vec;
             const std::shared_ptr<const TotalModel> spTotalModel;
 
+            // Persistent worker pool fitting the people of each frame (created once rather than on every frame).
+            // The threads calling adamFastFit() also fit people, so hardware_concurrency - 1 workers are enough
+            std::vector<std::thread> mWorkerThreads;
+            std::mutex mWorkerMutex;
+            std::condition_variable mWorkerConditionVariable;
+            std::condition_variable mFinishedConditionVariable;
+            std::deque<std::function<void()>> mPendingFits;
+            bool mRunning;
+
             ImplJointAngleEstimation(const bool returnJacobian) :
                 mGTotalModelPath{"./model/adam_v1_plus2.json"},
                 mPcaPath{"./model/adam_blendshapes_348_delta_norm.json"},
                 mObjectPath{"./model/mesh_nofeet.obj"},
                 mCorrespondencePath{"./model/correspondences_nofeet.txt"},
                 mReturnJacobian{returnJacobian},
-                mInitialized{false},
-                mBodyJoints(5, NUMBER_BODY_KEYPOINTS),
-                mFaceJoints(5, NUMBER_FACE_KEYPOINTS),// (3, landmarks_face.size());
-                mLHandJoints(5, NUMBER_HAND_KEYPOINTS),// (3, HandModel::NUM_JOINTS);
-                mRHandJoints(5, NUMBER_HAND_KEYPOINTS),// (3, HandModel::NUM_JOINTS);
-                mLFootJoints(5, 3),// (3, 3);        // Heel, Toe
-                mRFootJoints(5, 3),// (3, 3);        // Heel, Toe
-                spTotalModel{loadTotalModel(mObjectPath, mGTotalModelPath, mPcaPath, mCorrespondencePath)}
+                spTotalModel{loadTotalModel(mObjectPath, mGTotalModelPath, mPcaPath, mCorrespondencePath)},
+                mRunning{true}
             {
+                try
+                {
+                    const auto numberWorkers = std::max(1u, std::thread::hardware_concurrency()) - 1u;
+                    for (auto i = 0u ; i < numberWorkers ; i++)
+                        mWorkerThreads.emplace_back(&ImplJointAngleEstimation::runWorker, this);
+                }
+                catch (const std::exception& e)
+                {
+                    stopWorkers();
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
+            }
+
+            ~ImplJointAngleEstimation()
+            {
+                try
+                {
+                    stopWorkers();
+                }
+                catch (const std::exception& e)
+                {
+                    errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
+            }
+
+            void stopWorkers()
+            {
+                try
+                {
+                    {
+                        const std::lock_guard<std::mutex> lock{mWorkerMutex};
+                        mRunning = false;
+                    }
+                    mWorkerConditionVariable.notify_all();
+                    for (auto& workerThread : mWorkerThreads)
+                        if (workerThread.joinable())
+                            workerThread.join();
+                    mWorkerThreads.clear();
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
+            }
+
+            // Each pending fit records its own errors, so the workers never throw
+            void runWorker()
+            {
+                while (true)
+                {
+                    std::function<void()> fit;
+                    {
+                        std::unique_lock<std::mutex> lock{mWorkerMutex};
+                        mWorkerConditionVariable.wait(lock, [this]{ return !mRunning || !mPendingFits.empty(); });
+                        if (mPendingFits.empty())
+                            return;
+                        fit = std::move(mPendingFits.front());
+                        mPendingFits.pop_front();
+                    }
+                    fit();
+                }
+            }
+
+            // It queues the fits and runs them on the pool and the calling thread, until all of them are finished
+            void runFits(std::vector<std::function<void()>>& fits)
+            {
+                try
+                {
+                    auto numberPendingFits = fits.size();
+                    {
+                        const std::lock_guard<std::mutex> lock{mWorkerMutex};
+                        for (auto& fit : fits)
+                            mPendingFits.emplace_back(
+                                [this, &fit, &numberPendingFits]()
+                                {
+                                    fit();
+                                    {
+                                        const std::lock_guard<std::mutex> lock{mWorkerMutex};
+                                        numberPendingFits--;
+                                    }
+                                    mFinishedConditionVariable.notify_all();
+                                });
+                    }
+                    mWorkerConditionVariable.notify_all();
+                    // The calling thread also runs pending fits (including the ones of other `--ik_threads`, which
+                    // are independent) while its own ones are not finished
+                    std::unique_lock<std::mutex> lock{mWorkerMutex};
+                    while (numberPendingFits > 0)
+                    {
+                        if (!mPendingFits.empty())
+                        {
+                            auto fit = std::move(mPendingFits.front());
+                            mPendingFits.pop_front();
+                            lock.unlock();
+                            fit();
+                            lock.lock();
+                        }
+                        else
+                            mFinishedConditionVariable.wait(lock);
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
             }
         #endif
     };
 
+    #ifdef USE_3D_ADAM_MODEL
+        void fitAdamPerson(Eigen::Matrix<double, 62, 3, Eigen::RowMajor>& adamPose,
+                           Eigen::Vector3d& adamTranslation,
+                           Eigen::Matrix<double, Eigen::Dynamic, 1>& vtVec,
+                           Eigen::Matrix<double, Eigen::Dynamic, 1>& j0Vec,
+                           Eigen::VectorXd& adamFacecoeffsExp,
+                           std::map<long long, AdamPersonFit>& adamPersonFits,
+                           std::mutex& adamPersonFitsMutex,
+                           const TotalModel& totalModel,
+                           const bool returnJacobian,
+                           const Array<float>& poseKeypoints3D,
+                           const Array<float>& faceKeypoints3D,
+                           const std::array<Array<float>, 2>& handKeypoints3D,
+                           const int person,
+                           const long long personId,
+                           const unsigned long long frameNumber)
+        {
+            try
+            {
+                // Reset to 0 all keypoints - Otherwise undefined behavior when fitting
+                // They are local to each fit, so several people can be fitted at the same time
+                Eigen::MatrixXd bodyJoints = Eigen::MatrixXd::Zero(5, NUMBER_BODY_KEYPOINTS);
+                Eigen::MatrixXd faceJoints = Eigen::MatrixXd::Zero(5, NUMBER_FACE_KEYPOINTS);
+                Eigen::MatrixXd lHandJoints = Eigen::MatrixXd::Zero(5, NUMBER_HAND_KEYPOINTS);
+                Eigen::MatrixXd rHandJoints = Eigen::MatrixXd::Zero(5, NUMBER_HAND_KEYPOINTS);
+                Eigen::MatrixXd lFootJoints = Eigen::MatrixXd::Zero(5, NUMBER_FOOT_KEYPOINTS); // Heel, Toe
+                Eigen::MatrixXd rFootJoints = Eigen::MatrixXd::Zero(5, NUMBER_FOOT_KEYPOINTS); // Heel, Toe
+                // Update body
+                for (auto part = 0 ; part < 19; part++)
+                    updateKeypoint(bodyJoints, &poseKeypoints3D[{person, part, 0}], mapOPToAdam(part));
+                // Update left/right hand
+                if (poseKeypoints3D.getSize(1) == 65)
+                {
+                    // Wrists
+                    updateKeypoint(lHandJoints, &poseKeypoints3D[{person, 7, 0}], 0);
+                    updateKeypoint(rHandJoints, &poseKeypoints3D[{person, 4, 0}], 0);
+                    // Left
+                    for (auto part = 0 ; part < 20; part++)
+                        updateKeypoint(lHandJoints, &poseKeypoints3D[{person, part+25, 0}], part+1);
+                    // Right
+                    for (auto part = 0 ; part < 20; part++)
+                        updateKeypoint(rHandJoints, &poseKeypoints3D[{person, part+25+20, 0}], part+1);
+                }
+                else
+                {
+                    for (auto hand = 0u ; hand < handKeypoints3D.size(); hand++)
+                        if (!handKeypoints3D.at(hand).empty() && person < handKeypoints3D[hand].getSize(0))
+                            for (auto part = 0 ; part < handKeypoints3D[hand].getSize(1); part++)
+                                updateKeypoint((hand == 0 ? lHandJoints : rHandJoints),
+                                               &handKeypoints3D[hand][{person, part, 0}],
+                                               part);
+                }
+                // Update Foot data
+                if (poseKeypoints3D.getSize(1) == 25)
+                {
+                    // Update LFoot
+                    for (auto adamPart = 0 ; adamPart < NUMBER_FOOT_KEYPOINTS; adamPart++)
+                        updateKeypoint(lFootJoints, &poseKeypoints3D[{person, adamPart + 19, 0}], adamPart);
+                    // Update RFoot
+                    for (auto adamPart = 0 ; adamPart < NUMBER_FOOT_KEYPOINTS; adamPart++)
+                        updateKeypoint(rFootJoints,
+                                       &poseKeypoints3D[{person, adamPart + 19 + NUMBER_FOOT_KEYPOINTS, 0}],
+                                       adamPart);
+                }
+                // Update Face data
+                const auto faceFound = !faceKeypoints3D.empty() && person < faceKeypoints3D.getSize(0);
+                if (faceFound)
+                    for (auto part = 0 ; part < NUMBER_FACE_KEYPOINTS; part++)
+                        updateKeypoint(faceJoints, &faceKeypoints3D[{person, part, 0}], part);
+                // Meters --> cm
+                bodyJoints *= 1e2;
+                lHandJoints *= 1e2;
+                rHandJoints *= 1e2;
+                faceJoints *= 1e2;
+                lFootJoints *= 1e2;
+                rFootJoints *= 1e2;
+
+                const bool freezeMissing = true;
+                const bool ceresDisplayReport = false;
+                // Warm start - Last fit of this person (from any of the `--ik_threads`)
+                AdamPersonFit adamPersonFit;
+                const auto warmStart = getAdamPersonFit(
+                    adamPersonFit, adamPersonFits, adamPersonFitsMutex, personId, frameNumber, bodyJoints);
+                auto& frameParams = adamPersonFit.frameParams;
+                // Early termination: If the last solve converged and the target joints barely moved since then, the
+                // last fit is directly re-used
+                const auto solve = !warmStart || !adamPersonFit.converged
+                    || (bodyJoints - adamPersonFit.bodyJoints).cwiseAbs().maxCoeff()
+                        > EARLY_TERMINATION_MAX_JOINT_DISPLACEMENT
+                    || (lHandJoints - adamPersonFit.lHandJoints).cwiseAbs().maxCoeff()
+                        > EARLY_TERMINATION_MAX_JOINT_DISPLACEMENT
+                    || (rHandJoints - adamPersonFit.rHandJoints).cwiseAbs().maxCoeff()
+                        > EARLY_TERMINATION_MAX_JOINT_DISPLACEMENT;
+                // Initialization (e.g., first frame or person lost)
+                if (!warmStart)
+                {
+                    // We make T-pose start with:
+                    // 1. Root translation similar to current 3-d location of the mid-hip
+                    // 2. x-orientation = 180, i.e., person standing up & looking to the camera
+                    // 3. Because otherwise, if we call Adam_FastFit_Initialize twice (e.g., if a new person appears),
+                    // it would use the latest ones from the last Adam_FastFit
+                    frameParams = smpl::SMPLParams{};
+                    frameParams.m_adam_t(0) = bodyJoints(0, 2);
+                    frameParams.m_adam_t(1) = bodyJoints(1, 2);
+                    frameParams.m_adam_t(2) = bodyJoints(2, 2);
+                    frameParams.m_adam_pose(0, 0) = 3.14159265358979323846264338327950288419716939937510582097494459;
+                    // Fit initialization
+                    // Adam_FastFit_Initialize only changes frameParams
+                    const auto multistageFitting = true;
+                    const auto handEnabled = !handKeypoints3D[0].empty() || !handKeypoints3D[1].empty()
+                        || poseKeypoints3D.getSize(1) == 65;
+                    const auto fitFaceExponents = faceFound;
+                    const auto fastSolver = true;
+                    Adam_FastFit_Initialize(totalModel, frameParams, bodyJoints, rFootJoints, lFootJoints,
+                                            rHandJoints, lHandJoints, faceJoints, freezeMissing, ceresDisplayReport,
+                                            multistageFitting, handEnabled, fitFaceExponents, fastSolver);
+                    adamPersonFit.converged = false;
+                    // The following 2 operations takes ~12 msec
+                    // They only depend on the shape coefficients, which are only modified by the initialization, so
+                    // they are re-used by the following (warm started) frames of this person
+                    if (returnJacobian)
+                    {
+                        adamPersonFit.vtVec = totalModel.m_meanshape
+                                            + totalModel.m_shapespace_u * frameParams.m_adam_coeffs;
+                        adamPersonFit.j0Vec = totalModel.J_mu_ + totalModel.dJdc_ * frameParams.m_adam_coeffs;
+                    }
+                }
+                // Other frames - Warm start from the last fit
+                // Adam_FastFit_Initialize is intentionally not called: its multi-stage fitting (global alignment,
+                // then body, then hands and face) is only needed to get close to the solution from the T-pose, which
+                // the last fit of the person already is. It is also the only one estimating the shape coefficients,
+                // so the shape of a person is kept from their initialization until they are lost
+                else if (solve)
+                {
+                    const Eigen::Matrix<double, 62, 3, Eigen::RowMajor> lastAdamPose = frameParams.m_adam_pose;
+                    const Eigen::Vector3d lastAdamTranslation = frameParams.m_adam_t;
+                    // Adam_FastFit only changes frameParams
+                    Adam_FastFit(totalModel, frameParams, bodyJoints, rFootJoints, lFootJoints, rHandJoints,
+                                 lHandJoints, faceJoints, ceresDisplayReport);
+                    adamPersonFit.converged =
+                        (frameParams.m_adam_pose - lastAdamPose).cwiseAbs().maxCoeff()
+                            <= EARLY_TERMINATION_MAX_POSE_UPDATE
+                        && (frameParams.m_adam_t - lastAdamTranslation).cwiseAbs().maxCoeff()
+                            <= EARLY_TERMINATION_MAX_TRANSLATION_UPDATE;
+                    // Jacobians computed after the Adam_FastFit_Initialize call of this person (if returnJacobian)
+                    if (returnJacobian && adamPersonFit.vtVec.size() == 0)
+                    {
+                        adamPersonFit.vtVec = totalModel.m_meanshape
+                                            + totalModel.m_shapespace_u * frameParams.m_adam_coeffs;
+                        adamPersonFit.j0Vec = totalModel.J_mu_ + totalModel.dJdc_ * frameParams.m_adam_coeffs;
+                    }
+                }
+                if (returnJacobian)
+                {
+                    vtVec = adamPersonFit.vtVec;
+                    j0Vec = adamPersonFit.j0Vec;
+                }
+                // Warm start - Save fit for the next frames. The target joints are only updated if solved, so the
+                // early termination threshold is not accumulated over frames
+                adamPersonFit.frameNumber = frameNumber;
+                if (solve)
+                {
+                    adamPersonFit.bodyJoints = bodyJoints;
+                    adamPersonFit.lHandJoints = lHandJoints;
+                    adamPersonFit.rHandJoints = rHandJoints;
+                }
+                setAdamPersonFit(adamPersonFits, adamPersonFitsMutex, adamPersonFit, personId);
+                adamPose = frameParams.m_adam_pose;
+                adamTranslation = frameParams.m_adam_t;
+                adamFacecoeffsExp = frameParams.m_adam_facecoeffs_exp;
+                // // Not used anymore
+                // frameParams.mouth_open, frameParams.reye_open, frameParams.leye_open, frameParams.dist_root_foot
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+    #endif
+
     int mapOPToAdam(const int oPPart)
     {
         if (oPPart >= 0 && oPPart < 19)
@@ -211,14 +579,18 @@ namespace op
     {
     }
 
-    void JointAngleEstimation::adamFastFit(Eigen::Matrix<double, 62, 3, Eigen::RowMajor>& adamPose,
-                                           Eigen::Vector3d& adamTranslation,
-                                           Eigen::Matrix<double, Eigen::Dynamic, 1>& vtVec,
-                                           Eigen::Matrix<double, Eigen::Dynamic, 1>& j0Vec,
-                                           Eigen::VectorXd& adamFacecoeffsExp,
-                                           const Array<float>& poseKeypoints3D,
-                                           const Array<float>& faceKeypoints3D,
-                                           const std::array<Array<float>, 2>& handKeypoints3D)
+    void JointAngleEstimation::adamFastFit(
+        std::vector<Eigen::Matrix<double, 62, 3, Eigen::RowMajor>,
+                    Eigen::aligned_allocator<Eigen::Matrix<double, 62, 3, Eigen::RowMajor>>>& adamPoses,
+        std::vector<Eigen::Vector3d>& adamTranslations,
+        Eigen::Matrix<double, Eigen::Dynamic, 1>& vtVec,
+        Eigen::Matrix<double, Eigen::Dynamic, 1>& j0Vec,
+        std::vector<Eigen::VectorXd>& adamFaceCoeffsExps,
+        const Array<float>& poseKeypoints3D,
+        const Array<float>& faceKeypoints3D,
+        const std::array<Array<float>, 2>& handKeypoints3D,
+        const Array<long long>& poseIds,
+        const unsigned long long frameNumber)
     {
         try
         {
@@ -227,151 +599,56 @@ namespace op
                 error("Only working for BODY_19 or BODY_25 (#parts = "
                       + std::to_string(poseKeypoints3D.getSize(2)) + ").",
                       __LINE__, __FUNCTION__, __FILE__);
-            // Shorter naming
-            auto& frameParams = spImpl->mFrameParams;
+            const auto numberPeople = (poseKeypoints3D.empty() ? 0 : poseKeypoints3D.getSize(0));
+            adamPoses.resize(numberPeople);
+            adamTranslations.resize(numberPeople);
+            adamFaceCoeffsExps.resize(numberPeople);
             // If keypoints detected
-            if (!poseKeypoints3D.empty())
+            if (numberPeople > 0)
             {
-                // Reset to 0 all keypoints - Otherwise undefined behavior when fitting
-                // It must be done on every iteration, otherwise errors, e.g., if face
-                // was detected in frame i-1 but not in i
-                spImpl->mBodyJoints.setZero();
-                spImpl->mFaceJoints.setZero();
-                spImpl->mLHandJoints.setZero();
-                spImpl->mRHandJoints.setZero();
-                spImpl->mLFootJoints.setZero();
-                spImpl->mRFootJoints.setZero();
-                // Update body
-                for (auto part = 0 ; part < 19; part++)
-                    updateKeypoint(spImpl->mBodyJoints,
-                                   &poseKeypoints3D[{0, part, 0}],
-                                   mapOPToAdam(part));
-                // Update left/right hand
-                if (poseKeypoints3D.getSize(1) == 65)
-                {
-                    // Wrists
-                    updateKeypoint(spImpl->mLHandJoints,
-                                   &poseKeypoints3D[{0, 7, 0}],
-                                   0);
-                    updateKeypoint(spImpl->mRHandJoints,
-                                   &poseKeypoints3D[{0, 4, 0}],
-                                   0);
-                    // Left
-                    for (auto part = 0 ; part < 20; part++)
-                        updateKeypoint(spImpl->mLHandJoints,
-                                       &poseKeypoints3D[{0, part+25, 0}],
-                                       part+1);
-                    // Right
-                    for (auto part = 0 ; part < 20; part++)
-                        updateKeypoint(spImpl->mRHandJoints,
-                                       &poseKeypoints3D[{0, part+25+20, 0}],
-                                       part+1);
-                }
-                else
-                {
-                    for (auto hand = 0u ; hand < handKeypoints3D.size(); hand++)
-                        if (!handKeypoints3D.at(hand).empty())
-                            for (auto part = 0 ; part < handKeypoints3D[hand].getSize(1); part++)
-                                updateKeypoint((hand == 0 ? spImpl->mLHandJoints : spImpl->mRHandJoints),
-                                               &handKeypoints3D[hand][{0, part, 0}],
-                                               part);
-                }
-                // Update Foot data
-                if (poseKeypoints3D.getSize(1) == 25)
-                {
-                    // Update LFoot
-                    for (auto adamPart = 0 ; adamPart < NUMBER_FOOT_KEYPOINTS; adamPart++)
-                        updateKeypoint(spImpl->mLFootJoints,
-                                       &poseKeypoints3D[{0, adamPart + 19, 0}],
-                                       adamPart);
-                    // Update RFoot
-                    for (auto adamPart = 0 ; adamPart < NUMBER_FOOT_KEYPOINTS; adamPart++)
-                        updateKeypoint(spImpl->mRFootJoints,
-                                       &poseKeypoints3D[{0, adamPart + 19 + NUMBER_FOOT_KEYPOINTS, 0}],
-                                       adamPart);
-                }
-                // Update Face data
-                if (!faceKeypoints3D.empty())
-                    for (auto part = 0 ; part < NUMBER_FACE_KEYPOINTS; part++)
-                        updateKeypoint(spImpl->mFaceJoints,
-                                       &faceKeypoints3D[{0, part, 0}],
-                                       part);
-                // Meters --> cm
-                spImpl->mBodyJoints *= 1e2;
-                if (!handKeypoints3D.at(0).empty() || poseKeypoints3D.getSize(1) == 65)
-                    spImpl->mLHandJoints *= 1e2;
-                if (!handKeypoints3D.at(1).empty() || poseKeypoints3D.getSize(1) == 65)
-                    spImpl->mRHandJoints *= 1e2;
-                if (!faceKeypoints3D.empty())
-                    spImpl->mFaceJoints *= 1e2;
-                spImpl->mLFootJoints *= 1e2;
-                spImpl->mRFootJoints *= 1e2;
-
-                // Initialization (e.g., first frame)
-                const bool fastVersion = false;
-                const bool freezeMissing = true;
-                const bool ceresDisplayReport = false;
-                // Fill Datum
-                if (!spImpl->mInitialized || !fastVersion)
+                // Each person is fitted on a different thread of the worker pool (the calling one included). Ceres
+                // runs single-threaded on each fit, so the people are fitted as fast as a single one if there are
+                // enough cores
+                std::atomic<bool> failed{false};
+                std::mutex errorMutex;
+                std::string errorMessage;
+                std::vector<std::function<void()>> fits(numberPeople);
+                for (auto person = 0 ; person < numberPeople ; person++)
                 {
-                    if (!spImpl->mInitialized)
+                    fits[person] = [&, person]()
                     {
-                        frameParams.m_adam_t(0) = spImpl->mBodyJoints(0, 2);
-                        frameParams.m_adam_t(1) = spImpl->mBodyJoints(1, 2);
-                        frameParams.m_adam_t(2) = spImpl->mBodyJoints(2, 2);
-                        frameParams.m_adam_pose(0, 0) = 3.14159265358979323846264338327950288419716939937510582097494459;
-                        spImpl->mInitialized = true;
-                    }
-                    // We make T-pose start with:
-                    // 1. Root translation similar to current 3-d location of the mid-hip
-                    // 2. x-orientation = 180, i.e., person standing up & looking to the camera
-                    // 3. Because otherwise, if we call Adam_FastFit_Initialize twice (e.g., if a new person appears),
-                    // it would use the latest ones from the last Adam_FastFit
-                    // Fit initialization
-                    // Adam_FastFit_Initialize only changes frameParams
-                    const auto multistageFitting = true;
-                    const auto handEnabled = !handKeypoints3D[0].empty() || !handKeypoints3D[1].empty()
-                        || poseKeypoints3D.getSize(1) == 65;
-                    const auto fitFaceExponents = !faceKeypoints3D.empty();
-                    const auto fastSolver = true;
-                    Adam_FastFit_Initialize(*spImpl->spTotalModel, frameParams, spImpl->mBodyJoints, spImpl->mRFootJoints,
-                                            spImpl->mLFootJoints, spImpl->mRHandJoints, spImpl->mLHandJoints,
-                                            spImpl->mFaceJoints, freezeMissing, ceresDisplayReport,
-                                            multistageFitting, handEnabled, fitFaceExponents, fastSolver);
-                    // The following 2 operations takes ~12 msec
-                    if (spImpl->mReturnJacobian)
-                    {
-                        vtVec = spImpl->spTotalModel->m_meanshape
-                              + spImpl->spTotalModel->m_shapespace_u * frameParams.m_adam_coeffs;
-                        j0Vec = spImpl->spTotalModel->J_mu_ + spImpl->spTotalModel->dJdc_ * frameParams.m_adam_coeffs;
-                        if (fastVersion)
+                        try
                         {
-                            spImpl->mVtVec = vtVec;
-                            spImpl->mJ0Vec = j0Vec;
+                            // Once a fit failed, the remaining ones of this frame are skipped
+                            if (failed)
+                                return;
+                            // Without person ids, people are matched by their index (negative to not collide with
+                            // actual ids), and the root displacement check discards mismatches
+                            const auto personId = (person < (int)poseIds.getVolume()
+                                ? poseIds[person] : -1ll - (long long)person);
+                            // Jacobians only returned for the first person
+                            Eigen::Matrix<double, Eigen::Dynamic, 1> personVtVec;
+                            Eigen::Matrix<double, Eigen::Dynamic, 1> personJ0Vec;
+                            fitAdamPerson(
+                                adamPoses[person], adamTranslations[person],
+                                (person == 0 ? vtVec : personVtVec), (person == 0 ? j0Vec : personJ0Vec),
+                                adamFaceCoeffsExps[person], spImpl->mAdamPersonFits, spImpl->mAdamPersonFitsMutex,
+                                *spImpl->spTotalModel, spImpl->mReturnJacobian && person == 0, poseKeypoints3D,
+                                faceKeypoints3D, handKeypoints3D, person, personId, frameNumber);
                         }
-                    }
-                }
-                // Other frames if fastVersion
-                else // if (spImpl->mInitialized && fastVersion)
-                {
-                    // Adam_FastFit only changes frameParams
-                    Adam_FastFit(*spImpl->spTotalModel, frameParams, spImpl->mBodyJoints, spImpl->mRFootJoints,
-                                 spImpl->mLFootJoints, spImpl->mRHandJoints, spImpl->mLHandJoints,
-                                 spImpl->mFaceJoints, ceresDisplayReport);
-                    if (spImpl->mReturnJacobian)
-                    {
-                        vtVec = spImpl->mVtVec;
-                        j0Vec = spImpl->mJ0Vec;
-                    }
+                        catch (const std::exception& e)
+                        {
+                            const std::lock_guard<std::mutex> lock{errorMutex};
+                            if (errorMessage.empty())
+                                errorMessage = e.what();
+                            failed = true;
+                        }
+                    };
                 }
-                adamPose = frameParams.m_adam_pose;
-                adamTranslation = frameParams.m_adam_t;
-                adamFacecoeffsExp = frameParams.m_adam_facecoeffs_exp;
-                // // Not used anymore
-                // frameParams.mouth_open, frameParams.reye_open, frameParams.leye_open, frameParams.dist_root_foot
+                spImpl->runFits(fits);
+                if (!errorMessage.empty())
+                    error(errorMessage, __LINE__, __FUNCTION__, __FILE__);
             }
-            else
-                spImpl->mInitialized = false;
         }
         catch (const std::exception& e)
         {
@@ -3,27 +3,68 @@
     #include <ceres/ceres.h>
     #include <ceres/rotation.h>
 #endif
+#include <numeric> // std::accumulate
 #include <opencv2/calib3d/calib3d.hpp>
 #include <openpose/utilities/fastMath.hpp>
 
 namespace op
 {
-    double calcReprojectionError(const cv::Mat& reconstructedPoint, const std::vector<cv::Mat>& cameraMatrices,
-                                 const std::vector<cv::Point2d>& pointsOnEachCamera)
+    // Minimum gap between the 2 smallest eigenvalues of the normal matrix (relative to the largest one) to trust its
+    // eigenvectors. The condition number of A^T*A is the square of the one of A, so below it the DLT solution is
+    // obtained from the SVD of A itself
+    const auto NORMAL_MATRIX_MIN_RELATIVE_GAP = 1e-8;
+
+    // Copy of the 3x4 camera matrices in a single contiguous buffer (12 doubles per camera), so the batched
+    // operations below do not deal with the cv::Mat overhead
+    void getFlatCameraMatrices(std::vector<double>& flatCameraMatrices, const std::vector<cv::Mat>& cameraMatrices)
     {
         try
         {
-            auto averageError = 0.;
+            flatCameraMatrices.resize(12*cameraMatrices.size());
             for (auto i = 0u ; i < cameraMatrices.size() ; i++)
             {
-                cv::Mat imageX = cameraMatrices[i] * reconstructedPoint;
-                imageX /= imageX.at<double>(2,0);
-                const auto error = std::sqrt(std::pow(imageX.at<double>(0,0) -  pointsOnEachCamera[i].x,2)
-                                             + std::pow(imageX.at<double>(1,0) - pointsOnEachCamera[i].y,2));
-                // opLog("Error: " + std::to_string(error));
-                averageError += error;
+                if (cameraMatrices[i].type() != CV_64F || cameraMatrices[i].total() != 12
+                    || !cameraMatrices[i].isContinuous())
+                    error("Camera matrices must be continuous 3x4 CV_64F matrices.", __LINE__, __FUNCTION__, __FILE__);
+                std::copy((double*)cameraMatrices[i].data, (double*)cameraMatrices[i].data + 12,
+                          &flatCameraMatrices[12*i]);
             }
-            return averageError / cameraMatrices.size();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    // Reprojection error of a 3-D point (x, y, z) for each camera, written into errors[camera]. Branch-free and on
+    // contiguous memory, so the compiler can vectorize it
+    void calcReprojectionErrors(
+        double* const errors, const double* const point, const double* const flatCameraMatrices,
+        const cv::Point2d* const pointsOnEachCamera, const int numberCameras)
+    {
+        for (auto i = 0 ; i < numberCameras ; i++)
+        {
+            const auto* const P = &flatCameraMatrices[12*i];
+            const auto x = P[0]*point[0] + P[1]*point[1] + P[2]*point[2] + P[3];
+            const auto y = P[4]*point[0] + P[5]*point[1] + P[6]*point[2] + P[7];
+            const auto z = P[8]*point[0] + P[9]*point[1] + P[10]*point[2] + P[11];
+            const auto xError = x/z - pointsOnEachCamera[i].x;
+            const auto yError = y/z - pointsOnEachCamera[i].y;
+            errors[i] = std::sqrt(xError*xError + yError*yError);
+        }
+    }
+
+    double calcReprojectionError(const cv::Mat& reconstructedPoint, const std::vector<cv::Mat>& cameraMatrices,
+                                 const std::vector<cv::Point2d>& pointsOnEachCamera)
+    {
+        try
+        {
+            std::vector<double> flatCameraMatrices;
+            getFlatCameraMatrices(flatCameraMatrices, cameraMatrices);
+            std::vector<double> errors(cameraMatrices.size());
+            calcReprojectionErrors(errors.data(), (double*)reconstructedPoint.data, flatCameraMatrices.data(),
+                                   pointsOnEachCamera.data(), (int)cameraMatrices.size());
+            return std::accumulate(errors.begin(), errors.end(), 0.) / cameraMatrices.size();
         }
         catch (const std::exception& e)
         {
@@ -32,6 +73,91 @@ namespace op
         }
     }
 
+    // The 2 rows that each camera adds to the homogeneous DLT system Ax = 0, i.e., x*P.row(2) - P.row(0) and
+    // y*P.row(2) - P.row(1). Each row is normalized to unit length (normalized DLT), so all cameras and both image
+    // axes are equally weighted regardless of their pixel coordinates and camera matrix scales
+    void getDltRows(double* const dltRows, const double* const cameraMatrix, const cv::Point2d& pointOnCamera)
+    {
+        for (auto j = 0 ; j < 4 ; j++)
+        {
+            dltRows[j] = pointOnCamera.x*cameraMatrix[8+j] - cameraMatrix[j];
+            dltRows[4+j] = pointOnCamera.y*cameraMatrix[8+j] - cameraMatrix[4+j];
+        }
+        for (auto row = 0 ; row < 2 ; row++)
+        {
+            auto* const dltRow = &dltRows[4*row];
+            const auto norm = std::sqrt(dltRow[0]*dltRow[0] + dltRow[1]*dltRow[1] + dltRow[2]*dltRow[2]
+                                        + dltRow[3]*dltRow[3]);
+            if (norm > 0.)
+                for (auto j = 0 ; j < 4 ; j++)
+                    dltRow[j] /= norm;
+        }
+    }
+
+    // Rank-2 update (sign = 1) or downdate (sign = -1) of the normal matrix A^T*A with the DLT rows of 1 camera
+    void updateNormalMatrix(cv::Matx44d& normalMatrix, const double* const dltRows, const double sign)
+    {
+        for (auto j = 0 ; j < 4 ; j++)
+            for (auto k = 0 ; k < 4 ; k++)
+                normalMatrix(j,k) += sign * (dltRows[j]*dltRows[k] + dltRows[4+j]*dltRows[4+k]);
+    }
+
+    // Solution of Ax = 0 (with |x| = 1), i.e., the eigenvector of A^T*A with the smallest eigenvalue (equivalent to
+    // the SVD of A, but only 4x4 regardless of the number of cameras). Normalized so point[3] = 1.
+    // The columns of A are first scaled to unit norm (so the world units, e.g., mm vs. m, do not worsen the
+    // conditioning), and the SVD of A (built from the dltRows of all cameras but excludedCamera) is used instead if
+    // the 2 smallest eigenvalues cannot be told apart.
+    void solveNormalMatrix(
+        double* const point, const cv::Matx44d& normalMatrix, const double* const dltRows, const int numberCameras,
+        const int excludedCamera = -1)
+    {
+        try
+        {
+            // Column scaling, i.e., A*D with D = diag(1/|A.col(j)|)
+            double scales[4];
+            for (auto j = 0 ; j < 4 ; j++)
+                scales[j] = (normalMatrix(j,j) > 0. ? 1. / std::sqrt(normalMatrix(j,j)) : 1.);
+            cv::Matx44d scaledNormalMatrix;
+            for (auto j = 0 ; j < 4 ; j++)
+                for (auto k = 0 ; k < 4 ; k++)
+                    scaledNormalMatrix(j,k) = normalMatrix(j,k) * scales[j] * scales[k];
+            cv::Matx41d eigenvalues;
+            cv::Matx44d eigenvectors;
+            // Eigenvalues in descending order
+            cv::eigen(scaledNormalMatrix, eigenvalues, eigenvectors);
+            double scaledPoint[4];
+            if (eigenvalues(2) - eigenvalues(3) > NORMAL_MATRIX_MIN_RELATIVE_GAP * eigenvalues(0))
+                for (auto j = 0 ; j < 4 ; j++)
+                    scaledPoint[j] = eigenvectors(3,j);
+            // Nearly degenerate (e.g., almost parallel rays) --> SVD of A (last right singular vector)
+            else
+            {
+                cv::Mat dltMatrix(2*(numberCameras - (excludedCamera < 0 ? 0 : 1)), 4, CV_64F);
+                auto* dltMatrixPtr = (double*)dltMatrix.data;
+                for (auto i = 0 ; i < numberCameras ; i++)
+                {
+                    if (i == excludedCamera)
+                        continue;
+                    for (auto j = 0 ; j < 8 ; j++)
+                        *dltMatrixPtr++ = dltRows[8*i+j] * scales[j%4];
+                }
+                cv::Mat singularValues, u, vt;
+                cv::SVD::compute(dltMatrix, singularValues, u, vt, cv::SVD::MODIFY_A | cv::SVD::FULL_UV);
+                for (auto j = 0 ; j < 4 ; j++)
+                    scaledPoint[j] = vt.at<double>(3,j);
+            }
+            for (auto j = 0 ; j < 4 ; j++)
+                point[j] = scaledPoint[j] * scales[j];
+            for (auto j = 0 ; j < 3 ; j++)
+                point[j] /= point[3];
+            point[3] = 1.;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     #ifdef USE_CERES
         // Nonlinear Optimization for 3D Triangulation
         struct ReprojectionErrorForTriangulation
@@ -129,20 +255,20 @@ namespace op
             if (cameraMatrices.empty())
                 error("numberCameras.empty()",
                       __LINE__, __FUNCTION__, __FILE__);
-            // Create and fill A for homogenous equation system Ax = 0
+            // Fill the normal matrix A^T*A of the homogenous equation system Ax = 0
             const auto numberCameras = (int)cameraMatrices.size();
-            cv::Mat A = cv::Mat::zeros(numberCameras*2, 4, CV_64F);
+            std::vector<double> flatCameraMatrices;
+            getFlatCameraMatrices(flatCameraMatrices, cameraMatrices);
+            cv::Matx44d normalMatrix = cv::Matx44d::zeros();
+            std::vector<double> dltRows(8*numberCameras);
             for (auto i = 0 ; i < numberCameras ; i++)
             {
-                A.rowRange(i*2, i*2+1) = pointsOnEachCamera[i].x*cameraMatrices[i].rowRange(2,3)
-                                       - cameraMatrices[i].rowRange(0,1);
-                A.rowRange(i*2+1, i*2+2) = pointsOnEachCamera[i].y*cameraMatrices[i].rowRange(2,3)
-                                         - cameraMatrices[i].rowRange(1,2);
+                getDltRows(&dltRows[8*i], &flatCameraMatrices[12*i], pointsOnEachCamera[i]);
+                updateNormalMatrix(normalMatrix, &dltRows[8*i], 1.);
             }
-            // Solve x for Ax = 0 --> SVD on A
-            cv::SVD svd{A};
-            svd.solveZ(A,reconstructedPoint);
-            reconstructedPoint /= reconstructedPoint.at<double>(3);
+            // Solve x for Ax = 0
+            reconstructedPoint.create(4, 1, CV_64F);
+            solveNormalMatrix((double*)reconstructedPoint.data, normalMatrix, dltRows.data(), numberCameras);
 
             return calcReprojectionError(reconstructedPoint, cameraMatrices, pointsOnEachCamera);
         }
@@ -173,44 +299,78 @@ namespace op
             //     - Speed: triangulate ~0.01 ms vs. optimization ~0.2 ms
             //     - Accuracy: initial reprojection error ~14-21, reduced ~5% with non-linear optimization
 
+            // Sanity checks
+            if (cameraMatrices.size() != pointsOnEachCamera.size())
+                error("numberCameras.size() != pointsOnEachCamera.size() (" + std::to_string(cameraMatrices.size())
+                      + " vs. " + std::to_string(pointsOnEachCamera.size()) + ").",
+                      __LINE__, __FUNCTION__, __FILE__);
+            if (cameraMatrices.empty())
+                error("numberCameras.empty()",
+                      __LINE__, __FUNCTION__, __FILE__);
+
             // Basic triangulation
-            auto projectionError = triangulate(reconstructedPoint, cameraMatrices, pointsOnEachCamera);
+            // Normal matrix A^T*A accumulated once, so the leave-one-out solutions below are rank-2 downdates of it
+            const auto numberCameras = (int)cameraMatrices.size();
+            std::vector<double> flatCameraMatrices;
+            getFlatCameraMatrices(flatCameraMatrices, cameraMatrices);
+            std::vector<double> dltRows(8*numberCameras);
+            cv::Matx44d normalMatrix = cv::Matx44d::zeros();
+            for (auto i = 0 ; i < numberCameras ; i++)
+            {
+                getDltRows(&dltRows[8*i], &flatCameraMatrices[12*i], pointsOnEachCamera[i]);
+                updateNormalMatrix(normalMatrix, &dltRows[8*i], 1.);
+            }
+            reconstructedPoint.create(4, 1, CV_64F);
+            solveNormalMatrix((double*)reconstructedPoint.data, normalMatrix, dltRows.data(), numberCameras);
+            std::vector<double> reprojectionErrors(numberCameras);
+            calcReprojectionErrors(reprojectionErrors.data(), (double*)reconstructedPoint.data,
+                                   flatCameraMatrices.data(), pointsOnEachCamera.data(), numberCameras);
+            auto projectionError = std::accumulate(reprojectionErrors.begin(), reprojectionErrors.end(), 0.)
+                                 / numberCameras;
 
             // Basic RANSAC (for >= 4 cameras if the reprojection error is higher than usual)
             // 1. Run with all cameras (already done)
             // 2. Run with all but 1 camera for each camera.
             // 3. Use the one with minimum average reprojection error.
+            // All the leave-one-out solutions are obtained by removing the DLT rows of that camera from the shared
+            // normal matrix (4x4 eigen-decomposition each, rather than re-building and decomposing A), and their
+            // reprojection errors are evaluated in a single batch.
             // Note: Meant to be used for up to 7-8 views. With more than that, it might not improve much.
             // Set initial values
             auto cameraMatricesFinal = cameraMatrices;
             auto pointsOnEachCameraFinal = pointsOnEachCamera;
-            if (cameraMatrices.size() >= 4
+            if (numberCameras >= 4
                 && projectionError > 0.5 * reprojectionMaxAcceptable
                 /*&& projectionError < 1.5 * reprojectionMaxAcceptable*/)
             {
+                // Leave-one-out solutions (without camera i)
+                std::vector<double> pointsSubset(4*numberCameras);
+                for (auto i = 0 ; i < numberCameras ; i++)
+                {
+                    auto normalMatrixSubset = normalMatrix;
+                    updateNormalMatrix(normalMatrixSubset, &dltRows[8*i], -1.);
+                    solveNormalMatrix(&pointsSubset[4*i], normalMatrixSubset, dltRows.data(), numberCameras, i);
+                }
+                // Reprojection errors of all the solutions for all the cameras
+                std::vector<double> reprojectionErrorsSubset(numberCameras*numberCameras);
+                for (auto i = 0 ; i < numberCameras ; i++)
+                    calcReprojectionErrors(&reprojectionErrorsSubset[numberCameras*i], &pointsSubset[4*i],
+                                           flatCameraMatrices.data(), pointsOnEachCamera.data(), numberCameras);
                 // Find best projection
                 auto bestReprojection = projectionError;
                 auto bestReprojectionIndex = -1; // -1 means with all camera views
-                cv::Mat bestReconstructedPoint;
-                for (auto i = 0u; i < cameraMatrices.size(); ++i)
+                for (auto i = 0 ; i < numberCameras ; i++)
                 {
-                    // Set initial values
-                    auto cameraMatricesSubset = cameraMatrices;
-                    auto pointsOnEachCameraSubset = pointsOnEachCamera;
-                    // Remove camera i
-                    cameraMatricesSubset.erase(cameraMatricesSubset.begin() + i);
-                    pointsOnEachCameraSubset.erase(pointsOnEachCameraSubset.begin() + i);
-                    // Get new triangulation results
-                    cv::Mat reconstructedPointSubset;
-                    const auto projectionErrorSubset = triangulate(
-                        reconstructedPointSubset, cameraMatricesSubset, pointsOnEachCameraSubset);
+                    // Average over the cameras used for that solution (i.e., all but camera i)
+                    const auto* const errors = &reprojectionErrorsSubset[numberCameras*i];
+                    const auto projectionErrorSubset = (std::accumulate(errors, errors + numberCameras, 0.)
+                                                        - errors[i]) / (numberCameras - 1);
                     // If projection doesn't change much, this point is inlier (or all points are bad)
                     // Thus, save new best results only if considerably better
                     if (bestReprojection > projectionErrorSubset && projectionErrorSubset < 0.9*projectionError)
                     {
                         bestReprojection = projectionErrorSubset;
                         bestReprojectionIndex = i;
-                        bestReconstructedPoint = reconstructedPointSubset;
                     }
                 }
                 // Remove noisy camera
@@ -220,7 +380,8 @@ namespace op
                     cameraMatricesFinal.erase(cameraMatricesFinal.begin() + bestReprojectionIndex);
                     pointsOnEachCameraFinal.erase(pointsOnEachCameraFinal.begin() + bestReprojectionIndex);
                     // Update reconstructedPoint & projectionError
-                    reconstructedPoint = bestReconstructedPoint;
+                    std::copy(&pointsSubset[4*bestReprojectionIndex], &pointsSubset[4*bestReprojectionIndex] + 4,
+                              (double*)reconstructedPoint.data);
                     projectionError = bestReprojection;
                 }
             }
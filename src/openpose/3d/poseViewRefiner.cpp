@@ -0,0 +1,155 @@
+#include <openpose/3d/poseViewRefiner.hpp>
+#include <cmath> // std::ceil
+#include <limits> // std::numeric_limits
+#include <opencv2/core/core.hpp>
+#include <openpose/utilities/fastMath.hpp>
+#include <openpose/utilities/openCv.hpp>
+
+namespace op
+{
+    // Cropping is not worth it (and the net would be reshaped more often) if the region covers most of the image
+    const auto MAX_CROP_AREA_RATIO = 0.75f;
+    // Net input sizes are rounded up to multiples of 64 (rather than 16) to reduce the number of net reshapes
+    const auto NET_INPUT_SIZE_STEP = 64;
+
+    PoseViewRefiner::PoseViewRefiner(const int fullFrameInterval, const float minConfidence, const float cropMargin) :
+        mFullFrameInterval{(unsigned long long)fastMax(1, fullFrameInterval)},
+        mMinConfidence{minConfidence},
+        mCropMargin{cropMargin}
+    {
+    }
+
+    PoseViewRefiner::~PoseViewRefiner()
+    {
+    }
+
+    void PoseViewRefiner::setNetInputRectangle(
+        Rectangle<int>& netInputRectangle, std::vector<Point<int>>& netInputSizes,
+        std::vector<double>& scaleInputToNetInputs, const Point<int>& imageSize, const int view,
+        const unsigned long long frameId)
+    {
+        try
+        {
+            // Sanity check
+            if (scaleInputToNetInputs.size() != netInputSizes.size())
+                error("scaleInputToNetInputs.size() != netInputSizes.size().", __LINE__, __FUNCTION__, __FILE__);
+            netInputRectangle = Rectangle<int>{};
+            // Whole image every mFullFrameInterval frames
+            if (frameId % mFullFrameInterval == 0 || view < 0)
+                return;
+            // Get recent prediction (if any)
+            Rectangle<int> predictedRectangle;
+            {
+                const std::lock_guard<std::mutex> lock{mMutex};
+                if ((unsigned int)view < mPredictedRectangles.size())
+                {
+                    const auto& prediction = mPredictedRectangles[view];
+                    if (prediction.first <= frameId && frameId - prediction.first <= mFullFrameInterval)
+                        predictedRectangle = prediction.second;
+                }
+            }
+            if (predictedRectangle.area() < 1
+                || predictedRectangle.area() > MAX_CROP_AREA_RATIO * imageSize.area())
+                return;
+            // Net input size(s) adapted to the region, keeping the original scale(s) (i.e., person size in pixels)
+            const Point<int> rectangleSize{predictedRectangle.width, predictedRectangle.height};
+            for (auto i = 0u ; i < netInputSizes.size() ; i++)
+            {
+                const auto scale = scaleInputToNetInputs[i];
+                const Point<int> netInputSize{
+                    fastMin(netInputSizes[i].x, NET_INPUT_SIZE_STEP
+                        * positiveIntRound(std::ceil(scale * rectangleSize.x / NET_INPUT_SIZE_STEP))),
+                    fastMin(netInputSizes[i].y, NET_INPUT_SIZE_STEP
+                        * positiveIntRound(std::ceil(scale * rectangleSize.y / NET_INPUT_SIZE_STEP)))};
+                netInputSizes[i] = netInputSize;
+                scaleInputToNetInputs[i] = resizeGetScaleFactor(rectangleSize, netInputSize);
+            }
+            netInputRectangle = predictedRectangle;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    void PoseViewRefiner::refine(
+        Array<float>& poseKeypoints, const Array<float>& poseKeypoints3D, const Matrix& cameraMatrix,
+        const Point<int>& imageSize, const int view, const unsigned long long frameId)
+    {
+        try
+        {
+            if (view < 0)
+                return;
+            // Reproject 3-D keypoints into this view
+            Rectangle<int> predictedRectangle;
+            if (!poseKeypoints3D.empty() && !cameraMatrix.empty())
+            {
+                const cv::Mat cvCameraMatrix = OP_OP2CVCONSTMAT(cameraMatrix);
+                const auto numberBodyParts = poseKeypoints3D.getSize(1);
+                const auto channel3DLength = poseKeypoints3D.getSize(2);
+                // Missing keypoints only replaced for the first person, as done by PoseTriangulation
+                const auto fillKeypoints = (!poseKeypoints.empty() && poseKeypoints.getSize(1) == numberBodyParts);
+                auto minX = std::numeric_limits<float>::max();
+                auto minY = std::numeric_limits<float>::max();
+                auto maxX = std::numeric_limits<float>::lowest();
+                auto maxY = std::numeric_limits<float>::lowest();
+                for (auto part = 0 ; part < numberBodyParts ; part++)
+                {
+                    const auto* const keypoint3DPtr = &poseKeypoints3D[part*channel3DLength];
+                    if (keypoint3DPtr[3] > 0.f)
+                    {
+                        double xyw[3];
+                        for (auto row = 0 ; row < 3 ; row++)
+                            xyw[row] = cvCameraMatrix.at<double>(row, 0) * keypoint3DPtr[0]
+                                     + cvCameraMatrix.at<double>(row, 1) * keypoint3DPtr[1]
+                                     + cvCameraMatrix.at<double>(row, 2) * keypoint3DPtr[2]
+                                     + cvCameraMatrix.at<double>(row, 3);
+                        // Behind the camera
+                        if (xyw[2] <= 0.)
+                            continue;
+                        const auto x = float(xyw[0] / xyw[2]);
+                        const auto y = float(xyw[1] / xyw[2]);
+                        minX = fastMin(minX, x);
+                        minY = fastMin(minY, y);
+                        maxX = fastMax(maxX, x);
+                        maxY = fastMax(maxY, y);
+                        // Replace missing or low-confidence keypoint
+                        if (fillKeypoints && x >= 0.f && y >= 0.f && x <= imageSize.x-1 && y <= imageSize.y-1)
+                        {
+                            auto* keypointPtr = &poseKeypoints[3*part];
+                            if (keypointPtr[2] < mMinConfidence)
+                            {
+                                keypointPtr[0] = x;
+                                keypointPtr[1] = y;
+                                keypointPtr[2] = fastMax(keypointPtr[2], 0.5f*mMinConfidence);
+                            }
+                        }
+                    }
+                }
+                // Predicted region = bounding box + margin, clipped to the image
+                if (minX <= maxX)
+                {
+                    const auto margin = mCropMargin * fastMax(maxX - minX, maxY - minY);
+                    const auto x = fastMax(0, positiveIntRound(minX - margin));
+                    const auto y = fastMax(0, positiveIntRound(minY - margin));
+                    const auto width = fastMin(imageSize.x, positiveIntRound(maxX + margin) + 1) - x;
+                    const auto height = fastMin(imageSize.y, positiveIntRound(maxY + margin) + 1) - y;
+                    if (width > 0 && height > 0)
+                        predictedRectangle = Rectangle<int>{x, y, width, height};
+                }
+            }
+            // Update prediction (an empty one makes the next frames process the whole image)
+            const std::lock_guard<std::mutex> lock{mMutex};
+            if (mPredictedRectangles.size() <= (unsigned int)view)
+                mPredictedRectangles.resize(view+1, std::make_pair(0ull, Rectangle<int>{}));
+            // Frames might arrive unordered if several 3-D reconstruction threads are used
+            auto& prediction = mPredictedRectangles[view];
+            if (prediction.first <= frameId)
+                prediction = std::make_pair(frameId, predictedRectangle);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+}
@@ -1,6 +1,9 @@
 #include <openpose/calibration/cameraParameterEstimation.hpp>
+#include <atomic>
 #include <fstream>
+#include <mutex>
 #include <numeric> // std::accumulate
+#include <thread>
 #ifdef USE_CERES
     #include <ceres/ceres.h>
     #include <ceres/rotation.h>
@@ -81,34 +84,6 @@ namespace op
         }
     }
 
-    std::vector<std::pair<cv::Mat, std::string>> getImageAndPaths(const std::string& imageDirectoryPath)
-    {
-        try
-        {
-            // Get images on directory
-            const auto imagePaths = getImagePaths(imageDirectoryPath);
-            // Check #files > 0
-            if (imagePaths.empty())
-                error("No images were found on `" + imageDirectoryPath + "`.", __LINE__, __FUNCTION__, __FILE__);
-            // Read images
-            std::vector<std::pair<cv::Mat, std::string>> imageAndPaths;
-            for (const auto& imagePath : imagePaths)
-            {
-                imageAndPaths.emplace_back(std::make_pair(cv::imread(imagePath, CV_LOAD_IMAGE_COLOR), imagePath));
-                if (imageAndPaths.back().first.empty())
-                    error("Image could not be opened from path `" + imagePath + "`.",
-                          __LINE__, __FUNCTION__, __FILE__);
-            }
-            // Return result
-            return imageAndPaths;
-        }
-        catch (const std::exception& e)
-        {
-            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
-            return {};
-        }
-    }
-
     std::pair<double, std::vector<double>> calcReprojectionErrors(
         const std::vector<std::vector<cv::Point3f>>& objects3DVectors,
         const std::vector<std::vector<cv::Point2f>>& points2DVectors, const std::vector<cv::Mat>& rVecs,
@@ -735,105 +710,181 @@ namespace op
         }
     }
 
-    void estimateAndSaveSiftFileSubThread(
-        std::vector<cv::Point2f>* points2DExtrinsicPtr, std::vector<unsigned int>* matchIndexesCameraPtr,
-        const int cameraIndex, const int numberCameras, const int numberCorners, const unsigned int numberViews,
-        const bool saveImagesWithCorners, const std::string& imageFolder, const cv::Size& gridInnerCornersCvSize,
-        const cv::Size& imageSize, const std::vector<std::pair<cv::Mat, std::string>>& imageAndPaths,
-        const bool saveSIFTFile)
+    void findGridCornersOnImagesSubThread(
+        std::vector<std::pair<bool, std::vector<cv::Point2f>>>* gridCornersPtr, std::vector<cv::Size>* imageSizesPtr,
+        std::atomic<unsigned long long>* nextImageIndexPtr, std::string* errorMessagePtr, std::mutex* errorMutexPtr,
+        const std::vector<std::string>& imagePaths, const cv::Size& gridInnerCornersCvSize,
+        const std::vector<std::string>& pathsWhereSavingImages, const bool showReorderWarning)
     {
         try
         {
-            // Sanity checks
-            if (points2DExtrinsicPtr == nullptr || matchIndexesCameraPtr == nullptr)
-                error("Make sure than points2DExtrinsicPtr != nullptr && matchIndexesCameraPtr != nullptr.",
-                      __LINE__, __FUNCTION__, __FILE__);
-            if (!points2DExtrinsicPtr->empty() || !matchIndexesCameraPtr->empty())
-                error("Variables points2DExtrinsicPtr and matchIndexesCameraPtr must be empty.",
-                      __LINE__, __FUNCTION__, __FILE__);
-            // Estimate and save SIFT file
-            std::vector<cv::Point2f>& points2DExtrinsic = *points2DExtrinsicPtr;
-            std::vector<unsigned int>& matchIndexesCamera = *matchIndexesCameraPtr;
-            std::vector<cv::Mat> imagesWithCorners;
-            for (auto viewIndex = 0u ; viewIndex < numberViews ; viewIndex++)
+            auto& nextImageIndex = *nextImageIndexPtr;
+            // Each image is read, processed and released before reading the next one, so only 1 image per thread is
+            // in memory at any time
+            for (auto i = nextImageIndex++ ; i < imagePaths.size() ; i = nextImageIndex++)
             {
-                // Get right image
-                const auto& imageAndPath = imageAndPaths.at(viewIndex * numberCameras + cameraIndex);
-                const auto& image = imageAndPath.first;
-
-                if (viewIndex % std::max(1, int(numberViews/4)) == 0)
-                    opLog("Camera " + std::to_string(cameraIndex) + " - Image view "
-                        + std::to_string(viewIndex+1) + "/" + std::to_string(numberViews),
-                        Priority::High);
-
-                // Sanity check
-                if (imageSize.width != image.cols || imageSize.height != image.rows)
-                    error("Detected images with different sizes in `" + imageFolder + "` All images"
-                          " must have the same resolution.", __LINE__, __FUNCTION__, __FILE__);
+                opLog("Image " + std::to_string(i+1) + "/" + std::to_string(imagePaths.size()), Priority::High);
+                const cv::Mat image = cv::imread(imagePaths[i], CV_LOAD_IMAGE_COLOR);
+                if (image.empty())
+                    error("Image could not be opened from path `" + imagePaths[i] + "`.",
+                          __LINE__, __FUNCTION__, __FILE__);
+                (*imageSizesPtr)[i] = image.size();
 
                 // Find grid corners
-                bool found;
-                std::vector<cv::Point2f> points2DVector;
+                auto& found = (*gridCornersPtr)[i].first;
+                auto& points2DVector = (*gridCornersPtr)[i].second;
                 std::tie(found, points2DVector) = findAccurateGridCorners(image, gridInnerCornersCvSize);
 
-                // Reorder & save 2D pixels points
+                // Reorder 2D pixels points
                 if (found)
-                {
-                    reorderPoints(points2DVector, gridInnerCornersCvSize, image);
-                    for (auto i = 0 ; i < numberCorners ; i++)
-                        matchIndexesCamera.emplace_back(viewIndex * numberCorners + i);
-                }
+                    reorderPoints(points2DVector, gridInnerCornersCvSize, image, showReorderWarning);
                 else
-                {
-                    points2DVector.clear();
-                    points2DVector.resize(numberCorners, cv::Point2f{-1.f,-1.f});
-                    opLog("Camera " + std::to_string(cameraIndex) + " - Image view "
-                        + std::to_string(viewIndex+1) + "/" + std::to_string(numberViews)
-                        + " - Chessboard not found.", Priority::High);
-                }
-                points2DExtrinsic.insert(points2DExtrinsic.end(), points2DVector.begin(), points2DVector.end());
+                    opLog("Chessboard not found in image " + imagePaths[i] + ".", Priority::High);
 
-                // Show image (with chessboard corners if found)
-                if (saveImagesWithCorners)
+                // Debugging (optional) - Save image (with chessboard corners if found)
+                if (!pathsWhereSavingImages.empty())
                 {
                     cv::Mat imageToPlot = image.clone();
                     if (found)
                         drawGridCorners(imageToPlot, gridInnerCornersCvSize, points2DVector);
-                    imagesWithCorners.emplace_back(imageToPlot);
+                    const auto& finalPath = pathsWhereSavingImages.at(i);
+                    // Note: If file is not deleted before cv::imwrite, Windows considers that the file
+                    // was "only" modified at that time, not created
+                    remove(finalPath.c_str());
+                    const auto opMat = OP_CV2OPMAT(imageToPlot);
+                    saveImage(opMat, finalPath);
                 }
             }
+        }
+        catch (const std::exception& e)
+        {
+            // Exceptions cannot leave the thread, they are re-thrown by the calling thread after joining it
+            std::lock_guard<std::mutex> lock{*errorMutexPtr};
+            if (errorMessagePtr->empty())
+                *errorMessagePtr = e.what();
+            // Stop the rest of threads
+            *nextImageIndexPtr = imagePaths.size();
+        }
+    }
 
-            // Save *.sift file for camera
-            if (saveSIFTFile)
-            {
-                // const auto fileName = getFullFilePathNoExtension(imageAndPaths.at(cameraIndex).second) + ".sift";
-                const auto fileName = getFileParentFolderPath(imageAndPaths.at(cameraIndex).second)
-                                    + getFileNameFromCameraIndex(cameraIndex) + ".sift";
-                writeVisualSFMSiftGPU(fileName, points2DExtrinsic);
-            }
+    std::vector<std::pair<bool, std::vector<cv::Point2f>>> findGridCornersOnImages(
+        cv::Size& imageSize, const std::vector<std::string>& imagePaths, const cv::Size& gridInnerCornersCvSize,
+        const std::vector<std::string>& pathsWhereSavingImages, const bool showReorderWarning)
+    {
+        try
+        {
+            // Images are read and processed in parallel, keeping only their corners
+            std::vector<std::pair<bool, std::vector<cv::Point2f>>> gridCorners(imagePaths.size());
+            std::vector<cv::Size> imageSizes(imagePaths.size());
+            std::atomic<unsigned long long> nextImageIndex{0ull};
+            std::string errorMessage;
+            std::mutex errorMutex;
+            const auto numberThreads = fastMax(
+                1ull, fastMin((unsigned long long)std::thread::hardware_concurrency(),
+                              (unsigned long long)imagePaths.size()));
+            std::vector<std::thread> threads;
+            for (auto i = 0ull ; i < numberThreads ; i++)
+                threads.emplace_back(
+                    findGridCornersOnImagesSubThread, &gridCorners, &imageSizes, &nextImageIndex, &errorMessage,
+                    &errorMutex, std::cref(imagePaths), std::cref(gridInnerCornersCvSize),
+                    std::cref(pathsWhereSavingImages), showReorderWarning);
+            for (auto& thread : threads)
+                if (thread.joinable())
+                    thread.join();
+            if (!errorMessage.empty())
+                error(errorMessage, __LINE__, __FUNCTION__, __FILE__);
+            // Sanity check
+            imageSize = (imageSizes.empty() ? cv::Size{} : imageSizes.at(0));
+            for (auto i = 0u ; i < imageSizes.size() ; i++)
+                if (imageSize != imageSizes[i])
+                    error("Detected images with different sizes in `" + getFileParentFolderPath(imagePaths[i])
+                          + "` All images must have the same resolution.", __LINE__, __FUNCTION__, __FILE__);
+            // Return result
+            return gridCorners;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
 
-            // Save images with corners
+    void findMultiCameraGridCorners(
+        std::vector<std::vector<cv::Point2f>>& points2DVectorsExtrinsic,
+        std::vector<std::vector<unsigned int>>& matchIndexes, cv::Size& imageSize,
+        const std::vector<std::string>& imagePaths, const int numberCameras, const cv::Size& gridInnerCornersCvSize,
+        const std::string& imageFolder, const bool saveImagesWithCorners, const bool saveSIFTFile)
+    {
+        try
+        {
+            // Sanity check
+            if (numberCameras < 1 || imagePaths.size() < (unsigned long long)numberCameras)
+                error("At least 1 image per camera is required (" + std::to_string(imagePaths.size())
+                      + " images found for " + std::to_string(numberCameras) + " cameras).",
+                      __LINE__, __FUNCTION__, __FILE__);
+            // Images are sorted by view, i.e., image `viewIndex * numberCameras + cameraIndex`
+            const auto numberCorners = gridInnerCornersCvSize.area();
+            const auto numberViews = (unsigned int)(imagePaths.size() / numberCameras);
+            const std::vector<std::string> viewImagePaths(
+                imagePaths.begin(), imagePaths.begin() + numberViews * numberCameras);
+            // Debugging (optional) - Paths where saving images with corners
+            const auto folderWhereSavingImages = imageFolder + "images_with_corners/";
+            std::vector<std::string> pathsWhereSavingImages;
             if (saveImagesWithCorners)
             {
-                const auto folderWhereSavingImages = imageFolder + "images_with_corners/";
-                // Create directory in case it did not exist
                 makeDirectory(folderWhereSavingImages);
-                const auto pathWhereSavingImages = folderWhereSavingImages + std::to_string(cameraIndex) + "_";
-                // Save new images
-                const std::string extension{".png"};
-                auto fileRemoved = true;
-                for (auto i = 0u ; i < imagesWithCorners.size() || fileRemoved; i++)
+                for (auto i = 0u ; i < viewImagePaths.size() ; i++)
+                    pathsWhereSavingImages.emplace_back(
+                        folderWhereSavingImages + std::to_string(i % numberCameras) + "_"
+                        + std::to_string(i / numberCameras + 1) + ".png");
+            }
+
+            // Get 2D grid corners of each image (all cameras and views are processed in parallel)
+            const auto showReorderWarning = true;
+            const auto gridCorners = findGridCornersOnImages(
+                imageSize, viewImagePaths, gridInnerCornersCvSize, pathsWhereSavingImages, showReorderWarning);
+
+            // Group them by camera
+            points2DVectorsExtrinsic.clear();
+            points2DVectorsExtrinsic.resize(numberCameras);
+            matchIndexes.clear();
+            matchIndexes.resize(numberCameras);
+            for (auto cameraIndex = 0 ; cameraIndex < numberCameras ; cameraIndex++)
+            {
+                auto& points2DExtrinsic = points2DVectorsExtrinsic[cameraIndex];
+                auto& matchIndexesCamera = matchIndexes[cameraIndex];
+                points2DExtrinsic.reserve(numberViews * numberCorners);
+                for (auto viewIndex = 0u ; viewIndex < numberViews ; viewIndex++)
                 {
-                    const auto finalPath = pathWhereSavingImages + std::to_string(i+1) + extension;
-                    // remove leftovers/previous files
-                    // Note: If file is not deleted before cv::imwrite, Windows considers that the file
-                    // was "only" modified at that time, not created
-                    fileRemoved = {remove(finalPath.c_str()) == 0};
-                    // save images on hhd in the desired place
-                    if (i < imagesWithCorners.size())
+                    const auto& gridCorner = gridCorners.at(viewIndex * numberCameras + cameraIndex);
+                    if (gridCorner.first)
+                    {
+                        for (auto i = 0 ; i < numberCorners ; i++)
+                            matchIndexesCamera.emplace_back(viewIndex * numberCorners + i);
+                        points2DExtrinsic.insert(
+                            points2DExtrinsic.end(), gridCorner.second.begin(), gridCorner.second.end());
+                    }
+                    else
+                        points2DExtrinsic.resize(points2DExtrinsic.size() + numberCorners, cv::Point2f{-1.f,-1.f});
+                }
+
+                // Save *.sift file for camera
+                if (saveSIFTFile)
+                {
+                    const auto fileName = getFileParentFolderPath(viewImagePaths.at(cameraIndex))
+                                        + getFileNameFromCameraIndex(cameraIndex) + ".sift";
+                    writeVisualSFMSiftGPU(fileName, points2DExtrinsic);
+                }
+
+                // Debugging (optional) - Remove leftovers/previous images with corners (new ones already saved)
+                if (saveImagesWithCorners)
+                {
+                    auto fileRemoved = true;
+                    for (auto i = numberViews ; fileRemoved ; i++)
                     {
-                        const auto opMat = OP_CV2OPMAT(imagesWithCorners.at(i));
-                        saveImage(opMat, finalPath);
+                        const auto finalPath = folderWhereSavingImages + std::to_string(cameraIndex) + "_"
+                                             + std::to_string(i+1) + ".png";
+                        fileRemoved = {remove(finalPath.c_str()) == 0};
                     }
                 }
             }
@@ -866,53 +917,29 @@ namespace op
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             const cv::Size gridInnerCornersCvSize{gridInnerCorners.x, gridInnerCorners.y};
 
-            // Read images in folder
+            // Get images in folder
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-            const auto imageAndPaths = getImageAndPaths(imageFolder);
+            const auto imagePaths = getImagePaths(imageFolder);
+            // Debugging (optional) - Folder where saving images with corners
+            const auto folderWhereSavingImages = (saveImagesWithCorners ? imageFolder + "images_with_corners/" : "");
+            if (saveImagesWithCorners)
+                makeDirectory(folderWhereSavingImages);
 
             // Get 2D grid corners of each image
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            cv::Size imageSize;
+            std::vector<std::string> pathsWhereSavingImages;
+            if (saveImagesWithCorners)
+                for (auto i = 0u ; i < imagePaths.size() ; i++)
+                    pathsWhereSavingImages.emplace_back(folderWhereSavingImages + std::to_string(i+1) + ".png");
+            // For intrinsics order is irrelevant, so I do not care if it fails
+            const auto showReorderWarning = false;
+            const auto gridCorners = findGridCornersOnImages(
+                imageSize, imagePaths, gridInnerCornersCvSize, pathsWhereSavingImages, showReorderWarning);
             std::vector<std::vector<cv::Point2f>> points2DVectors;
-            std::vector<cv::Mat> imagesWithCorners;
-            const auto imageSize = imageAndPaths.at(0).first.size();
-            for (auto i = 0u ; i < imageAndPaths.size() ; i++)
-            {
-                opLog("\nImage " + std::to_string(i+1) + "/" + std::to_string(imageAndPaths.size()), Priority::High);
-                const auto& image = imageAndPaths.at(i).first;
-
-                // Sanity check
-                if (imageSize.width != image.cols || imageSize.height != image.rows)
-                    error("Detected images with different sizes in `" + imageFolder + "` All images"
-                          " must have the same resolution.", __LINE__, __FUNCTION__, __FILE__);
-
-                // Find grid corners
-                bool found;
-                std::vector<cv::Point2f> points2DVector;
-                std::tie(found, points2DVector) = findAccurateGridCorners(image, gridInnerCornersCvSize);
-
-                // Reorder & save 2D pixels points
-                if (found)
-                {
-                    // For intrinsics order is irrelevant, so I do not care if it fails
-                    const auto showWarning = false;
-                    reorderPoints(points2DVector, gridInnerCornersCvSize, image, showWarning);
-                    points2DVectors.emplace_back(points2DVector);
-                }
-                else
-                    opLog("Chessboard not found in image " + imageAndPaths.at(i).second + ".", Priority::High);
-
-                // Debugging (optional) - Show image (with chessboard corners if found)
-                if (saveImagesWithCorners)
-                {
-                    cv::Mat imageToPlot = image.clone();
-                    if (found)
-                        drawGridCorners(imageToPlot, gridInnerCornersCvSize, points2DVector);
-                    // cv::pyrDown(imageToPlot, imageToPlot);
-                    // cv::imshow("Image View", imageToPlot);
-                    // cv::waitKey(delayMilliseconds);
-                    imagesWithCorners.emplace_back(imageToPlot);
-                }
-            }
+            for (const auto& gridCorner : gridCorners)
+                if (gridCorner.first)
+                    points2DVectors.emplace_back(gridCorner.second);
             // Sanity check
             if (points2DVectors.empty())
                 error(sEmptyErrorMessage, __LINE__, __FUNCTION__, __FILE__);
@@ -932,29 +959,15 @@ namespace op
                 serialNumber, opCameraMatrix, opDistortionCoefficients };
             cameraParameterReader.writeParameters(outputParameterFolder);
 
-            // Debugging (optional) - Save images with corners
+            // Debugging (optional) - Remove leftovers/previous images with corners (new ones already saved)
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             if (saveImagesWithCorners)
             {
-                const auto folderWhereSavingImages = imageFolder + "images_with_corners/";
-                // Create directory in case it did not exist
-                makeDirectory(folderWhereSavingImages);
-                // Save new images
-                const std::string extension{".png"};
                 auto fileRemoved = true;
-                for (auto i = 0u ; i < imagesWithCorners.size() || fileRemoved; i++)
+                for (auto i = imagePaths.size() ; fileRemoved ; i++)
                 {
-                    const auto finalPath = folderWhereSavingImages + std::to_string(i+1) + extension;
-                    // remove leftovers/previous files
-                    // Note: If file is not deleted before cv::imwrite, Windows considers that the file
-                    // was "only" modified at that time, not created
+                    const auto finalPath = folderWhereSavingImages + std::to_string(i+1) + ".png";
                     fileRemoved = {remove(finalPath.c_str()) == 0};
-                    // save images on hhd in the desired place
-                    if (i < imagesWithCorners.size())
-                    {
-                        const auto opMat = OP_CV2OPMAT(imagesWithCorners.at(i));
-                        saveImage(opMat, finalPath);
-                    }
                 }
             }
         }
@@ -1213,6 +1226,91 @@ namespace op
         }
     }
 
+    void estimateAndSaveGroundPlane(
+        const std::string& parameterFolder, const std::string& imageFolder, const Point<int>& gridInnerCorners,
+        const float gridSquareSizeMm, const std::string& serialNumber, const bool imagesAreUndistorted)
+    {
+        try
+        {
+            #ifdef USE_EIGEN
+                // Point<int> --> cv::Size
+                const cv::Size gridInnerCornersCvSize{gridInnerCorners.x, gridInnerCorners.y};
+
+                // Load intrinsic parameters
+                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                CameraParameterReader cameraParameterReader;
+                cameraParameterReader.readParameters(parameterFolder, serialNumber);
+                const auto opCameraIntrinsics = cameraParameterReader.getCameraIntrinsics().at(0);
+                const auto opCameraDistortion = cameraParameterReader.getCameraDistortions().at(0);
+                const cv::Mat cameraIntrinsics = OP_OP2CVCONSTMAT(opCameraIntrinsics);
+                const cv::Mat cameraDistortion = (imagesAreUndistorted
+                    ? cv::Mat(cv::Mat::zeros(OP_OP2CVCONSTMAT(opCameraDistortion).size(), CV_64F))
+                    : OP_OP2CVCONSTMAT(opCameraDistortion));
+
+                // Ground-plane pose from the first image where the grid (lying on the floor) is found
+                opLog("Calibrating ground plane of camera " + serialNumber + "...", Priority::High);
+                const auto imagePaths = getImagePaths(imageFolder);
+                cv::Mat rVec;
+                cv::Mat tVec;
+                std::vector<cv::Point2f> points2DVector;
+                std::vector<cv::Point3f> objects3DVector;
+                for (const auto& imagePath : imagePaths)
+                {
+                    const auto image = cv::imread(imagePath, CV_LOAD_IMAGE_COLOR);
+                    if (image.empty())
+                        continue;
+                    std::tie(rVec, tVec, points2DVector, objects3DVector) = calcExtrinsicParametersOpenCV(
+                        image, cameraIntrinsics, cameraDistortion, gridInnerCornersCvSize, gridSquareSizeMm);
+                    if (!rVec.empty())
+                    {
+                        opLog("Grid found on " + getFileNameAndExtension(imagePath) + ".", Priority::High);
+                        break;
+                    }
+                }
+                // Sanity check
+                if (rVec.empty())
+                    error(sEmptyErrorMessage, __LINE__, __FUNCTION__, __FILE__);
+
+                // Reprojection error
+                std::vector<cv::Point2f> points2DVectorReprojected;
+                cv::projectPoints(
+                    objects3DVector, rVec, tVec, cameraIntrinsics, cameraDistortion, points2DVectorReprojected);
+                opLog("Reprojection error (pixels): "
+                    + std::to_string(cv::norm(points2DVector, points2DVectorReprojected, cv::NORM_L2)
+                                     / std::sqrt((double)points2DVector.size())), Priority::High);
+
+                // Extrinsics w.r.t. the ground plane (grid origin, Z = 0 on the floor), mm --> m
+                cv::Mat rotation;
+                cv::Rodrigues(rVec, rotation);
+                cv::Mat cvMatExtrinsics{3, 4, CV_64F};
+                rotation.copyTo(cvMatExtrinsics(cv::Rect{0,0,3,3}));
+                cv::Mat translation = tVec * 1e-3;
+                translation.copyTo(cvMatExtrinsics(cv::Rect{3,0,1,3}));
+                opLog("\nFinal projection matrix w.r.t. the ground plane (meters):", Priority::High);
+                opLog(cvMatExtrinsics, Priority::High);
+                opLog(" ", Priority::High);
+
+                // Save result
+                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                CameraParameterReader cameraParameterReaderFinal{
+                    serialNumber, opCameraIntrinsics, opCameraDistortion, OP_CV2OPMAT(cvMatExtrinsics)};
+                cameraParameterReaderFinal.writeParameters(parameterFolder);
+            #else
+                UNUSED(parameterFolder);
+                UNUSED(imageFolder);
+                UNUSED(gridInnerCorners);
+                UNUSED(gridSquareSizeMm);
+                UNUSED(serialNumber);
+                UNUSED(imagesAreUndistorted);
+                error("CMake flag `USE_EIGEN` required when compiling OpenPose`.", __LINE__, __FUNCTION__, __FILE__);
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     #if defined(USE_CERES) && defined(USE_EIGEN)
         double computeReprojectionErrorInPixels(
             const std::vector<std::vector<cv::Point2f>>& points2DVectorsExtrinsic, const Eigen::MatrixXd& BAValid,
@@ -1467,32 +1565,63 @@ namespace op
                     cameraMatrices[cameraIndex] = cameraIntrinsics[cameraIndex] * cameraExtrinsics[cameraIndex];
                 const auto imageRatio = std::sqrt(imageSize.area() / 1310720.);
                 const auto reprojectionMaxAcceptable = 25 * imageRatio;
-                for (auto i = 0u; i < points2DVectorsExtrinsic[0].size(); i++)
+                // Each 3D point is independent of the others, so they are split into contiguous chunks (1 per thread)
+                const auto numberPoints = (unsigned int)points2DVectorsExtrinsic[0].size();
+                const auto numberThreads = fastMax(
+                    1u, fastMin(std::thread::hardware_concurrency(), numberPoints));
+                std::string errorMessage;
+                std::mutex errorMutex;
+                const auto reconstructPointRange = [&](const unsigned int firstPoint, const unsigned int lastPoint)
                 {
-                    std::vector<cv::Mat> pointCameraMatrices;
-                    std::vector<cv::Point2d> pointsOnEachCamera;
-                    for (auto cameraIndex = 0 ; cameraIndex < numberCameras ; cameraIndex++)
+                    try
                     {
-                        if (points2DVectorsExtrinsic[cameraIndex][i].x >= 0)  // visible in this camera
+                        for (auto i = firstPoint; i < lastPoint; i++)
                         {
-                            pointCameraMatrices.emplace_back(cameraMatrices[cameraIndex]);
-                            const auto& point2D = points2DVectorsExtrinsic[cameraIndex][i];
-                            // cv::Point2f --> cv::Point2d
-                            pointsOnEachCamera.emplace_back(cv::Point2d{point2D.x, point2D.y});
+                            std::vector<cv::Mat> pointCameraMatrices;
+                            std::vector<cv::Point2d> pointsOnEachCamera;
+                            for (auto cameraIndex = 0 ; cameraIndex < numberCameras ; cameraIndex++)
+                            {
+                                if (points2DVectorsExtrinsic[cameraIndex][i].x >= 0)  // visible in this camera
+                                {
+                                    pointCameraMatrices.emplace_back(cameraMatrices[cameraIndex]);
+                                    const auto& point2D = points2DVectorsExtrinsic[cameraIndex][i];
+                                    // cv::Point2f --> cv::Point2d
+                                    pointsOnEachCamera.emplace_back(cv::Point2d{point2D.x, point2D.y});
+                                }
+                            }
+                            // if visible in one camera, no triangulation and not used in bundle adjustment.
+                            if (pointCameraMatrices.size() > 1u)
+                            {
+                                cv::Mat reconstructedPoint;
+                                triangulateWithOptimization(
+                                    reconstructedPoint, pointCameraMatrices, pointsOnEachCamera,
+                                    reprojectionMaxAcceptable);
+                                auto* points3DPtr = &points3D.data()[3*i];
+                                const auto w = reconstructedPoint.at<double>(3, 0);
+                                points3DPtr[0] = reconstructedPoint.at<double>(0, 0) / w;
+                                points3DPtr[1] = reconstructedPoint.at<double>(1, 0) / w;
+                                points3DPtr[2] = reconstructedPoint.at<double>(2, 0) / w;
+                            }
                         }
                     }
-                    // if visible in one camera, no triangulation and not used in bundle adjustment.
-                    if (pointCameraMatrices.size() > 1u)
+                    catch (const std::exception& e)
                     {
-                        cv::Mat reconstructedPoint;
-                        triangulateWithOptimization(
-                            reconstructedPoint, pointCameraMatrices, pointsOnEachCamera, reprojectionMaxAcceptable);
-                        auto* points3DPtr = &points3D.data()[3*i];
-                        points3DPtr[0] = reconstructedPoint.at<double>(0, 0) / reconstructedPoint.at<double>(3, 0);
-                        points3DPtr[1] = reconstructedPoint.at<double>(1, 0) / reconstructedPoint.at<double>(3, 0);
-                        points3DPtr[2] = reconstructedPoint.at<double>(2, 0) / reconstructedPoint.at<double>(3, 0);
+                        // Exceptions cannot leave the thread, they are re-thrown after joining it
+                        std::lock_guard<std::mutex> lock{errorMutex};
+                        if (errorMessage.empty())
+                            errorMessage = e.what();
                     }
-                }
+                };
+                std::vector<std::thread> threads;
+                for (auto threadIndex = 0u ; threadIndex < numberThreads ; threadIndex++)
+                    threads.emplace_back(
+                        reconstructPointRange, threadIndex * numberPoints / numberThreads,
+                        (threadIndex+1) * numberPoints / numberThreads);
+                for (auto& thread : threads)
+                    if (thread.joinable())
+                        thread.join();
+                if (!errorMessage.empty())
+                    error(errorMessage, __LINE__, __FUNCTION__, __FILE__);
                 return points3D;
             }
             catch (const std::exception& e)
@@ -1828,7 +1957,7 @@ namespace op
         void runBundleAdjustment(
             std::vector<cv::Mat>& refinedExtrinsics, Eigen::Matrix<double, 3, Eigen::Dynamic>& points3D,
             const std::vector<std::vector<cv::Point2f>>& points2DVectorsExtrinsic, const Eigen::MatrixXd& BAValid,
-            const std::vector<cv::Mat>& cameraIntrinsics, const int numberCameras)
+            const std::vector<cv::Mat>& cameraIntrinsics, const int numberCameras, const int numberFixedCameras)
         {
             try
             {
@@ -1855,10 +1984,30 @@ namespace op
                 ceres::Solver::Options options;
                 // options.linear_solver_type = ceres::SPARSE_NORMAL_CHOLESKY;
                 // options.linear_solver_type = ceres::DENSE_QR;
-                options.linear_solver_type = ceres::DENSE_SCHUR;
+                // options.linear_solver_type = ceres::DENSE_SCHUR;
+                // Schur complement over block-sparse Jacobians: The 3D points are eliminated first, so only the
+                // (small) reduced camera system is factorized. DENSE_SCHUR densifies it, which does not scale with
+                // the number of cameras and board poses
+                if (ceres::IsSparseLinearAlgebraLibraryTypeAvailable(ceres::SUITE_SPARSE))
+                {
+                    options.linear_solver_type = ceres::SPARSE_SCHUR;
+                    options.sparse_linear_algebra_library_type = ceres::SUITE_SPARSE;
+                }
+                else if (ceres::IsSparseLinearAlgebraLibraryTypeAvailable(ceres::EIGEN_SPARSE))
+                {
+                    options.linear_solver_type = ceres::SPARSE_SCHUR;
+                    options.sparse_linear_algebra_library_type = ceres::EIGEN_SPARSE;
+                }
+                // Ceres compiled without sparse support: Matrix-free Schur complement
+                else
+                {
+                    options.linear_solver_type = ceres::ITERATIVE_SCHUR;
+                    options.preconditioner_type = ceres::SCHUR_JACOBI;
+                }
                 options.use_nonmonotonic_steps = true;
                 options.minimizer_progress_to_stdout = true;
-                options.num_threads = 1;
+                // Residual and Jacobian evaluation (and Schur elimination) multi-threaded
+                options.num_threads = fastMax(1, (int)std::thread::hardware_concurrency());
                 // // Option 1/3) Computing things together
                 // const int numResiduals = 2 * BAValid.sum();  // x and y
                 // BundleAdjustmentCost* ptr_BA = new BundleAdjustmentCost(
@@ -1900,6 +2049,23 @@ namespace op
                     }
                 }
                 // No need to delete ptr_BA or costFunction; Ceres::Problem takes care of them.
+                // Elimination order for the Schur complement: 3D points (group 0) first, then cameras (group 1)
+                auto* parameterBlockOrdering = new ceres::ParameterBlockOrdering;
+                for (auto i = 0 ; i < points3D.cols() ; i++)
+                    if (problem.HasParameterBlock(points3D.data() + 3 * i))
+                        parameterBlockOrdering->AddElementToGroup(points3D.data() + 3 * i, 0);
+                for (auto cameraIndex = 1 ; cameraIndex < numberCameras ; cameraIndex++)
+                {
+                    auto* cameraRtPtr = cameraRt.data() + 6 * cameraIndex;
+                    if (problem.HasParameterBlock(cameraRtPtr))
+                    {
+                        parameterBlockOrdering->AddElementToGroup(cameraRtPtr, 1);
+                        // Incremental mode: Already calibrated cameras are not modified, only the new ones
+                        if (cameraIndex < numberFixedCameras)
+                            problem.SetParameterBlockConstant(cameraRtPtr);
+                    }
+                }
+                options.linear_solver_ordering.reset(parameterBlockOrdering);
                 // // Option 3/3) Computing things separately (manual differentiation)
                 // for (auto cameraIndex = 0; cameraIndex < numberCameras; cameraIndex++)
                 // {
@@ -2045,8 +2211,8 @@ namespace op
         void runBundleAdjustmentWithOutlierRemoval(
             std::vector<cv::Mat>& refinedExtrinsics, Eigen::Matrix<double, 3, Eigen::Dynamic>& points3D,
             std::vector<std::vector<cv::Point2f>>& points2DVectorsExtrinsic, Eigen::MatrixXd& BAValid,
-            const std::vector<cv::Mat>& cameraIntrinsics, const int numberCameras, const double pixelThreshold,
-            const bool printInitialReprojection)
+            const std::vector<cv::Mat>& cameraIntrinsics, const int numberCameras, const int numberFixedCameras,
+            const double pixelThreshold, const bool printInitialReprojection)
         {
             try
             {
@@ -2071,7 +2237,8 @@ namespace op
                 // Bundle Adjustment
                 opLog("Running bundle adjustment...", Priority::High);
                 runBundleAdjustment(
-                    refinedExtrinsics, points3D, points2DVectorsExtrinsic, BAValid, cameraIntrinsics, numberCameras);
+                    refinedExtrinsics, points3D, points2DVectorsExtrinsic, BAValid, cameraIntrinsics, numberCameras,
+                    numberFixedCameras);
                 opLog(" ", Priority::High);
             }
             catch (const std::exception& e)
@@ -2105,7 +2272,7 @@ namespace op
     void refineAndSaveExtrinsics(
         const std::string& parameterFolder, const std::string& imageFolder, const Point<int>& gridInnerCorners,
         const float gridSquareSizeMm, const int numberCameras, const bool imagesAreUndistorted,
-        const bool saveImagesWithCorners)
+        const bool saveImagesWithCorners, const int numberFixedCameras)
     {
         try
         {
@@ -2118,10 +2285,9 @@ namespace op
                 if (!imagesAreUndistorted)
                     error("This mode assumes that the images are already undistorted (add flag `--omit_distortion`).",
                           __LINE__, __FUNCTION__, __FILE__);
-
-                opLog("Loading images...", Priority::High);
-                const auto imageAndPaths = getImageAndPaths(imageFolder);
-                opLog("Images loaded.", Priority::High);
+                if (numberFixedCameras < 0 || numberFixedCameras >= numberCameras)
+                    error("The number of fixed cameras (" + std::to_string(numberFixedCameras) + ") must be in the"
+                          " range [0, number cameras - 1].", __LINE__, __FUNCTION__, __FILE__);
 
                 // Point<int> --> cv::Size
                 const cv::Size gridInnerCornersCvSize{gridInnerCorners.x, gridInnerCorners.y};
@@ -2147,8 +2313,9 @@ namespace op
                 }
                 opLog("Parameters loaded.", Priority::High);
                 // Camera extrinsics
+                // Incremental mode: The fixed cameras must start (and end) with their already refined extrinsics
                 opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-                auto opCameraExtrinsics = (initialEmpty
+                auto opCameraExtrinsics = (initialEmpty || numberFixedCameras > 0
                     ? cameraParameterReader.getCameraExtrinsics() : opCameraExtrinsicsInitial);
                 OP_OP2CVVECTORMAT(cameraExtrinsics, opCameraExtrinsics)
                 // The first one should be [I | 0]: Multiply them all by inv(camera 0 extrinsics)
@@ -2160,45 +2327,23 @@ namespace op
                 const auto cameraDistortions = (
                     imagesAreUndistorted
                     ? std::vector<Matrix>{cameraIntrinsics.size()} : cameraParameterReader.getCameraDistortions());
-                // Read images in folder
-                opLog("Reading images in folder...", Priority::High);
-                const auto numberCorners = gridInnerCorners.area();
-                std::vector<std::vector<cv::Point2f>> points2DVectorsExtrinsic(numberCameras); // camera - keypoints
-                std::vector<std::vector<unsigned int>> matchIndexes(numberCameras); // camera - indixes found
-                if (imageAndPaths.empty())
-                    error("imageAndPaths.empty()!.", __LINE__, __FUNCTION__, __FILE__);
-                opLog("Images read.", Priority::High);
                 // Get 2D grid corners of each image
-                std::vector<cv::Mat> imagesWithCorners;
-                const auto imageSize = imageAndPaths.at(0).first.size();
-                const auto numberViews = (unsigned int)(imageAndPaths.size() / numberCameras);
+                // Images are streamed from disk and processed in parallel (all cameras and views at once)
                 opLog("Processing cameras...", Priority::High);
-                std::vector<std::thread> threads;
-                for (auto cameraIndex = 0 ; cameraIndex < numberCameras ; cameraIndex++)
-                {
-                    auto* points2DExtrinsic = &points2DVectorsExtrinsic[cameraIndex];
-                    auto* matchIndexesCamera = &matchIndexes[cameraIndex];
-                    // Threaded version
-                    threads.emplace_back(estimateAndSaveSiftFileSubThread, points2DExtrinsic,
-                                         matchIndexesCamera, cameraIndex, numberCameras,
-                                         numberCorners, numberViews, saveImagesWithCorners, imageFolder,
-                                         gridInnerCornersCvSize, imageSize, imageAndPaths, saveVisualSFMFiles);
-                    // // Non-threaded version
-                    // estimateAndSaveSiftFileSubThread(points2DExtrinsic, matchIndexesCamera, cameraIndex, numberCameras,
-                    //                                  numberCorners, numberViews, saveImagesWithCorners, imageFolder,
-                    //                                  gridInnerCornersCvSize, imageSize, imageAndPaths,
-                    //                                  saveVisualSFMFiles);
-                }
-                // Threaded version
-                for (auto& thread : threads)
-                    if (thread.joinable())
-                        thread.join();
+                const auto imagePaths = getImagePaths(imageFolder);
+                const auto numberCorners = gridInnerCorners.area();
+                std::vector<std::vector<cv::Point2f>> points2DVectorsExtrinsic; // camera - keypoints
+                std::vector<std::vector<unsigned int>> matchIndexes; // camera - indixes found
+                cv::Size imageSize;
+                findMultiCameraGridCorners(
+                    points2DVectorsExtrinsic, matchIndexes, imageSize, imagePaths, numberCameras,
+                    gridInnerCornersCvSize, imageFolder, saveImagesWithCorners, saveVisualSFMFiles);
 
                 // Matching file
                 if (saveVisualSFMFiles)
                 {
                     std::ofstream ofstreamMatches{
-                        getFileParentFolderPath(imageAndPaths.at(0).second) + "FeatureMatches.txt"};
+                        getFileParentFolderPath(imagePaths.at(0)) + "FeatureMatches.txt"};
                     for (auto cameraIndex = 0 ; cameraIndex < numberCameras ; cameraIndex++)
                     {
                         for (auto cameraIndex2 = cameraIndex+1 ; cameraIndex2 < numberCameras ; cameraIndex2++)
@@ -2210,8 +2355,8 @@ namespace op
 
                             ofstreamMatches << getFileNameFromCameraIndex(cameraIndex) << ".jpg"
                                             << " " << getFileNameFromCameraIndex(cameraIndex2) << ".jpg"
-                            // ofstreamMatches << getFileNameAndExtension(imageAndPaths.at(cameraIndex).second)
-                            //                 << " " << getFileNameAndExtension(imageAndPaths.at(cameraIndex2).second)
+                            // ofstreamMatches << getFileNameAndExtension(imagePaths.at(cameraIndex))
+                            //                 << " " << getFileNameAndExtension(imagePaths.at(cameraIndex2))
                                             << " " << matchIndexesIntersection.size() << "\n";
                             for (auto reps = 0 ; reps < 2 ; reps++)
                             {
@@ -2266,17 +2411,19 @@ namespace op
                 // Update inliers & outliers + Outlier removal + Bundle Adjustment with 1.0 threshold
                 runBundleAdjustmentWithOutlierRemoval(
                     refinedExtrinsics, points3D, points2DVectorsExtrinsic, BAValid, cameraIntrinsics,
-                    numberCameras, 1.0, true);
+                    numberCameras, numberFixedCameras, 1.0, true);
 
                 // Update inliers & outliers + Outlier removal + Bundle Adjustment with 0.5 threshold
                 runBundleAdjustmentWithOutlierRemoval(
                     refinedExtrinsics, points3D, points2DVectorsExtrinsic, BAValid, cameraIntrinsics,
-                    numberCameras, 0.5, false);
+                    numberCameras, numberFixedCameras, 0.5, false);
 
                 // Rescale the 3D points and translation based on the grid size
-                rescaleExtrinsicsAndPoints3D(
-                    refinedExtrinsics, points3D, points2DVectorsExtrinsic, BAValid, cameraIntrinsics, numberCameras,
-                    numberCorners, gridSquareSizeMm, gridInnerCorners);
+                // Incremental mode: If 2 or more cameras are fixed, they already define the metric scale
+                if (numberFixedCameras < 2)
+                    rescaleExtrinsicsAndPoints3D(
+                        refinedExtrinsics, points3D, points2DVectorsExtrinsic, BAValid, cameraIntrinsics,
+                        numberCameras, numberCorners, gridSquareSizeMm, gridInnerCorners);
 
                 // Revert back to refinedExtrinsics[0] = cameraExtrinsics[0] (rather than [I,0])
                 // Note: Given that inv([R,t;0,1]) is another [R',t';0,1], scaling is maintained
@@ -2308,6 +2455,13 @@ namespace op
                 opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
                 const auto cameraSerialNumbers = cameraParameterReader.getCameraSerialNumbers();
                 const auto opRealCameraDistortions = cameraParameterReader.getCameraDistortions();
+                // Incremental mode: The fixed cameras (same rule than the bundle adjustment, i.e., cameras 0 to
+                // numberFixedCameras-1) keep their initial extrinsics, only the new ones update them
+                const auto keepInitialExtrinsics = [&](const int cameraIndex)
+                {
+                    return !opCameraExtrinsicsInitial.at(cameraIndex).empty()
+                        && (numberFixedCameras > 0 ? cameraIndex < numberFixedCameras : !initialEmpty);
+                };
                 for (auto i = 0 ; i < numberCameras ; i++)
                 {
                     CameraParameterReader cameraParameterReaderFinal{
@@ -2315,7 +2469,8 @@ namespace op
                         OP_CV2OPCONSTMAT(cameraIntrinsics.at(i)),
                         opRealCameraDistortions.at(i),
                         OP_CV2OPCONSTMAT(refinedExtrinsics.at(i)),
-                        (initialEmpty ? OP_CV2OPCONSTMAT(cameraExtrinsics.at(i)) : opCameraExtrinsicsInitial.at(i))};
+                        (keepInitialExtrinsics(i)
+                            ? opCameraExtrinsicsInitial.at(i) : OP_CV2OPCONSTMAT(cameraExtrinsics.at(i)))};
                     cameraParameterReaderFinal.writeParameters(parameterFolder);
                 }
                 opLog(" ", Priority::High);
@@ -2327,6 +2482,7 @@ namespace op
                 UNUSED(numberCameras);
                 UNUSED(imagesAreUndistorted);
                 UNUSED(saveImagesWithCorners);
+                UNUSED(numberFixedCameras);
                 error("CMake flags `USE_CERES` and `USE_EIGEN` required when compiling OpenPose`.",
                       __LINE__, __FUNCTION__, __FILE__);
             #endif
@@ -2342,48 +2498,23 @@ namespace op
     {
         try
         {
-            opLog("Loading images...", Priority::High);
-            const auto imageAndPaths = getImageAndPaths(imageFolder);
-            opLog("Images loaded.", Priority::High);
-
             // Point<int> --> cv::Size
             const cv::Size gridInnerCornersCvSize{gridInnerCorners.x, gridInnerCorners.y};
 
-            // Read images in folder
-            const auto numberCorners = gridInnerCorners.area();
-            std::vector<std::vector<cv::Point2f>> points2DVectorsExtrinsic(numberCameras); // camera - keypoints
-            std::vector<std::vector<unsigned int>> matchIndexes(numberCameras); // camera - indixes found
-            if (imageAndPaths.empty())
-                error("imageAndPaths.empty()!.", __LINE__, __FUNCTION__, __FILE__);
-
-            // Get 2D grid corners of each image
-            std::vector<cv::Mat> imagesWithCorners;
-            const auto imageSize = imageAndPaths.at(0).first.size();
-            const auto numberViews = (unsigned int)(imageAndPaths.size() / numberCameras);
+            // Get 2D grid corners of each image (all cameras and views are processed in parallel)
             opLog("Processing cameras...", Priority::High);
-            std::vector<std::thread> threads;
-            for (auto cameraIndex = 0 ; cameraIndex < numberCameras ; cameraIndex++)
-            {
-                auto* points2DExtrinsic = &points2DVectorsExtrinsic[cameraIndex];
-                auto* matchIndexesCamera = &matchIndexes[cameraIndex];
-                // Threaded version
-                const auto saveSIFTFile = true;
-                threads.emplace_back(estimateAndSaveSiftFileSubThread, points2DExtrinsic,
-                                     matchIndexesCamera, cameraIndex, numberCameras,
-                                     numberCorners, numberViews, saveImagesWithCorners, imageFolder,
-                                     gridInnerCornersCvSize, imageSize, imageAndPaths, saveSIFTFile);
-                // // Non-threaded version
-                // estimateAndSaveSiftFileSubThread(points2DExtrinsic, matchIndexesCamera, cameraIndex, numberCameras,
-                //                                  numberCorners, numberViews, saveImagesWithCorners, imageFolder,
-                //                                  gridInnerCornersCvSize, imageSize, imageAndPaths, saveSIFTFile);
-            }
-            // Threaded version
-            for (auto& thread : threads)
-                if (thread.joinable())
-                    thread.join();
+            const auto imagePaths = getImagePaths(imageFolder);
+            const auto numberCorners = gridInnerCorners.area();
+            std::vector<std::vector<cv::Point2f>> points2DVectorsExtrinsic; // camera - keypoints
+            std::vector<std::vector<unsigned int>> matchIndexes; // camera - indixes found
+            cv::Size imageSize;
+            const auto saveSIFTFile = true;
+            findMultiCameraGridCorners(
+                points2DVectorsExtrinsic, matchIndexes, imageSize, imagePaths, numberCameras, gridInnerCornersCvSize,
+                imageFolder, saveImagesWithCorners, saveSIFTFile);
 
             // Matching file
-            std::ofstream ofstreamMatches{getFileParentFolderPath(imageAndPaths.at(0).second) + "FeatureMatches.txt"};
+            std::ofstream ofstreamMatches{getFileParentFolderPath(imagePaths.at(0)) + "FeatureMatches.txt"};
             for (auto cameraIndex = 0 ; cameraIndex < numberCameras ; cameraIndex++)
             {
                 for (auto cameraIndex2 = cameraIndex+1 ; cameraIndex2 < numberCameras ; cameraIndex2++)
@@ -2395,8 +2526,8 @@ namespace op
 
                     ofstreamMatches << getFileNameFromCameraIndex(cameraIndex) << ".jpg"
                                     << " " << getFileNameFromCameraIndex(cameraIndex2) << ".jpg"
-                    // ofstreamMatches << getFileNameAndExtension(imageAndPaths.at(cameraIndex).second)
-                    //                 << " " << getFileNameAndExtension(imageAndPaths.at(cameraIndex2).second)
+                    // ofstreamMatches << getFileNameAndExtension(imagePaths.at(cameraIndex))
+                    //                 << " " << getFileNameAndExtension(imagePaths.at(cameraIndex2))
                                     << " " << matchIndexesIntersection.size() << "\n";
                     for (auto reps = 0 ; reps < 2 ; reps++)
                     {
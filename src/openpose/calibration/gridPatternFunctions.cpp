@@ -31,6 +31,25 @@ namespace op
         }
     }
 
+    void scalePoints(std::vector<cv::Point2f>& points2DVector, const cv::Size& targetSize, const cv::Size& sourceSize)
+    {
+        try
+        {
+            // Float ratio per axis (pyrDown rounds up odd sizes)
+            const auto scaleX = targetSize.width / float(sourceSize.width);
+            const auto scaleY = targetSize.height / float(sourceSize.height);
+            for (auto& point : points2DVector)
+            {
+                point.x *= scaleX;
+                point.y *= scaleY;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     std::pair<bool, std::vector<cv::Point2f>> tryToFindGridCorners(const cv::Mat& image,
                                                                    const cv::Size& gridInnerCorners)
     {
@@ -89,6 +108,45 @@ namespace op
         }
     }
 
+    // Images wider than this are first searched at a lower resolution
+    const auto COARSE_MAX_WIDTH = 1280;
+
+    std::pair<bool, std::vector<cv::Point2f>> coarselyTryToFindGridCorners(
+        bool& rejected, const cv::Mat& image, const cv::Size& gridInnerCorners)
+    {
+        try
+        {
+            bool chessboardFound{false};
+            std::vector<cv::Point2f> points2DVector;
+            rejected = false;
+
+            if (!image.empty() && image.cols > COARSE_MAX_WIDTH)
+            {
+                // Downscale
+                cv::Mat coarseImage = image;
+                while (coarseImage.cols > COARSE_MAX_WIDTH)
+                    cv::pyrDown(cv::Mat{coarseImage}, coarseImage);
+                // Quick rejection of images without any chessboard (same test as CALIB_CB_FAST_CHECK)
+                if (!cv::checkChessboard(coarseImage, gridInnerCorners))
+                    rejected = true;
+                // Chessboard detection at low resolution, mapped back to the original resolution
+                else
+                {
+                    std::tie(chessboardFound, points2DVector) = tryToFindGridCorners(coarseImage, gridInnerCorners);
+                    if (chessboardFound)
+                        scalePoints(points2DVector, image.size(), coarseImage.size());
+                }
+            }
+
+            return std::make_pair(chessboardFound, points2DVector);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return std::make_pair(false, std::vector<cv::Point2f>());
+        }
+    }
+
     std::pair<bool, std::vector<cv::Point2f>> heavilyTryToFindGridCorners(const cv::Mat& image,
                                                                           const cv::Size& gridInnerCorners)
     {
@@ -121,8 +179,7 @@ namespace op
                     {
                         opLog("Chessboard found at lower resolution (" + std::to_string(tempImage.cols) + "x"
                             + std::to_string(tempImage.rows) + ").", Priority::High);
-                        for (auto& point : points2DVector)
-                            point *= (image.size().width / tempImage.size().width);
+                        scalePoints(points2DVector, image.size(), tempImage.size());
                     }
                 }
             }
@@ -218,9 +275,14 @@ namespace op
             cv::cvtColor(image, imageGray, CV_BGR2GRAY);
 
             // Find chessboard corners
-            auto foundGridCornersAndLocations = heavilyTryToFindGridCorners(imageGray, gridInnerCorners);
-
-            // Increase accuracy
+            // Coarse-to-fine: Low resolution search (and quick rejection if no chessboard)
+            auto rejected = false;
+            auto foundGridCornersAndLocations = coarselyTryToFindGridCorners(rejected, imageGray, gridInnerCorners);
+            // Full resolution search if not found (and not rejected) at low resolution
+            if (!foundGridCornersAndLocations.first && !rejected)
+                foundGridCornersAndLocations = heavilyTryToFindGridCorners(imageGray, gridInnerCorners);
+
+            // Increase accuracy (at full resolution, only in the local window around each corner)
             if (foundGridCornersAndLocations.first)
                 improveCornersPositionsAtSubPixelLevel(foundGridCornersAndLocations.second, imageGray);
 
@@ -1,4 +1,6 @@
 #include <openpose/core/array.hpp>
+#include <algorithm> // std::fill
+#include <mutex>
 #include <typeinfo> // typeid
 #include <numeric> // std::accumulate
 #include <opencv2/core/core.hpp> // cv::Mat
@@ -17,65 +19,68 @@
 
 namespace op
 {
+    // Serializes the (lazy) creation of the Matrix headers, so concurrent const getters do not race. It is only
+    // locked the first time the header of each Array is requested after a reset
+    std::mutex sCvMatDataMutex;
+
+    /**
+     * Private auxiliar function that returns the OpenCV type equivalent to an Array<T> with numberDimensions
+     * dimensions and lastSize as size of its last dimension, or -1 if T is not supported by OpenCV.
+     */
+    template<typename T>
+    int getCvMatType(const int numberDimensions, const int lastSize)
+    {
+        try
+        {
+            // BGR image (3 channels) or any other case (1 channel)
+            const auto channels = (numberDimensions == 3 && lastSize == 3 ? 3 : 1);
+            if (typeid(T) == typeid(float))
+                return CV_MAKETYPE(CV_32F, channels);
+            else if (typeid(T) == typeid(double))
+                return CV_MAKETYPE(CV_64F, channels);
+            else if (typeid(T) == typeid(unsigned char))
+                return CV_MAKETYPE(CV_8U, channels);
+            else if (typeid(T) == typeid(signed char))
+                return CV_MAKETYPE(CV_8S, channels);
+            else if (typeid(T) == typeid(int))
+                return CV_MAKETYPE(CV_32S, channels);
+            else
+                return -1;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return -1;
+        }
+    }
+
     /**
      * Private auxiliar function that sets the cv::Mat wrapper and makes it point to the same data than
      * std::shared_ptr points to.
      */
     template<typename T>
-    void setCvMatFromPtr(std::pair<bool, Matrix>& cvMatData, T* const dataPtr, const std::vector<int>& sizes)
+    void setCvMatFromPtr(Matrix& matrix, T* const dataPtr, const int* const sizes, const int numberDimensions)
     {
         try
         {
-            cvMatData.first = true;
-            cvMatData.second = Matrix();
-            // BGR image
-            if (sizes.size() == 3 && sizes[2] == 3)
+            if (numberDimensions > 0)
             {
-                // Prepare cv::Mat
-                auto cvFormat = CV_32FC3;
-                if (typeid(T) == typeid(float))
-                    cvFormat = CV_32FC3;
-                else if (typeid(T) == typeid(double))
-                    cvFormat = CV_64FC3;
-                else if (typeid(T) == typeid(unsigned char))
-                    cvFormat = CV_8UC3;
-                else if (typeid(T) == typeid(signed char))
-                    cvFormat = CV_8SC3;
-                else if (typeid(T) == typeid(int))
-                    cvFormat = CV_32SC3;
-                else
-                    cvMatData.first = false;
-
-                if (cvMatData.first)
+                const auto cvFormat = getCvMatType<T>(numberDimensions, sizes[numberDimensions-1]);
+                // BGR image
+                if (CV_MAT_CN(cvFormat) == 3)
                 {
                     cv::Mat cvMat(sizes[0], sizes[1], cvFormat, dataPtr);
-                    cvMatData.second = OP_CV2OPMAT(cvMat);
+                    matrix = OP_CV2OPMAT(cvMat);
                 }
-            }
-            // Any other type
-            else
-            {
-                // Prepare cv::Mat
-                auto cvFormat = CV_32FC1;
-                if (typeid(T) == typeid(float))
-                    cvFormat = CV_32FC1;
-                else if (typeid(T) == typeid(double))
-                    cvFormat = CV_64FC1;
-                else if (typeid(T) == typeid(unsigned char))
-                    cvFormat = CV_8UC1;
-                else if (typeid(T) == typeid(signed char))
-                    cvFormat = CV_8SC1;
-                else if (typeid(T) == typeid(int))
-                    cvFormat = CV_32SC1;
+                // Any other type
                 else
-                    cvMatData.first = false;
-
-                if (cvMatData.first)
                 {
-                    cv::Mat cvMat((int)sizes.size(), sizes.data(), cvFormat, dataPtr);
-                    cvMatData.second = OP_CV2OPMAT(cvMat);
+                    cv::Mat cvMat(numberDimensions, sizes, cvFormat, dataPtr);
+                    matrix = OP_CV2OPMAT(cvMat);
                 }
             }
+            else
+                matrix = Matrix();
         }
         catch (const std::exception& e)
         {
@@ -83,6 +88,20 @@ namespace op
         }
     }
 
+    /**
+     * Private shared_ptr deleter for Array data shared with a cv::Mat (see Array<T>::setFrom). It does not release
+     * any memory, it just keeps a reference to the cv::Mat so its data is not deallocated while the Array uses it.
+     */
+    template<typename T>
+    struct CvMatDeleter
+    {
+        cv::Mat cvMat;
+
+        void operator()(T* const) const
+        {
+        }
+    };
+
     template<typename T>
     Array<T>::Array(const int size)
     {
@@ -194,12 +213,26 @@ namespace op
 
     template<typename T>
     Array<T>::Array(const Array<T>& array) :
-        mSize{array.mSize},
+        mSize(array.mSize),
+        mStep(array.mStep),
+        mNumberDimensions{array.mNumberDimensions},
         mVolume{array.mVolume},
         spData{array.spData},
-        pData{array.pData},
-        mCvMatData{array.mCvMatData}
+        pData{array.pData}
     {
+        try
+        {
+            // Once up to date, the header is not modified until the next reset, so it can be copied
+            if (array.mCvMatDataUpToDate.load(std::memory_order_acquire))
+            {
+                mCvMatData = array.mCvMatData;
+                mCvMatDataUpToDate.store(true, std::memory_order_relaxed);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
     }
 
     template<typename T>
@@ -208,10 +241,16 @@ namespace op
         try
         {
             mSize = array.mSize;
+            mStep = array.mStep;
+            mNumberDimensions = array.mNumberDimensions;
             mVolume = array.mVolume;
             spData = array.spData;
             pData = array.pData;
-            mCvMatData = array.mCvMatData;
+            // Once up to date, the header is not modified until the next reset, so it can be copied
+            const auto cvMatDataUpToDate = array.mCvMatDataUpToDate.load(std::memory_order_acquire);
+            if (cvMatDataUpToDate)
+                mCvMatData = array.mCvMatData;
+            mCvMatDataUpToDate.store(cvMatDataUpToDate, std::memory_order_relaxed);
             // Return
             return *this;
         }
@@ -224,7 +263,9 @@ namespace op
 
     template<typename T>
     Array<T>::Array(Array<T>&& array) :
-        mSize{array.mSize},
+        mSize(array.mSize),
+        mStep(array.mStep),
+        mNumberDimensions{array.mNumberDimensions},
         mVolume{array.mVolume}
     {
         try
@@ -232,6 +273,8 @@ namespace op
             std::swap(spData, array.spData);
             std::swap(pData, array.pData);
             std::swap(mCvMatData, array.mCvMatData);
+            mCvMatDataUpToDate.store(array.mCvMatDataUpToDate.load());
+            array.mCvMatDataUpToDate.store(false);
         }
         catch (const std::exception& e)
         {
@@ -245,10 +288,14 @@ namespace op
         try
         {
             mSize = array.mSize;
+            mStep = array.mStep;
+            mNumberDimensions = array.mNumberDimensions;
             mVolume = array.mVolume;
             std::swap(spData, array.spData);
             std::swap(pData, array.pData);
             std::swap(mCvMatData, array.mCvMatData);
+            mCvMatDataUpToDate.store(array.mCvMatDataUpToDate.load());
+            array.mCvMatDataUpToDate.store(false);
             // Return
             return *this;
         }
@@ -265,7 +312,7 @@ namespace op
         try
         {
             // Constructor
-            Array<T> array{mSize};
+            Array<T> array{getSize()};
             // Clone data
             // Equivalent: std::copy(spData.get(), spData.get() + mVolume, array.spData.get());
             std::copy(pData, pData + mVolume, array.pData);
@@ -375,17 +422,34 @@ namespace op
         {
             if (!cvMat.empty())
             {
-                // New size
-                std::vector<int> newSize(cvMat.dims(),0);
+                const cv::Mat cvMatConst = OP_OP2CVCONSTMAT(cvMat);
+                // New size (channels added as last dimension)
+                std::vector<int> newSize(cvMatConst.dims,0);
                 for (auto i = 0u ; i < newSize.size() ; i++)
-                    newSize[i] = cvMat.size(i);
-                // Reset data & volume
-                reset(newSize);
+                    newSize[i] = cvMatConst.size[i];
+                if (cvMatConst.channels() > 1)
+                    newSize.emplace_back(cvMatConst.channels());
                 // Integrity checks
-                if (!mCvMatData.first || mCvMatData.second.type() != cvMat.type())
+                if (getCvMatType<T>((int)newSize.size(), newSize.back()) != cvMatConst.type())
                     error("Array<T>: T type and cvMat type are different.", __LINE__, __FUNCTION__, __FILE__);
-                // Fill data
-                cvMat.copyTo(mCvMatData.second);
+                // Share the cv::Mat data rather than copying it if it owns it (i.e., it will be kept allocated) and
+                // it has the Array layout
+                #if (defined(CV_VERSION_EPOCH) && CV_VERSION_EPOCH == 2)
+                    const auto shareData = (cvMatConst.refcount != nullptr && cvMatConst.isContinuous());
+                #else
+                    const auto shareData = (cvMatConst.u != nullptr && cvMatConst.isContinuous());
+                #endif
+                if (shareData)
+                {
+                    resetAuxiliary(newSize, (T*)cvMatConst.data);
+                    spData.reset(pData, CvMatDeleter<T>{cvMatConst});
+                }
+                // Copy data
+                else
+                {
+                    reset(newSize);
+                    cvMat.copyTo(getCvMat());
+                }
             }
             else
                 reset();
@@ -401,15 +465,9 @@ namespace op
     {
         try
         {
+            // std::fill is also vectorized by the compiler, and it does not require the Matrix header
             if (mVolume > 0)
-            {
-                // OpenCV is efficient on copying (AVX, SSE, etc.)
-                if (mCvMatData.first)
-                    mCvMatData.second.setTo((double)value);
-                else
-                    for (auto i = 0u ; i < mVolume ; i++)
-                        operator[](i) = value;
-            }
+                std::fill(pData, pData + mVolume, value);
         }
         catch (const std::exception& e)
         {
@@ -417,32 +475,6 @@ namespace op
         }
     }
 
-    template<typename T>
-    int Array<T>::getSize(const int index) const
-    {
-        try
-        {
-            // Matlab style:
-                // If empty -> return 0
-                // If index >= # dimensions -> return 1
-            if ((unsigned int)index < mSize.size() && 0 <= index)
-                return mSize[index];
-            // Long version:
-            // else if (mSize.empty())
-            //     return 0;
-            // else // if mSize.size() <= (unsigned int)index
-            //     return 1;
-            // Equivalent to:
-            else
-                return (!mSize.empty());
-        }
-        catch (const std::exception& e)
-        {
-            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
-            return 0;
-        }
-    }
-
     template<typename T>
     std::string Array<T>::printSize() const
     {
@@ -450,10 +482,10 @@ namespace op
         {
             auto counter = 0u;
             std::string sizeString = "[ ";
-            for (const auto& i : mSize)
+            for (auto i = 0 ; i < mNumberDimensions ; i++)
             {
-                sizeString += std::to_string(i);
-                if (++counter < mSize.size())
+                sizeString += std::to_string(mSize[i]);
+                if (++counter < (unsigned int)mNumberDimensions)
                     sizeString += " x ";
             }
             sizeString += " ]";
@@ -466,51 +498,14 @@ namespace op
         }
     }
 
-    template<typename T>
-    size_t Array<T>::getVolume(const int indexA, const int indexB) const
-    {
-        try
-        {
-            const auto indexBFinal = (indexB != -1 ? indexB : (int)mSize.size()-1);
-            if (indexA < indexBFinal)
-            {
-                // 0 <= indexA < indexBFinal < mSize.size()
-                if (0 <= indexA && (unsigned int)indexBFinal < mSize.size())
-                    return std::accumulate(
-                        mSize.begin()+indexA, mSize.begin()+indexBFinal+1, 1ull, std::multiplies<size_t>());
-                else
-                {
-                    error("Indexes out of dimension.", __LINE__, __FUNCTION__, __FILE__);
-                    return 0;
-                }
-            }
-            else if (indexA == indexBFinal)
-                return mSize.at(indexA);
-            else // if (indexA > indexBFinal)
-            {
-                error("indexA > indexB.", __LINE__, __FUNCTION__, __FILE__);
-                return 0;
-            }
-        }
-        catch (const std::exception& e)
-        {
-            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
-            return 0;
-        }
-    }
-
     template<typename T>
     std::vector<int> Array<T>::getStride() const
     {
         try
         {
-            std::vector<int> strides(mSize.size());
-            if (!strides.empty())
-            {
-                strides.back() = sizeof(T);
-                for (auto i = (int)strides.size()-2 ; i > -1 ; i--)
-                    strides[i] = strides[i+1] * mSize[i+1];
-            }
+            std::vector<int> strides(mNumberDimensions);
+            for (auto i = 0 ; i < mNumberDimensions ; i++)
+                strides[i] = getStride(i);
             return strides;
         }
         catch (const std::exception& e)
@@ -520,34 +515,18 @@ namespace op
         }
     }
 
-    template<typename T>
-    int Array<T>::getStride(const int index) const
-    {
-        try
-        {
-            return getStride()[index];
-        }
-        catch (const std::exception& e)
-        {
-            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
-            return -1;
-        }
-    }
-
     template<typename T>
     const Matrix& Array<T>::getConstCvMat() const
     {
         try
         {
-            if (!mCvMatData.first)
-                error("Array<T>: Matrix functions only valid for T types defined by OpenCV: unsigned char,"
-                      " signed char, int, float & double", __LINE__, __FUNCTION__, __FILE__);
-            return mCvMatData.second;
+            updateCvMatData();
+            return mCvMatData;
         }
         catch (const std::exception& e)
         {
             error(e.what(), __LINE__, __FUNCTION__, __FILE__);
-            return mCvMatData.second;
+            return mCvMatData;
         }
     }
 
@@ -556,15 +535,13 @@ namespace op
     {
         try
         {
-            if (!mCvMatData.first)
-                error("Array<T>: Matrix functions only valid for T types defined by OpenCV: unsigned char,"
-                      " signed char, int, float & double", __LINE__, __FUNCTION__, __FILE__);
-            return mCvMatData.second;
+            updateCvMatData();
+            return mCvMatData;
         }
         catch (const std::exception& e)
         {
             error(e.what(), __LINE__, __FUNCTION__, __FILE__);
-            return mCvMatData.second;
+            return mCvMatData;
         }
     }
 
@@ -583,7 +560,7 @@ namespace op
                 // Introduce an enter for each dimension change
                 // If comented, all values will be printed in the same line
                 auto multiplier = 1;
-                for (auto dimension = (int)(mSize.size() - 1u) ; dimension > 0
+                for (auto dimension = mNumberDimensions - 1 ; dimension > 0
                       && (int(i/multiplier) % getSize(dimension) == getSize(dimension)-1) ; dimension--)
                 {
                     string += "\n";
@@ -626,7 +603,7 @@ namespace op
     {
         try
         {
-            if (indexes.size() != mSize.size())
+            if (indexes.size() != (size_t)mNumberDimensions)
                 error("Requested indexes size is different than Array size.", __LINE__, __FUNCTION__, __FILE__);
             return getIndex(indexes);
         }
@@ -664,18 +641,32 @@ namespace op
         {
             if (!sizes.empty())
             {
+                // Sanity check
+                if (sizes.size() > (size_t)ARRAY_MAX_NUMBER_DIMENSIONS)
+                    error("Array<T> admits up to " + std::to_string(ARRAY_MAX_NUMBER_DIMENSIONS) + " dimensions, but "
+                          + std::to_string(sizes.size()) + " were requested.", __LINE__, __FUNCTION__, __FILE__);
                 // New size & volume
-                mSize = sizes;
+                const auto previousVolume = mVolume;
+                mNumberDimensions = (int)sizes.size();
+                std::copy(sizes.begin(), sizes.end(), mSize.begin());
+                mStep[mNumberDimensions-1] = 1;
+                for (auto i = mNumberDimensions-2 ; i > -1 ; i--)
+                    mStep[i] = mStep[i+1] * mSize[i+1];
                 mVolume = {std::accumulate(sizes.begin(), sizes.end(), std::size_t(1), std::multiplies<size_t>())};
                 // Prepare shared_ptr
                 if (dataPtr == nullptr)
                 {
-                    #ifdef WITH_AVX
+                    // Same volume and buffer not shared with any other Array (nor cv::Mat) -> Re-use it (e.g., Arrays
+                    // reset to the same size every frame or recycled Datums) rather than re-allocating it
+                    const auto reuseBuffer = (spData != nullptr && spData.use_count() == 1 && pData == spData.get()
+                                              && previousVolume == mVolume
+                                              && std::get_deleter<CvMatDeleter<T>>(spData) == nullptr);
+                    if (!reuseBuffer)
+                    {
+                        // Aligned for the SIMD kernels (e.g., Arrays used as network input)
                         spData = aligned_shared_ptr<T>(mVolume);
-                    #else
-                        spData.reset(new T[mVolume], std::default_delete<T[]>());
-                    #endif
-                    pData = spData.get();
+                        pData = spData.get();
+                    }
                     // Sanity check
                     if (pData == nullptr)
                         error("Shared pointer could not be allocated for Array data storage.",
@@ -686,16 +677,41 @@ namespace op
                     spData.reset();
                     pData = dataPtr;
                 }
-                setCvMatFromPtr(mCvMatData, pData, mSize); // spData.get()
+                // Matrix header created when needed
+                mCvMatDataUpToDate.store(false);
             }
             else
             {
-                mSize = {};
+                mNumberDimensions = 0;
                 mVolume = 0ul;
                 spData.reset();
                 pData = nullptr;
-                // Matrix available but empty
-                mCvMatData = std::make_pair(true, Matrix());
+                mCvMatDataUpToDate.store(false);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename T>
+    void Array<T>::updateCvMatData() const
+    {
+        try
+        {
+            if (!mCvMatDataUpToDate.load(std::memory_order_acquire))
+            {
+                const std::lock_guard<std::mutex> lock{sCvMatDataMutex};
+                // Another thread might have created it while waiting for the lock
+                if (!mCvMatDataUpToDate.load(std::memory_order_relaxed))
+                {
+                    if (mNumberDimensions > 0 && getCvMatType<T>(1, 1) < 0)
+                        error("Array<T>: Matrix functions only valid for T types defined by OpenCV: unsigned char,"
+                              " signed char, int, float & double", __LINE__, __FUNCTION__, __FILE__);
+                    setCvMatFromPtr(mCvMatData, pData, mSize.data(), mNumberDimensions); // spData.get()
+                    mCvMatDataUpToDate.store(true, std::memory_order_release);
+                }
             }
         }
         catch (const std::exception& e)
@@ -62,7 +62,25 @@ namespace op
 
     std::vector<Array<float>> CvMatToOpInput::createArray(
         const Matrix& inputData, const std::vector<double>& scaleInputToNetInputs,
-        const std::vector<Point<int>>& netInputSizes)
+        const std::vector<Point<int>>& netInputSizes, const Rectangle<int>& netInputRectangle)
+    {
+        try
+        {
+            std::vector<Array<float>> inputNetData;
+            createArray(inputNetData, inputData, scaleInputToNetInputs, netInputSizes, netInputRectangle);
+            return inputNetData;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    void CvMatToOpInput::createArray(
+        std::vector<Array<float>>& inputNetData, const Matrix& inputData,
+        const std::vector<double>& scaleInputToNetInputs, const std::vector<Point<int>>& netInputSizes,
+        const Rectangle<int>& netInputRectangle)
     {
         try
         {
@@ -75,8 +93,17 @@ namespace op
                 error("scaleInputToNetInputs.size() != netInputSizes.size().", __LINE__, __FUNCTION__, __FILE__);
             // inputNetData - Reescale keeping aspect ratio and transform to float the input deep net image
             const auto numberScales = (int)scaleInputToNetInputs.size();
-            std::vector<Array<float>> inputNetData(numberScales);
+            inputNetData.resize(numberScales);
             cv::Mat cvInputData = OP_OP2CVCONSTMAT(inputData);
+            // Crop (e.g., region predicted by the 3-D module), no deep copy unless it is required by the GPU resize
+            if (netInputRectangle.area() > 0)
+            {
+                const cv::Rect roi{netInputRectangle.x, netInputRectangle.y,
+                                   netInputRectangle.width, netInputRectangle.height};
+                if ((roi & cv::Rect{0, 0, cvInputData.cols, cvInputData.rows}) != roi)
+                    error("netInputRectangle must be inside the input image.", __LINE__, __FUNCTION__, __FILE__);
+                cvInputData = (mGpuResize ? cvInputData(roi).clone() : cvInputData(roi));
+            }
             for (auto i = 0u ; i < inputNetData.size() ; i++)
             {
                 // CPU version (faster if #Gpus <= 3 and relatively small images)
@@ -149,12 +176,10 @@ namespace op
                     #endif
                 }
             }
-            return inputNetData;
         }
         catch (const std::exception& e)
         {
             error(e.what(), __LINE__, __FUNCTION__, __FILE__);
-            return {};
         }
     }
 }
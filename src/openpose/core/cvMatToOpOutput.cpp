@@ -75,6 +75,23 @@ namespace op
 
     Array<float> CvMatToOpOutput::createArray(
          const Matrix& inputData, const double scaleInputToOutput, const Point<int>& outputResolution)
+    {
+        try
+        {
+            Array<float> outputData;
+            createArray(outputData, inputData, scaleInputToOutput, outputResolution);
+            return outputData;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Array<float>{};
+        }
+    }
+
+    void CvMatToOpOutput::createArray(
+        Array<float>& outputData, const Matrix& inputData, const double scaleInputToOutput,
+        const Point<int>& outputResolution)
     {
         try
         {
@@ -89,7 +106,7 @@ namespace op
             if (outputResolution.x <= 0 || outputResolution.y <= 0)
                 error("Output resolution has 0 area.", __LINE__, __FUNCTION__, __FILE__);
             // outputData - Reescale keeping aspect ratio and transform to float the output image
-            Array<float> outputData({outputResolution.y, outputResolution.x, 3}); // This size is used everywhere
+            outputData.reset({outputResolution.y, outputResolution.x, 3}); // This size is used everywhere
             // CPU version (faster if #Gpus <= 3 and relatively small images)
             if (!mGpuResize)
             {
@@ -138,13 +155,10 @@ namespace op
                         __LINE__, __FUNCTION__, __FILE__);
                 #endif
             }
-            // Return result
-            return outputData;
         }
         catch (const std::exception& e)
         {
             error(e.what(), __LINE__, __FUNCTION__, __FILE__);
-            return Array<float>{};
         }
     }
 }
@@ -40,10 +40,12 @@ namespace op
         poseKeypoints3D{datum.poseKeypoints3D},
         faceKeypoints3D{datum.faceKeypoints3D},
         handKeypoints3D(datum.handKeypoints3D), // Parentheses instead of braces to avoid error in GCC 4.8
+        poseFloorPositions{datum.poseFloorPositions},
         cameraMatrix{datum.cameraMatrix},
         // Other parameters
         scaleInputToNetInputs{datum.scaleInputToNetInputs},
         netInputSizes{datum.netInputSizes},
+        netInputRectangle{datum.netInputRectangle},
         scaleInputToOutput{datum.scaleInputToOutput},
         scaleNetToOutput{datum.scaleNetToOutput},
         elementRendered{datum.elementRendered}
@@ -69,7 +71,11 @@ namespace op
                 // Adam params (Jacobians)
                 vtVec{datum.vtVec},
                 j0Vec{datum.j0Vec},
-                adamFaceCoeffsExp{datum.adamFaceCoeffsExp}
+                adamFaceCoeffsExp{datum.adamFaceCoeffsExp},
+                // Adam/Unity params of each person
+                adamPoses(datum.adamPoses),
+                adamTranslations(datum.adamTranslations),
+                adamFaceCoeffsExps(datum.adamFaceCoeffsExps)
             #endif
         #endif
     {
@@ -107,10 +113,12 @@ namespace op
             poseKeypoints3D = datum.poseKeypoints3D,
             faceKeypoints3D = datum.faceKeypoints3D,
             handKeypoints3D = datum.handKeypoints3D,
+            poseFloorPositions = datum.poseFloorPositions,
             cameraMatrix = datum.cameraMatrix;
             // Other parameters
             scaleInputToNetInputs = datum.scaleInputToNetInputs;
             netInputSizes = datum.netInputSizes;
+            netInputRectangle = datum.netInputRectangle;
             scaleInputToOutput = datum.scaleInputToOutput;
             scaleNetToOutput = datum.scaleNetToOutput;
             elementRendered = datum.elementRendered;
@@ -135,6 +143,10 @@ namespace op
                     vtVec = datum.vtVec;
                     j0Vec = datum.j0Vec;
                     adamFaceCoeffsExp = datum.adamFaceCoeffsExp;
+                    // Adam/Unity params of each person
+                    adamPoses = datum.adamPoses;
+                    adamTranslations = datum.adamTranslations;
+                    adamFaceCoeffsExps = datum.adamFaceCoeffsExps;
                 #endif
             #endif
             // Return
@@ -183,10 +195,12 @@ namespace op
             std::swap(poseKeypoints3D, datum.poseKeypoints3D);
             std::swap(faceKeypoints3D, datum.faceKeypoints3D);
             std::swap(handKeypoints3D, datum.handKeypoints3D);
+            std::swap(poseFloorPositions, datum.poseFloorPositions);
             std::swap(cameraMatrix, datum.cameraMatrix);
             // Other parameters
             std::swap(scaleInputToNetInputs, datum.scaleInputToNetInputs);
             std::swap(netInputSizes, datum.netInputSizes);
+            std::swap(netInputRectangle, datum.netInputRectangle);
             std::swap(elementRendered, datum.elementRendered);
             // 3D/Adam parameters
             #ifdef USE_3D_ADAM_MODEL
@@ -209,6 +223,10 @@ namespace op
                     std::swap(vtVec, datum.vtVec);
                     std::swap(j0Vec, datum.j0Vec);
                     std::swap(adamFaceCoeffsExp, datum.adamFaceCoeffsExp);
+                    // Adam/Unity params of each person
+                    std::swap(adamPoses, datum.adamPoses);
+                    std::swap(adamTranslations, datum.adamTranslations);
+                    std::swap(adamFaceCoeffsExps, datum.adamFaceCoeffsExps);
                 #endif
             #endif
         }
@@ -250,10 +268,12 @@ namespace op
             std::swap(poseKeypoints3D, datum.poseKeypoints3D);
             std::swap(faceKeypoints3D, datum.faceKeypoints3D);
             std::swap(handKeypoints3D, datum.handKeypoints3D);
+            std::swap(poseFloorPositions, datum.poseFloorPositions);
             std::swap(cameraMatrix, datum.cameraMatrix);
             // Other parameters
             std::swap(scaleInputToNetInputs, datum.scaleInputToNetInputs);
             std::swap(netInputSizes, datum.netInputSizes);
+            std::swap(netInputRectangle, datum.netInputRectangle);
             std::swap(elementRendered, datum.elementRendered);
             // 3D/Adam parameters
             #ifdef USE_3D_ADAM_MODEL
@@ -276,6 +296,10 @@ namespace op
                     std::swap(vtVec, datum.vtVec);
                     std::swap(j0Vec, datum.j0Vec);
                     std::swap(adamFaceCoeffsExp, datum.adamFaceCoeffsExp);
+                    // Adam/Unity params of each person
+                    std::swap(adamPoses, datum.adamPoses);
+                    std::swap(adamTranslations, datum.adamTranslations);
+                    std::swap(adamFaceCoeffsExps, datum.adamFaceCoeffsExps);
                 #endif
             #endif
             // Return
@@ -330,10 +354,12 @@ namespace op
             datum.faceKeypoints3D = faceKeypoints3D.clone();
             for (auto i = 0u ; i < datum.handKeypoints.size() ; i++)
                 datum.handKeypoints3D[i] = handKeypoints3D[i].clone();
+            datum.poseFloorPositions = poseFloorPositions.clone();
             datum.cameraMatrix = cameraMatrix.clone();
             // Other parameters
             datum.scaleInputToNetInputs = scaleInputToNetInputs;
             datum.netInputSizes = netInputSizes;
+            datum.netInputRectangle = netInputRectangle;
             datum.scaleInputToOutput = scaleInputToOutput;
             datum.scaleNetToOutput = scaleNetToOutput;
             datum.elementRendered = elementRendered;
@@ -358,6 +384,10 @@ namespace op
                     datum.vtVec = vtVec;
                     datum.j0Vec = j0Vec;
                     datum.adamFaceCoeffsExp = adamFaceCoeffsExp;
+                    // Adam/Unity params of each person
+                    datum.adamPoses = adamPoses;
+                    datum.adamTranslations = adamTranslations;
+                    datum.adamFaceCoeffsExps = adamFaceCoeffsExps;
                 #endif
             #endif
             // Return
@@ -18,8 +18,10 @@ namespace op
     {
         try
         {
-            // Remove people if #people > mNumberPeopleMax
-            if (peopleArray.getSize(0) > mNumberPeopleMax && mNumberPeopleMax > 0)
+            // Read once, it might be modified at runtime
+            const int numberPeopleMax = mNumberPeopleMax;
+            // Remove people if #people > numberPeopleMax
+            if (peopleArray.getSize(0) > numberPeopleMax && numberPeopleMax > 0)
             {
                 // Sanity checks
                 if (poseScores.getVolume() != (unsigned int) poseScores.getSize(0))
@@ -38,7 +40,7 @@ namespace op
                 auto poseScoresSorted = poseFinalScores.clone();
                 std::sort(poseScoresSorted.getPtr(), poseScoresSorted.getPtr() + poseScoresSorted.getSize(0),
                           std::greater<float>());
-                const auto threshold = poseScoresSorted[mNumberPeopleMax-1];
+                const auto threshold = poseScoresSorted[numberPeopleMax-1];
 
                 // Get number people above threshold
                 auto numberPeopleAboveThreshold = 0;
@@ -50,14 +52,14 @@ namespace op
                 // assignedPeopleOnThreshold avoids that people with repeated threshold remove higher elements.
                 // In our case, it will keep the first N people with score = threshold, while keeping all the
                 // people with higher scores.
-                // E.g., poseFinalScores = [0, 0.5, 0.5, 0.5, 1.0]; mNumberPeopleMax = 2
+                // E.g., poseFinalScores = [0, 0.5, 0.5, 0.5, 1.0]; numberPeopleMax = 2
                 // Naively, we could accidentally keep the first 2x 0.5 and remove the 1.0 threshold.
                 // Our method keeps the first 0.5 and 1.0.
-                Array<float> topPeopleArray({mNumberPeopleMax, peopleArray.getSize(1), peopleArray.getSize(2)});
+                Array<float> topPeopleArray({numberPeopleMax, peopleArray.getSize(1), peopleArray.getSize(2)});
                 const auto personArea = (int)peopleArray.getVolume(1, 2);
                 auto assignedPeopleOnThreshold = 0;
                 auto nextPersonIndex = 0;
-                const auto numberPeopleOnThresholdToBeAdded = mNumberPeopleMax - numberPeopleAboveThreshold;
+                const auto numberPeopleOnThresholdToBeAdded = numberPeopleMax - numberPeopleAboveThreshold;
                 for (auto person = 0 ; person < (int)poseFinalScores.getVolume() ; person++)
                 {
                     if (poseFinalScores[person] >= threshold)
@@ -90,4 +92,29 @@ namespace op
             return Array<float>{};
         }
     }
+
+    int KeepTopNPeople::getNumberPeopleMax() const
+    {
+        try
+        {
+            return mNumberPeopleMax;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return -1;
+        }
+    }
+
+    void KeepTopNPeople::setNumberPeopleMax(const int numberPeopleMax)
+    {
+        try
+        {
+            mNumberPeopleMax = numberPeopleMax;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
 }
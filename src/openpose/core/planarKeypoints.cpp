@@ -0,0 +1,115 @@
+#include <openpose/core/planarKeypoints.hpp>
+#include <algorithm> // std::fill
+
+namespace op
+{
+    template<typename T>
+    PlanarKeypoints<T>::PlanarKeypoints(const Array<T>& keypoints) :
+        mNumberParts{0}
+    {
+        try
+        {
+            setFrom(keypoints);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename T>
+    void PlanarKeypoints<T>::setFrom(const Array<T>& keypoints)
+    {
+        try
+        {
+            if (!keypoints.empty())
+            {
+                // Sanity check
+                if (keypoints.getNumberDimensions() != 3
+                    || (keypoints.getSize(2) != 3 && keypoints.getSize(2) != 4))
+                    error("The Array<T> is not a (x,y,score) or (x,y,z,score) format array. This function is only"
+                          " for those 2 dimensions: [sizeA x sizeB x 3or4].", __LINE__, __FUNCTION__, __FILE__);
+                // Allocate planes
+                const auto numberPeople = keypoints.getSize(0);
+                const auto numberChannels = keypoints.getSize(2);
+                mNumberParts = keypoints.getSize(1);
+                const auto planeStep = PLANAR_KEYPOINTS_PADDING
+                                     * ((mNumberParts + PLANAR_KEYPOINTS_PADDING - 1) / PLANAR_KEYPOINTS_PADDING);
+                mPlanes.reset({numberPeople, numberChannels, planeStep});
+                // Interleaved to planar
+                const auto* keypointPtr = keypoints.getConstPtr();
+                for (auto person = 0 ; person < numberPeople ; person++)
+                {
+                    for (auto channel = 0 ; channel < numberChannels ; channel++)
+                    {
+                        auto* planePtr = getPlane(person, channel);
+                        for (auto part = 0 ; part < mNumberParts ; part++)
+                            planePtr[part] = keypointPtr[part*numberChannels + channel];
+                        // Padding (i.e., score 0)
+                        std::fill(planePtr + mNumberParts, planePtr + planeStep, T(0));
+                    }
+                    keypointPtr += mNumberParts*numberChannels;
+                }
+            }
+            else
+            {
+                mPlanes.reset();
+                mNumberParts = 0;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename T>
+    void PlanarKeypoints<T>::copyTo(Array<T>& keypoints) const
+    {
+        try
+        {
+            if (!mPlanes.empty())
+            {
+                const auto numberPeople = getNumberPeople();
+                const auto numberChannels = getNumberChannels();
+                keypoints.reset({numberPeople, mNumberParts, numberChannels});
+                // Planar to interleaved
+                auto* keypointPtr = keypoints.getPtr();
+                for (auto person = 0 ; person < numberPeople ; person++)
+                {
+                    for (auto channel = 0 ; channel < numberChannels ; channel++)
+                    {
+                        const auto* planePtr = getPlane(person, channel);
+                        for (auto part = 0 ; part < mNumberParts ; part++)
+                            keypointPtr[part*numberChannels + channel] = planePtr[part];
+                    }
+                    keypointPtr += mNumberParts*numberChannels;
+                }
+            }
+            else
+                keypoints.reset();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename T>
+    Array<T> PlanarKeypoints<T>::toArray() const
+    {
+        try
+        {
+            Array<T> keypoints;
+            copyTo(keypoints);
+            return keypoints;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Array<T>{};
+        }
+    }
+
+    COMPILE_TEMPLATE_FLOATING_TYPES_CLASS(PlanarKeypoints);
+}
@@ -4,14 +4,7 @@
 
 namespace op
 {
-    ScaleAndSizeExtractor::ScaleAndSizeExtractor(const Point<int>& netInputResolution,
-        const float netInputResolutionDynamicBehavior, const Point<int>& outputResolution, const int scaleNumber,
-        const double scaleGap) :
-        mNetInputResolution{netInputResolution},
-        mNetInputResolutionDynamicBehavior{netInputResolutionDynamicBehavior},
-        mOutputSize{outputResolution},
-        mScaleNumber{scaleNumber},
-        mScaleGap{scaleGap}
+    void checkNetInputResolution(const Point<int>& netInputResolution, const int scaleNumber, const double scaleGap)
     {
         try
         {
@@ -30,6 +23,25 @@ namespace op
         }
     }
 
+    ScaleAndSizeExtractor::ScaleAndSizeExtractor(const Point<int>& netInputResolution,
+        const float netInputResolutionDynamicBehavior, const Point<int>& outputResolution, const int scaleNumber,
+        const double scaleGap) :
+        mNetInputResolution{netInputResolution},
+        mNetInputResolutionDynamicBehavior{netInputResolutionDynamicBehavior},
+        mOutputSize{outputResolution},
+        mScaleNumber{scaleNumber},
+        mScaleGap{scaleGap}
+    {
+        try
+        {
+            checkNetInputResolution(netInputResolution, scaleNumber, scaleGap);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     ScaleAndSizeExtractor::~ScaleAndSizeExtractor()
     {
     }
@@ -42,8 +54,13 @@ namespace op
             // Sanity check
             if (inputResolution.area() <= 0)
                 error("Wrong input element (empty cvInputData).", __LINE__, __FUNCTION__, __FILE__);
-            // Set poseNetInputSize
+            // Runtime-modifiable parameters (copied once, so the whole frame uses the same values)
+            std::unique_lock<std::mutex> lock{mMutex};
             auto poseNetInputSize = mNetInputResolution;
+            const auto scaleNumber = mScaleNumber;
+            const auto scaleGap = mScaleGap;
+            lock.unlock();
+            // Set poseNetInputSize
             if (poseNetInputSize.x <= 0 || poseNetInputSize.y <= 0)
             {
                 // Sanity check
@@ -69,11 +86,11 @@ namespace op
                 }
             }
             // scaleInputToNetInputs & netInputSizes - Reescale keeping aspect ratio
-            std::vector<double> scaleInputToNetInputs(mScaleNumber, 1.f);
-            std::vector<Point<int>> netInputSizes(mScaleNumber);
-            for (auto i = 0; i < mScaleNumber; i++)
+            std::vector<double> scaleInputToNetInputs(scaleNumber, 1.f);
+            std::vector<Point<int>> netInputSizes(scaleNumber);
+            for (auto i = 0; i < scaleNumber; i++)
             {
-                const auto currentScale = 1. - i*mScaleGap;
+                const auto currentScale = 1. - i*scaleGap;
                 if (currentScale < 0. || 1. < currentScale)
                     error("All scales must be in the range [0, 1], i.e., 0 <= 1-scale_number*scale_gap <= 1",
                           __LINE__, __FUNCTION__, __FILE__);
@@ -110,4 +127,21 @@ namespace op
             return std::make_tuple(std::vector<double>{}, std::vector<Point<int>>{}, 1., Point<int>{});
         }
     }
+
+    void ScaleAndSizeExtractor::setNetInputResolution(
+        const Point<int>& netInputResolution, const int scaleNumber, const double scaleGap)
+    {
+        try
+        {
+            checkNetInputResolution(netInputResolution, scaleNumber, scaleGap);
+            const std::lock_guard<std::mutex> lock{mMutex};
+            mNetInputResolution = netInputResolution;
+            mScaleNumber = scaleNumber;
+            mScaleGap = scaleGap;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
 }
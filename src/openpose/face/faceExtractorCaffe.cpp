@@ -18,6 +18,7 @@ namespace op
         #ifdef USE_CAFFE
             bool netInitialized;
             const int mGpuId;
+            const bool mFastStartup;
             std::shared_ptr<NetCaffe> spNetCaffe;
             std::shared_ptr<ResizeAndMergeCaffe<float>> spResizeAndMergeCaffe;
             std::shared_ptr<MaximumCaffe<float>> spMaximumCaffe;
@@ -26,11 +27,13 @@ namespace op
             std::shared_ptr<ArrayCpuGpu<float>> spHeatMapsBlob;
             std::shared_ptr<ArrayCpuGpu<float>> spPeaksBlob;
 
-            ImplFaceExtractorCaffe(const std::string& modelFolder, const int gpuId, const bool enableGoogleLogging) :
+            ImplFaceExtractorCaffe(const std::string& modelFolder, const int gpuId, const bool enableGoogleLogging,
+                                   const bool fastStartup) :
                 netInitialized{false},
                 mGpuId{gpuId},
+                mFastStartup{fastStartup},
                 spNetCaffe{std::make_shared<NetCaffe>(modelFolder + FACE_PROTOTXT, modelFolder + FACE_TRAINED_MODEL,
-                                                      gpuId, enableGoogleLogging)},
+                                                      gpuId, enableGoogleLogging, "net_output", fastStartup)},
                 spResizeAndMergeCaffe{std::make_shared<ResizeAndMergeCaffe<float>>()},
                 spMaximumCaffe{std::make_shared<MaximumCaffe<float>>()}
             {
@@ -109,10 +112,11 @@ namespace op
     FaceExtractorCaffe::FaceExtractorCaffe(const Point<int>& netInputSize, const Point<int>& netOutputSize,
                                            const std::string& modelFolder, const int gpuId,
                                            const std::vector<HeatMapType>& heatMapTypes,
-                                           const ScaleMode heatMapScaleMode, const bool enableGoogleLogging) :
+                                           const ScaleMode heatMapScaleMode, const bool enableGoogleLogging,
+                                           const bool fastStartup) :
         FaceExtractorNet{netInputSize, netOutputSize, heatMapTypes, heatMapScaleMode}
         #ifdef USE_CAFFE
-        , upImpl{new ImplFaceExtractorCaffe{modelFolder, gpuId, enableGoogleLogging}}
+        , upImpl{new ImplFaceExtractorCaffe{modelFolder, gpuId, enableGoogleLogging, fastStartup}}
         #endif
     {
         try
@@ -125,6 +129,7 @@ namespace op
                 UNUSED(heatMapTypes);
                 UNUSED(heatMapScaleMode);
                 UNUSED(enableGoogleLogging);
+                UNUSED(fastStartup);
                 error("OpenPose must be compiled with the `USE_CAFFE` & `USE_CUDA` macro definitions in order to run"
                       " this functionality.", __LINE__, __FUNCTION__, __FILE__);
             #endif
@@ -162,6 +167,17 @@ namespace op
                 #ifdef USE_CUDA
                     cudaCheck(__LINE__, __FUNCTION__, __FILE__);
                 #endif
+                // Fast startup: Warm-up pass, so the first frame with a face does not pay for the net and blob
+                // reshape (nor for the first-time GPU kernel and memory allocations)
+                if (upImpl->mFastStartup)
+                {
+                    mFaceImageCrop.setTo(0.f);
+                    upImpl->spNetCaffe->forwardPass(mFaceImageCrop);
+                    upImpl->netInitialized = true;
+                    reshapeFaceExtractorCaffe(
+                        upImpl->spResizeAndMergeCaffe, upImpl->spMaximumCaffe, upImpl->spCaffeNetOutputBlob,
+                        upImpl->spHeatMapsBlob, upImpl->spPeaksBlob, upImpl->mGpuId);
+                }
                 // Logging
                 opLog("Finished initialization on thread.", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             #endif
@@ -1,24 +1,53 @@
 #ifdef USE_3D_ADAM_MODEL
 #include <openpose/filestream/bvhSaver.hpp>
+#include <condition_variable>
+#include <cstdio> // std::remove
+#include <fstream>
+#include <iomanip> // std::setw
+#include <mutex>
+#include <sstream>
+#include <thread>
 #ifdef USE_3D_ADAM_MODEL
     #include <adam/BVHWriter.h>
 #endif
 
 namespace op
 {
+    #ifdef USE_3D_ADAM_MODEL
+        // Number of frames converted and appended to the BVH file at once by the background writer
+        const auto BVH_FRAMES_PER_CHUNK = 256u;
+        // Maximum number of frames waiting to be written. If reached (e.g., very slow disk), updateBvh blocks
+        const auto BVH_MAX_PENDING_FRAMES = 4u*BVH_FRAMES_PER_CHUNK;
+        // Width of the `Frames:` value, so it can be patched in-place as the file grows
+        const auto BVH_NUMBER_FRAMES_WIDTH = 20;
+    #endif
+
     struct BvhSaver::ImplBvhSaver
     {
         #ifdef USE_3D_ADAM_MODEL
+            typedef Eigen::Matrix<double, TotalModel::NUM_JOINTS, 3, Eigen::RowMajor> AdamPose;
+
             // Write BVH file
             const std::string mBvhFilePath;
+            const std::string mChunkFilePath;
             const double mFps;
-            std::unique_ptr<BVHWriter> spBvhWriter;
-            // Record the translation across frames
-            std::vector<Eigen::Matrix<double, 3, 1>> mTranslations;
-            // Record the pose change
-            std::vector<Eigen::Matrix<double, TotalModel::NUM_JOINTS, 3, Eigen::RowMajor>> mPoses;
+            std::ofstream mBvhFile;
+            std::streampos mNumberFramesPosition;
+            unsigned long long mNumberFramesWritten;
+            // Frame 0 (the BVH skeleton and the root translation are defined by it)
             Eigen::Matrix<double, Eigen::Dynamic, 1> mJ0VecFrame0;
+            AdamPose mPoseFrame0;
+            Eigen::Matrix<double, 3, 1> mTranslationFrame0;
             bool mInitialized;
+            // Frames not written yet (bounded, so memory does not grow with the session length)
+            std::vector<Eigen::Matrix<double, 3, 1>> mTranslations;
+            std::vector<AdamPose> mPoses;
+            // Background writer
+            std::thread mWriterThread;
+            std::mutex mMutex;
+            std::condition_variable mConditionVariable;
+            bool mStopWriter;
+            std::string mWriterError;
 
             // Shared parameters
             const std::shared_ptr<const TotalModel> spTotalModel;
@@ -26,8 +55,11 @@ namespace op
             ImplBvhSaver(const std::string bvhFilePath, const std::shared_ptr<const TotalModel>& totalModel,
                          const double fps) :
                 mBvhFilePath{bvhFilePath},
+                mChunkFilePath{bvhFilePath + ".chunk.tmp"},
                 mFps{fps},
+                mNumberFramesWritten{0ull},
                 mInitialized{false},
+                mStopWriter{false},
                 spTotalModel{totalModel}
             {
                 try
@@ -35,6 +67,8 @@ namespace op
                     // Sanity check
                     if (!mBvhFilePath.empty() && spTotalModel == nullptr)
                         error("Given totalModel is a nullptr.", __LINE__, __FUNCTION__, __FILE__);
+                    mTranslations.reserve(BVH_MAX_PENDING_FRAMES);
+                    mPoses.reserve(BVH_MAX_PENDING_FRAMES);
                 }
                 catch (const std::exception& e)
                 {
@@ -42,18 +76,150 @@ namespace op
                 }
             }
 
-            void writeBvhOnDisk()
+            void stopWriter()
             {
                 try
                 {
-                    if (!mBvhFilePath.empty())
+                    if (mWriterThread.joinable())
                     {
-                        const auto secondsPerFrame = 1./mFps;
-                        const bool unityCompatible = true;
-                        spBvhWriter.reset(new BVHWriter{spTotalModel->m_parent, unityCompatible});
-                        spBvhWriter->parseInput(mJ0VecFrame0, mTranslations, mPoses);
-                        spBvhWriter->writeBVH(mBvhFilePath, secondsPerFrame);
+                        {
+                            const std::lock_guard<std::mutex> lock{mMutex};
+                            mStopWriter = true;
+                        }
+                        mConditionVariable.notify_all();
+                        mWriterThread.join();
+                        std::remove(mChunkFilePath.c_str());
                     }
+                    if (!mWriterError.empty())
+                        error("Error writing " + mBvhFilePath + ": " + mWriterError, __LINE__, __FUNCTION__, __FILE__);
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
+            }
+
+            void writerThread()
+            {
+                try
+                {
+                    std::vector<Eigen::Matrix<double, 3, 1>> translations;
+                    std::vector<AdamPose> poses;
+                    translations.reserve(BVH_MAX_PENDING_FRAMES + 1);
+                    poses.reserve(BVH_MAX_PENDING_FRAMES + 1);
+                    auto stop = false;
+                    while (!stop)
+                    {
+                        // Wait for a full chunk (or the end of the session)
+                        {
+                            std::unique_lock<std::mutex> lock{mMutex};
+                            mConditionVariable.wait(
+                                lock, [this]{ return mStopWriter || mPoses.size() >= BVH_FRAMES_PER_CHUNK; });
+                            stop = mStopWriter;
+                            std::swap(translations, mTranslations);
+                            std::swap(poses, mPoses);
+                        }
+                        // Wake up updateBvh if it was blocked
+                        mConditionVariable.notify_all();
+                        if (!poses.empty())
+                            appendFrames(translations, poses);
+                        translations.clear();
+                        poses.clear();
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    const std::lock_guard<std::mutex> lock{mMutex};
+                    mWriterError = e.what();
+                    mStopWriter = true;
+                    mConditionVariable.notify_all();
+                }
+            }
+
+            // BVHWriter only writes whole files, so each chunk is converted into a temporary BVH file whose MOTION
+            // lines are appended to the final one. Frame 0 is prepended to every chunk (and its line skipped), so
+            // the skeleton and root of every chunk are the ones of the first one.
+            void appendFrames(std::vector<Eigen::Matrix<double, 3, 1>>& translations, std::vector<AdamPose>& poses)
+            {
+                try
+                {
+                    const auto isFirstChunk = !mBvhFile.is_open();
+                    if (!isFirstChunk)
+                    {
+                        translations.insert(translations.begin(), mTranslationFrame0);
+                        poses.insert(poses.begin(), mPoseFrame0);
+                    }
+                    // Convert chunk
+                    const auto secondsPerFrame = 1./mFps;
+                    const bool unityCompatible = true;
+                    BVHWriter bvhWriter{spTotalModel->m_parent, unityCompatible};
+                    bvhWriter.parseInput(mJ0VecFrame0, translations, poses);
+                    bvhWriter.writeBVH(mChunkFilePath, secondsPerFrame);
+                    std::ifstream chunkFile{mChunkFilePath};
+                    if (!chunkFile.is_open())
+                        error("Temporary file " + mChunkFilePath + " could not be opened.",
+                              __LINE__, __FUNCTION__, __FILE__);
+                    std::string line;
+                    // Header (HIERARCHY + MOTION + Frames + Frame Time), written only once
+                    while (std::getline(chunkFile, line) && line.compare(0, 6, "MOTION") != 0)
+                        if (isFirstChunk)
+                            writeLine(line);
+                    if (isFirstChunk)
+                        writeLine("MOTION");
+                    for (auto i = 0 ; i < 2 && std::getline(chunkFile, line) ; i++)
+                    {
+                        if (isFirstChunk)
+                        {
+                            // Placeholder for the number of frames, patched after every chunk
+                            if (line.compare(0, 7, "Frames:") == 0)
+                            {
+                                mBvhFile << "Frames: ";
+                                mNumberFramesPosition = mBvhFile.tellp();
+                                mBvhFile << std::setw(BVH_NUMBER_FRAMES_WIDTH) << 0 << "\n";
+                            }
+                            else
+                                writeLine(line);
+                        }
+                    }
+                    // Motion lines
+                    if (!isFirstChunk)
+                        std::getline(chunkFile, line);
+                    while (std::getline(chunkFile, line))
+                    {
+                        if (!line.empty())
+                        {
+                            writeLine(line);
+                            mNumberFramesWritten++;
+                        }
+                    }
+                    // Patch the number of frames, so the file is valid after each chunk (e.g., if the program crashes)
+                    const auto endPosition = mBvhFile.tellp();
+                    mBvhFile.seekp(mNumberFramesPosition);
+                    mBvhFile << std::setw(BVH_NUMBER_FRAMES_WIDTH) << mNumberFramesWritten;
+                    mBvhFile.seekp(endPosition);
+                    mBvhFile.flush();
+                    if (!mBvhFile.good())
+                        error("BVH file " + mBvhFilePath + " could not be written.", __LINE__, __FUNCTION__, __FILE__);
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
+            }
+
+            void writeLine(const std::string& line)
+            {
+                try
+                {
+                    // Opened on the first written line, so no empty BVH file is created if no person is ever detected
+                    if (!mBvhFile.is_open())
+                    {
+                        mBvhFile.open(mBvhFilePath, std::ios::out | std::ios::trunc | std::ios::binary);
+                        if (!mBvhFile.is_open())
+                            error("BVH file " + mBvhFilePath + " could not be opened.",
+                                  __LINE__, __FUNCTION__, __FILE__);
+                    }
+                    mBvhFile << line << "\n";
                 }
                 catch (const std::exception& e)
                 {
@@ -89,7 +255,8 @@ namespace op
         try
         {
             #ifdef USE_3D_ADAM_MODEL
-                spImpl->writeBvhOnDisk();
+                // Write remaining frames
+                spImpl->stopWriter();
             #endif
         }
         catch (const std::exception& e)
@@ -109,13 +276,34 @@ namespace op
         try
         {
             #ifdef USE_3D_ADAM_MODEL
-                // BVH-Unity generation
-                spImpl->mPoses.push_back(adamPose);
-                spImpl->mTranslations.push_back(adamTranslation);
-                if (!spImpl->mInitialized)
+                if (!spImpl->mBvhFilePath.empty())
                 {
-                    spImpl->mJ0VecFrame0 = j0Vec;
-                    spImpl->mInitialized = true;
+                    std::unique_lock<std::mutex> lock{spImpl->mMutex};
+                    // Background writer failed
+                    if (!spImpl->mWriterError.empty())
+                    {
+                        lock.unlock();
+                        spImpl->stopWriter();
+                    }
+                    // BVH-Unity generation
+                    if (!spImpl->mInitialized)
+                    {
+                        spImpl->mJ0VecFrame0 = j0Vec;
+                        spImpl->mPoseFrame0 = adamPose;
+                        spImpl->mTranslationFrame0 = adamTranslation;
+                        spImpl->mInitialized = true;
+                        spImpl->mWriterThread = std::thread{&ImplBvhSaver::writerThread, spImpl.get()};
+                    }
+                    // Bounded memory - Wait for the background writer if it is too far behind
+                    spImpl->mConditionVariable.wait(
+                        lock, [this]{ return spImpl->mPoses.size() < BVH_MAX_PENDING_FRAMES || spImpl->mStopWriter; });
+                    spImpl->mPoses.emplace_back(adamPose);
+                    spImpl->mTranslations.emplace_back(adamTranslation);
+                    if (spImpl->mPoses.size() >= BVH_FRAMES_PER_CHUNK)
+                    {
+                        lock.unlock();
+                        spImpl->mConditionVariable.notify_all();
+                    }
                 }
             #else
                 UNUSED(adamPose);
@@ -0,0 +1,417 @@
+#include <openpose/filestream/datumSerializer.hpp>
+#include <cstdint> // std::uintptr_t
+#include <cstring> // std::memcmp, std::memcpy
+#include <limits> // std::numeric_limits
+
+namespace op
+{
+    const auto DATUM_SERIALIZER_VERSION = (unsigned short)1;
+    const char DATUM_SERIALIZER_MAGIC[4]{'O', 'P', 'D', 'T'};
+    const auto DATUM_SERIALIZER_ALIGNMENT = 8u;
+
+    // Serialization
+    void appendSerializedBytes(std::vector<unsigned char>& buffer, const void* const data, const std::size_t size)
+    {
+        const auto* const bytesPtr = (const unsigned char*)data;
+        buffer.insert(buffer.end(), bytesPtr, bytesPtr + size);
+    }
+
+    template<typename T>
+    void appendSerializedValue(std::vector<unsigned char>& buffer, const T value)
+    {
+        appendSerializedBytes(buffer, &value, sizeof(T));
+    }
+
+    // Padding up to DATUM_SERIALIZER_ALIGNMENT bytes (relative to the beginning of the record)
+    void appendSerializedPadding(std::vector<unsigned char>& buffer, const std::size_t recordBegin)
+    {
+        const auto remainder = (buffer.size() - recordBegin) % DATUM_SERIALIZER_ALIGNMENT;
+        if (remainder > 0)
+            buffer.resize(buffer.size() + DATUM_SERIALIZER_ALIGNMENT - remainder, 0);
+    }
+
+    void appendSerializedString(
+        std::vector<unsigned char>& buffer, const std::string& string, const std::size_t recordBegin)
+    {
+        appendSerializedValue(buffer, (unsigned long long)string.size());
+        appendSerializedBytes(buffer, string.data(), string.size());
+        appendSerializedPadding(buffer, recordBegin);
+    }
+
+    template<typename T>
+    void appendSerializedArray(
+        std::vector<unsigned char>& buffer, const Array<T>& array, const std::size_t recordBegin)
+    {
+        const auto numberDimensions = (int)array.getNumberDimensions();
+        appendSerializedValue(buffer, (unsigned int)numberDimensions);
+        for (auto i = 0 ; i < numberDimensions ; i++)
+            appendSerializedValue(buffer, array.getSize(i));
+        appendSerializedPadding(buffer, recordBegin);
+        if (!array.empty())
+            appendSerializedBytes(buffer, array.getConstPtr(), array.getVolume() * sizeof(T));
+        appendSerializedPadding(buffer, recordBegin);
+    }
+
+    void appendSerializedMatrix(
+        std::vector<unsigned char>& buffer, const Matrix& matrix, const std::size_t recordBegin)
+    {
+        if (matrix.empty())
+        {
+            const int header[4]{0, 0, 0, 0};
+            appendSerializedBytes(buffer, header, sizeof(header));
+            return;
+        }
+        if (matrix.dims() != 2)
+            error("Only 2-D images can be serialized (dims = " + std::to_string(matrix.dims()) + ").",
+                  __LINE__, __FUNCTION__, __FILE__);
+        const int header[4]{matrix.rows(), matrix.cols(), matrix.type(), 0};
+        appendSerializedBytes(buffer, header, sizeof(header));
+        // Row by row, in case it is not continuous (e.g., a ROI)
+        const auto rowSize = matrix.cols() * matrix.elemSize();
+        const auto rowStep = matrix.step1() * matrix.elemSize1();
+        const auto* const matrixPtr = matrix.dataConst();
+        for (auto row = 0 ; row < matrix.rows() ; row++)
+            appendSerializedBytes(buffer, matrixPtr + row*rowStep, rowSize);
+        appendSerializedPadding(buffer, recordBegin);
+    }
+
+    void appendSerializedRectangle(std::vector<unsigned char>& buffer, const Rectangle<float>& rectangle)
+    {
+        const float values[4]{rectangle.x, rectangle.y, rectangle.width, rectangle.height};
+        appendSerializedBytes(buffer, values, sizeof(values));
+    }
+
+    // Deserialization
+    // It checks that there are at least number elements of elementSize bytes left (without overflowing)
+    void checkDeserializedSize(
+        const unsigned char* const dataPtr, const unsigned char* const dataEnd, const unsigned long long number,
+        const std::size_t elementSize = 1)
+    {
+        if (dataPtr > dataEnd || number > (std::size_t)(dataEnd - dataPtr) / elementSize)
+            error("Serialized Datum truncated.", __LINE__, __FUNCTION__, __FILE__);
+    }
+
+    template<typename T>
+    T readDeserializedValue(const unsigned char*& dataPtr, const unsigned char* const dataEnd)
+    {
+        checkDeserializedSize(dataPtr, dataEnd, sizeof(T));
+        T value;
+        std::memcpy(&value, dataPtr, sizeof(T));
+        dataPtr += sizeof(T);
+        return value;
+    }
+
+    void skipDeserializedPadding(
+        const unsigned char*& dataPtr, const unsigned char* const dataEnd, const unsigned char* const recordBegin)
+    {
+        const auto remainder = (std::size_t)(dataPtr - recordBegin) % DATUM_SERIALIZER_ALIGNMENT;
+        if (remainder > 0)
+        {
+            checkDeserializedSize(dataPtr, dataEnd, DATUM_SERIALIZER_ALIGNMENT - remainder);
+            dataPtr += DATUM_SERIALIZER_ALIGNMENT - remainder;
+        }
+    }
+
+    std::string readDeserializedString(
+        const unsigned char*& dataPtr, const unsigned char* const dataEnd, const unsigned char* const recordBegin)
+    {
+        const auto size = readDeserializedValue<unsigned long long>(dataPtr, dataEnd);
+        checkDeserializedSize(dataPtr, dataEnd, size);
+        const std::string string{(const char*)dataPtr, (std::size_t)size};
+        dataPtr += size;
+        skipDeserializedPadding(dataPtr, dataEnd, recordBegin);
+        return string;
+    }
+
+    template<typename T>
+    Array<T> readDeserializedArray(
+        const unsigned char*& dataPtr, const unsigned char* const dataEnd, const unsigned char* const recordBegin,
+        const bool zeroCopy)
+    {
+        // Sizes
+        const auto numberDimensions = (int)readDeserializedValue<unsigned int>(dataPtr, dataEnd);
+        if (numberDimensions > ARRAY_MAX_NUMBER_DIMENSIONS)
+            error("Serialized Array<T> with too many dimensions (" + std::to_string(numberDimensions) + ").",
+                  __LINE__, __FUNCTION__, __FILE__);
+        std::vector<int> sizes(numberDimensions);
+        auto volume = (std::size_t)(numberDimensions > 0 ? 1 : 0);
+        for (auto i = 0 ; i < numberDimensions ; i++)
+        {
+            sizes[i] = readDeserializedValue<int>(dataPtr, dataEnd);
+            if (sizes[i] < 0 || (sizes[i] > 0 && volume > std::numeric_limits<std::size_t>::max() / sizes[i]))
+                error("Serialized Array<T> with invalid sizes.", __LINE__, __FUNCTION__, __FILE__);
+            volume *= sizes[i];
+        }
+        skipDeserializedPadding(dataPtr, dataEnd, recordBegin);
+        // Data
+        Array<T> array;
+        if (volume > 0)
+        {
+            checkDeserializedSize(dataPtr, dataEnd, volume, sizeof(T));
+            if (zeroCopy && (std::uintptr_t)dataPtr % alignof(T) == 0)
+                array.reset(sizes, (T*)dataPtr);
+            else
+            {
+                array.reset(sizes);
+                std::memcpy(array.getPtr(), dataPtr, volume * sizeof(T));
+            }
+            dataPtr += volume * sizeof(T);
+            skipDeserializedPadding(dataPtr, dataEnd, recordBegin);
+        }
+        return array;
+    }
+
+    Matrix readDeserializedMatrix(
+        const unsigned char*& dataPtr, const unsigned char* const dataEnd, const unsigned char* const recordBegin,
+        const bool zeroCopy)
+    {
+        int header[4];
+        checkDeserializedSize(dataPtr, dataEnd, sizeof(header));
+        std::memcpy(header, dataPtr, sizeof(header));
+        dataPtr += sizeof(header);
+        const auto rows = header[0];
+        const auto cols = header[1];
+        if (rows == 0 && cols == 0)
+            return Matrix{};
+        if (rows <= 0 || cols <= 0)
+            error("Serialized image with invalid size.", __LINE__, __FUNCTION__, __FILE__);
+        // Header pointing to the buffer (nothing is read yet)
+        Matrix matrix(rows, cols, header[2], (void*)dataPtr);
+        const auto elemSize = matrix.elemSize();
+        checkDeserializedSize(dataPtr, dataEnd, (unsigned long long)rows * cols, elemSize);
+        if (!zeroCopy || (std::uintptr_t)dataPtr % matrix.elemSize1() != 0)
+            matrix = matrix.clone();
+        dataPtr += (std::size_t)rows * cols * elemSize;
+        skipDeserializedPadding(dataPtr, dataEnd, recordBegin);
+        return matrix;
+    }
+
+    Rectangle<float> readDeserializedRectangle(const unsigned char*& dataPtr, const unsigned char* const dataEnd)
+    {
+        float values[4];
+        checkDeserializedSize(dataPtr, dataEnd, sizeof(values));
+        std::memcpy(values, dataPtr, sizeof(values));
+        dataPtr += sizeof(values);
+        return Rectangle<float>{values[0], values[1], values[2], values[3]};
+    }
+
+    DatumSerializer::DatumSerializer(const unsigned short fields) :
+        mFields{fields}
+    {
+        try
+        {
+            if ((mFields & ~All) != 0)
+                error("Unknown DatumSerializer::Field in the mask (" + std::to_string(mFields) + ").",
+                      __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    DatumSerializer::~DatumSerializer()
+    {
+    }
+
+    void DatumSerializer::serialize(std::vector<unsigned char>& buffer, const Datum& datum) const
+    {
+        try
+        {
+            // Header (payload size filled at the end)
+            const auto recordBegin = buffer.size();
+            appendSerializedBytes(buffer, DATUM_SERIALIZER_MAGIC, sizeof(DATUM_SERIALIZER_MAGIC));
+            appendSerializedValue(buffer, DATUM_SERIALIZER_VERSION);
+            appendSerializedValue(buffer, mFields);
+            appendSerializedValue(buffer, 0ull);
+            // Payload
+            if (mFields & Ids)
+            {
+                appendSerializedValue(buffer, datum.id);
+                appendSerializedValue(buffer, datum.subId);
+                appendSerializedValue(buffer, datum.subIdMax);
+                appendSerializedValue(buffer, datum.frameNumber);
+                appendSerializedString(buffer, datum.name, recordBegin);
+                appendSerializedArray(buffer, datum.poseIds, recordBegin);
+            }
+            if (mFields & Keypoints)
+            {
+                appendSerializedArray(buffer, datum.poseKeypoints, recordBegin);
+                appendSerializedArray(buffer, datum.faceKeypoints, recordBegin);
+                for (const auto& handKeypoints : datum.handKeypoints)
+                    appendSerializedArray(buffer, handKeypoints, recordBegin);
+                appendSerializedArray(buffer, datum.poseKeypoints3D, recordBegin);
+                appendSerializedArray(buffer, datum.faceKeypoints3D, recordBegin);
+                for (const auto& handKeypoints3D : datum.handKeypoints3D)
+                    appendSerializedArray(buffer, handKeypoints3D, recordBegin);
+            }
+            if (mFields & Scores)
+                appendSerializedArray(buffer, datum.poseScores, recordBegin);
+            if (mFields & Rectangles)
+            {
+                appendSerializedValue(buffer, (unsigned long long)datum.faceRectangles.size());
+                for (const auto& faceRectangle : datum.faceRectangles)
+                    appendSerializedRectangle(buffer, faceRectangle);
+                appendSerializedValue(buffer, (unsigned long long)datum.handRectangles.size());
+                for (const auto& handRectangles : datum.handRectangles)
+                    for (const auto& handRectangle : handRectangles)
+                        appendSerializedRectangle(buffer, handRectangle);
+            }
+            if (mFields & Images)
+            {
+                appendSerializedMatrix(buffer, datum.cvInputData, recordBegin);
+                appendSerializedMatrix(buffer, datum.cvOutputData, recordBegin);
+            }
+            if (mFields & HeatMaps)
+            {
+                appendSerializedArray(buffer, datum.poseHeatMaps, recordBegin);
+                appendSerializedArray(buffer, datum.faceHeatMaps, recordBegin);
+                for (const auto& handHeatMaps : datum.handHeatMaps)
+                    appendSerializedArray(buffer, handHeatMaps, recordBegin);
+            }
+            // Payload size
+            const auto payloadSize = (unsigned long long)(buffer.size() - recordBegin - DATUM_SERIALIZER_HEADER_SIZE);
+            std::memcpy(&buffer[recordBegin + 8], &payloadSize, sizeof(payloadSize));
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    void DatumSerializer::write(std::ostream& ostream, const Datum& datum)
+    {
+        try
+        {
+            // Buffer re-used between records, so it is only allocated once
+            mBuffer.clear();
+            serialize(mBuffer, datum);
+            ostream.write((const char*)mBuffer.data(), (std::streamsize)mBuffer.size());
+            if (!ostream)
+                error("Datum " + std::to_string(datum.id) + " could not be written into the stream.",
+                      __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    std::shared_ptr<Datum> deserializeDatum(
+        const unsigned char*& dataPtr, const unsigned char* const dataEnd, const bool zeroCopy)
+    {
+        try
+        {
+            // Header
+            const auto* const recordBegin = dataPtr;
+            checkDeserializedSize(dataPtr, dataEnd, DATUM_SERIALIZER_HEADER_SIZE);
+            if (std::memcmp(dataPtr, DATUM_SERIALIZER_MAGIC, sizeof(DATUM_SERIALIZER_MAGIC)) != 0)
+                error("The data is not a serialized Datum (wrong magic number).", __LINE__, __FUNCTION__, __FILE__);
+            dataPtr += sizeof(DATUM_SERIALIZER_MAGIC);
+            const auto version = readDeserializedValue<unsigned short>(dataPtr, dataEnd);
+            if (version != DATUM_SERIALIZER_VERSION)
+                error("Unknown serialized Datum version (" + std::to_string(version) + ").",
+                      __LINE__, __FUNCTION__, __FILE__);
+            const auto fields = readDeserializedValue<unsigned short>(dataPtr, dataEnd);
+            const auto payloadSize = readDeserializedValue<unsigned long long>(dataPtr, dataEnd);
+            checkDeserializedSize(dataPtr, dataEnd, payloadSize);
+            const auto* const recordEnd = dataPtr + payloadSize;
+            // Payload
+            auto datumPtr = std::make_shared<Datum>();
+            auto& datum = *datumPtr;
+            if (fields & DatumSerializer::Ids)
+            {
+                datum.id = readDeserializedValue<unsigned long long>(dataPtr, recordEnd);
+                datum.subId = readDeserializedValue<unsigned long long>(dataPtr, recordEnd);
+                datum.subIdMax = readDeserializedValue<unsigned long long>(dataPtr, recordEnd);
+                datum.frameNumber = readDeserializedValue<unsigned long long>(dataPtr, recordEnd);
+                datum.name = readDeserializedString(dataPtr, recordEnd, recordBegin);
+                datum.poseIds = readDeserializedArray<long long>(dataPtr, recordEnd, recordBegin, zeroCopy);
+            }
+            if (fields & DatumSerializer::Keypoints)
+            {
+                datum.poseKeypoints = readDeserializedArray<float>(dataPtr, recordEnd, recordBegin, zeroCopy);
+                datum.faceKeypoints = readDeserializedArray<float>(dataPtr, recordEnd, recordBegin, zeroCopy);
+                for (auto& handKeypoints : datum.handKeypoints)
+                    handKeypoints = readDeserializedArray<float>(dataPtr, recordEnd, recordBegin, zeroCopy);
+                datum.poseKeypoints3D = readDeserializedArray<float>(dataPtr, recordEnd, recordBegin, zeroCopy);
+                datum.faceKeypoints3D = readDeserializedArray<float>(dataPtr, recordEnd, recordBegin, zeroCopy);
+                for (auto& handKeypoints3D : datum.handKeypoints3D)
+                    handKeypoints3D = readDeserializedArray<float>(dataPtr, recordEnd, recordBegin, zeroCopy);
+            }
+            if (fields & DatumSerializer::Scores)
+                datum.poseScores = readDeserializedArray<float>(dataPtr, recordEnd, recordBegin, zeroCopy);
+            if (fields & DatumSerializer::Rectangles)
+            {
+                const auto numberFaceRectangles = readDeserializedValue<unsigned long long>(dataPtr, recordEnd);
+                checkDeserializedSize(dataPtr, recordEnd, numberFaceRectangles, 4 * sizeof(float));
+                datum.faceRectangles.resize(numberFaceRectangles);
+                for (auto& faceRectangle : datum.faceRectangles)
+                    faceRectangle = readDeserializedRectangle(dataPtr, recordEnd);
+                const auto numberHandRectangles = readDeserializedValue<unsigned long long>(dataPtr, recordEnd);
+                checkDeserializedSize(dataPtr, recordEnd, numberHandRectangles, 8 * sizeof(float));
+                datum.handRectangles.resize(numberHandRectangles);
+                for (auto& handRectangles : datum.handRectangles)
+                    for (auto& handRectangle : handRectangles)
+                        handRectangle = readDeserializedRectangle(dataPtr, recordEnd);
+            }
+            if (fields & DatumSerializer::Images)
+            {
+                datum.cvInputData = readDeserializedMatrix(dataPtr, recordEnd, recordBegin, zeroCopy);
+                datum.cvOutputData = readDeserializedMatrix(dataPtr, recordEnd, recordBegin, zeroCopy);
+            }
+            if (fields & DatumSerializer::HeatMaps)
+            {
+                datum.poseHeatMaps = readDeserializedArray<float>(dataPtr, recordEnd, recordBegin, zeroCopy);
+                datum.faceHeatMaps = readDeserializedArray<float>(dataPtr, recordEnd, recordBegin, zeroCopy);
+                for (auto& handHeatMaps : datum.handHeatMaps)
+                    handHeatMaps = readDeserializedArray<float>(dataPtr, recordEnd, recordBegin, zeroCopy);
+            }
+            // Sanity check
+            if (dataPtr != recordEnd)
+                error("Serialized Datum with unexpected payload size.", __LINE__, __FUNCTION__, __FILE__);
+            return datumPtr;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+
+    std::shared_ptr<Datum> readDatum(std::istream& istream)
+    {
+        try
+        {
+            // Header
+            std::vector<unsigned char> buffer(DATUM_SERIALIZER_HEADER_SIZE);
+            istream.read((char*)buffer.data(), DATUM_SERIALIZER_HEADER_SIZE);
+            if (istream.gcount() == 0)
+                return nullptr;
+            if (istream.gcount() != DATUM_SERIALIZER_HEADER_SIZE)
+                error("Serialized Datum truncated (header).", __LINE__, __FUNCTION__, __FILE__);
+            // Checked before allocating the payload
+            if (std::memcmp(buffer.data(), DATUM_SERIALIZER_MAGIC, sizeof(DATUM_SERIALIZER_MAGIC)) != 0)
+                error("The stream does not contain a serialized Datum (wrong magic number).",
+                      __LINE__, __FUNCTION__, __FILE__);
+            unsigned long long payloadSize;
+            std::memcpy(&payloadSize, &buffer[8], sizeof(payloadSize));
+            // Payload
+            if (payloadSize > 0)
+            {
+                buffer.resize(DATUM_SERIALIZER_HEADER_SIZE + payloadSize);
+                istream.read((char*)&buffer[DATUM_SERIALIZER_HEADER_SIZE], (std::streamsize)payloadSize);
+                if ((unsigned long long)istream.gcount() != payloadSize)
+                    error("Serialized Datum truncated (payload).", __LINE__, __FUNCTION__, __FILE__);
+            }
+            // The buffer is local, so the data must be copied
+            const auto* dataPtr = buffer.data();
+            return deserializeDatum(dataPtr, dataPtr + buffer.size(), false);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+}
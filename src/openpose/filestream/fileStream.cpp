@@ -1,16 +1,20 @@
 #include <openpose/filestream/fileStream.hpp>
 #include <fstream> // std::ifstream, std::ofstream
+#include <iterator> // std::istreambuf_iterator
 #include <opencv2/highgui/highgui.hpp> // cv::imread
 #include <openpose/utilities/fastMath.hpp>
 #include <openpose/utilities/fileSystem.hpp>
 #include <openpose/utilities/string.hpp>
 #include <openpose/filestream/jsonOfstream.hpp>
+#include <openpose/filestream/keypointPacking.hpp>
 
 namespace op
 {
     // Private class (on *.cpp)
     const auto errorMessage = "Json format only implemented in OpenCV for versions >= 3.0. Check savePoseJson"
                               " instead.";
+    const auto errorMessageBin = "DataFormat::Bin is only implemented for keypoints. Check savePackedKeypoints and"
+                                 " loadPackedKeypoints instead.";
 
     std::string getFullName(const std::string& fileNameNoExtension, const DataFormat dataFormat)
     {
@@ -24,9 +28,8 @@ namespace op
         {
             // Sanity check
             for (const auto& keypointPair : keypointVector)
-                if (!keypointPair.first.empty() && keypointPair.first.getNumberDimensions() != 3
-                    && keypointPair.first.getNumberDimensions() != 1)
-                    error("keypointVector.getNumberDimensions() != 1 && != 3.", __LINE__, __FUNCTION__, __FILE__);
+                if (!keypointPair.first.empty() && keypointPair.first.getNumberDimensions() > 3)
+                    error("keypointVector.getNumberDimensions() > 3.", __LINE__, __FUNCTION__, __FILE__);
             // Add people keypoints
             jsonOfstream.key("people");
             jsonOfstream.arrayOpen();
@@ -139,6 +142,8 @@ namespace op
                 return "yaml";
             else if (dataFormat == DataFormat::Yml)
                 return "yml";
+            else if (dataFormat == DataFormat::Bin)
+                return "bin";
             else
             {
                 error("Undefined DataFormat.", __LINE__, __FUNCTION__, __FILE__);
@@ -164,9 +169,11 @@ namespace op
                 return DataFormat::Yaml;
             else if (dataFormat == "yml")
                 return DataFormat::Yml;
+            else if (dataFormat == "bin")
+                return DataFormat::Bin;
             else
             {
-                error("String does not correspond to any known format (json, xml, yaml, yml)",
+                error("String does not correspond to any known format (json, xml, yaml, yml, bin)",
                       __LINE__, __FUNCTION__, __FILE__);
                 return DataFormat::Json;
             }
@@ -205,6 +212,53 @@ namespace op
         }
     }
 
+    void savePackedKeypoints(
+        const std::vector<Array<float>>& keypointVector, const std::string& fullFilePath, const float resolution)
+    {
+        try
+        {
+            // Pack keypoints
+            std::vector<unsigned char> buffer;
+            for (const auto& keypoints : keypointVector)
+                packKeypoints(buffer, keypoints, resolution);
+            // Save file
+            std::ofstream outputFile{fullFilePath, std::ios::binary};
+            if (!outputFile.is_open())
+                error("File " + fullFilePath + " could not be opened.", __LINE__, __FUNCTION__, __FILE__);
+            outputFile.write((char*)buffer.data(), buffer.size());
+            outputFile.close();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    std::vector<Array<float>> loadPackedKeypoints(const std::string& fullFilePath)
+    {
+        try
+        {
+            // Read file
+            std::ifstream inputFile{fullFilePath, std::ios::binary};
+            if (!inputFile.is_open())
+                error("File " + fullFilePath + " does not exist.", __LINE__, __FUNCTION__, __FILE__);
+            const std::vector<unsigned char> buffer{
+                std::istreambuf_iterator<char>{inputFile}, std::istreambuf_iterator<char>{}};
+            // Unpack keypoints
+            std::vector<Array<float>> keypointVector;
+            const auto* dataPtr = buffer.data();
+            const auto* const dataEnd = buffer.data() + buffer.size();
+            while (dataPtr < dataEnd)
+                keypointVector.emplace_back(unpackKeypoints(dataPtr, dataEnd));
+            return keypointVector;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
     void saveData(const std::vector<Matrix>& opMats, const std::vector<std::string>& cvMatNames,
                   const std::string& fileNameNoExtension, const DataFormat dataFormat)
     {
@@ -214,6 +268,8 @@ namespace op
             // Sanity checks
             if (dataFormat == DataFormat::Json && CV_MAJOR_VERSION < 3)
                 error(errorMessage, __LINE__, __FUNCTION__, __FILE__);
+            if (dataFormat == DataFormat::Bin)
+                error(errorMessageBin, __LINE__, __FUNCTION__, __FILE__);
             if (cvMats.size() != cvMatNames.size())
                 error("cvMats.size() != cvMatNames.size() (" + std::to_string(cvMats.size())
                       + " vs. " + std::to_string(cvMatNames.size()) + ")", __LINE__, __FUNCTION__, __FILE__);
@@ -252,6 +308,8 @@ namespace op
             // Sanity check
             if (dataFormat == DataFormat::Json && CV_MAJOR_VERSION < 3)
                 error(errorMessage, __LINE__, __FUNCTION__, __FILE__);
+            if (dataFormat == DataFormat::Bin)
+                error(errorMessageBin, __LINE__, __FUNCTION__, __FILE__);
             // File name
             const auto fileName = getFullName(fileNameNoExtension, dataFormat);
             // Sanity check
@@ -312,9 +370,8 @@ namespace op
         {
             // Sanity check
             for (const auto& keypointPair : keypointVector)
-                if (!keypointPair.first.empty() && keypointPair.first.getNumberDimensions() != 3
-                    && keypointPair.first.getNumberDimensions() != 1)
-                    error("keypointVector.getNumberDimensions() != 1 && != 3.", __LINE__, __FUNCTION__, __FILE__);
+                if (!keypointPair.first.empty() && keypointPair.first.getNumberDimensions() > 3)
+                    error("keypointVector.getNumberDimensions() > 3.", __LINE__, __FUNCTION__, __FILE__);
             // Record frame on desired path
             JsonOfstream jsonOfstream{fileName, humanReadable};
             jsonOfstream.objectOpen();
@@ -0,0 +1,164 @@
+#include <openpose/filestream/keypointPacking.hpp>
+#include <cstring> // std::memcpy
+#include <limits> // std::numeric_limits
+#include <openpose/utilities/fastMath.hpp>
+
+namespace op
+{
+    const auto PACKED_KEYPOINTS_VERSION = (unsigned char)1;
+    const auto PACKED_COORDINATE_MAX = 32767.f;
+
+    void checkPackableKeypoints(const Array<float>& keypoints)
+    {
+        try
+        {
+            if (!keypoints.empty())
+            {
+                if (keypoints.getNumberDimensions() != 3
+                    || (keypoints.getSize(2) != 3 && keypoints.getSize(2) != 4))
+                    error("The Array<T> is not a (x,y,score) or (x,y,z,score) format array. This function is only"
+                          " for those 2 dimensions: [sizeA x sizeB x 3or4].", __LINE__, __FUNCTION__, __FILE__);
+                if (keypoints.getSize(0) > std::numeric_limits<unsigned short>::max()
+                    || keypoints.getSize(1) > std::numeric_limits<unsigned short>::max())
+                    error("Too many people or parts to be packed (" + keypoints.printSize() + ").",
+                          __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    std::size_t getPackedKeypointsSize(const Array<float>& keypoints)
+    {
+        try
+        {
+            checkPackableKeypoints(keypoints);
+            if (keypoints.empty())
+                return PACKED_KEYPOINTS_HEADER_SIZE;
+            const auto numberKeypoints = (std::size_t)keypoints.getSize(0) * (std::size_t)keypoints.getSize(1);
+            const auto numberCoordinates = (std::size_t)(keypoints.getSize(2) - 1);
+            return PACKED_KEYPOINTS_HEADER_SIZE
+                + numberKeypoints * (numberCoordinates * sizeof(short) + sizeof(unsigned char));
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0;
+        }
+    }
+
+    void packKeypoints(std::vector<unsigned char>& buffer, const Array<float>& keypoints, const float resolution)
+    {
+        try
+        {
+            // Sanity check
+            if (!(resolution > 0.f))
+                error("The resolution must be positive (" + std::to_string(resolution) + ").",
+                      __LINE__, __FUNCTION__, __FILE__);
+            const auto packedSize = getPackedKeypointsSize(keypoints);
+            const auto numberPeople = (keypoints.empty() ? 0 : keypoints.getSize(0));
+            const auto numberParts = (keypoints.empty() ? 0 : keypoints.getSize(1));
+            const auto numberChannels = (std::size_t)(keypoints.empty() ? 0 : keypoints.getSize(2));
+            // Header
+            auto offset = buffer.size();
+            buffer.resize(offset + packedSize);
+            const unsigned short sizes[2]{(unsigned short)numberPeople, (unsigned short)numberParts};
+            std::memcpy(&buffer[offset], sizes, sizeof(sizes));
+            buffer[offset+4] = (unsigned char)numberChannels;
+            buffer[offset+5] = PACKED_KEYPOINTS_VERSION;
+            buffer[offset+6] = 0;
+            buffer[offset+7] = 0;
+            std::memcpy(&buffer[offset+8], &resolution, sizeof(float));
+            offset += PACKED_KEYPOINTS_HEADER_SIZE;
+            // Planes
+            if (!keypoints.empty())
+            {
+                const auto numberKeypoints = (std::size_t)numberPeople * (std::size_t)numberParts;
+                const auto* const keypointsPtr = keypoints.getConstPtr();
+                // Coordinates (int16). Branchless loops so they are auto-vectorized: the values are shifted to
+                // [0.5, 65534.5] (NaN to 0.5) so the truncation to int rounds them, and then shifted back
+                std::vector<short> coordinatePlane(numberKeypoints);
+                for (auto channel = 0u ; channel < numberChannels - 1 ; channel++)
+                {
+                    for (auto keypoint = 0ull ; keypoint < numberKeypoints ; keypoint++)
+                    {
+                        const auto value = keypointsPtr[keypoint*numberChannels + channel] * resolution
+                                         + PACKED_COORDINATE_MAX + 0.5f;
+                        coordinatePlane[keypoint] = (short)(
+                            (int)fastMin(fastMax(value, 0.5f), 2*PACKED_COORDINATE_MAX + 0.5f)
+                            - (int)PACKED_COORDINATE_MAX);
+                    }
+                    std::memcpy(&buffer[offset], coordinatePlane.data(), numberKeypoints * sizeof(short));
+                    offset += numberKeypoints * sizeof(short);
+                }
+                // Scores (uint8)
+                auto* scorePlanePtr = &buffer[offset];
+                for (auto keypoint = 0ull ; keypoint < numberKeypoints ; keypoint++)
+                    scorePlanePtr[keypoint] = (unsigned char)fastMin(
+                        fastMax(keypointsPtr[keypoint*numberChannels + numberChannels-1] * 255.f + 0.5f, 0.f),
+                        255.f);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    Array<float> unpackKeypoints(const unsigned char*& dataPtr, const unsigned char* const dataEnd)
+    {
+        try
+        {
+            // Header
+            if (dataEnd < dataPtr || (std::size_t)(dataEnd - dataPtr) < (std::size_t)PACKED_KEYPOINTS_HEADER_SIZE)
+                error("Packed keypoints truncated (header).", __LINE__, __FUNCTION__, __FILE__);
+            unsigned short sizes[2];
+            std::memcpy(sizes, dataPtr, sizeof(sizes));
+            const auto numberChannels = (std::size_t)dataPtr[4];
+            if (dataPtr[5] != PACKED_KEYPOINTS_VERSION)
+                error("Unknown packed keypoints version (" + std::to_string(dataPtr[5]) + ").",
+                      __LINE__, __FUNCTION__, __FILE__);
+            float resolution;
+            std::memcpy(&resolution, dataPtr + 8, sizeof(float));
+            dataPtr += PACKED_KEYPOINTS_HEADER_SIZE;
+            // Empty Array
+            Array<float> keypoints;
+            if (numberChannels == 0)
+                return keypoints;
+            // Sanity checks
+            if (numberChannels != 3 && numberChannels != 4)
+                error("Packed keypoints must have 3 or 4 channels (" + std::to_string(numberChannels) + ").",
+                      __LINE__, __FUNCTION__, __FILE__);
+            if (!(resolution > 0.f))
+                error("Packed keypoints with non-positive resolution.", __LINE__, __FUNCTION__, __FILE__);
+            // In std::size_t, as #people x #parts x bytes per keypoint might not fit in an int
+            const auto numberKeypoints = (std::size_t)sizes[0] * (std::size_t)sizes[1];
+            const auto planesSize = numberKeypoints * ((numberChannels-1) * sizeof(short) + sizeof(unsigned char));
+            if ((std::size_t)(dataEnd - dataPtr) < planesSize)
+                error("Packed keypoints truncated (data).", __LINE__, __FUNCTION__, __FILE__);
+            // Planes
+            keypoints.reset({(int)sizes[0], (int)sizes[1], (int)numberChannels});
+            auto* const keypointsPtr = keypoints.getPtr();
+            const auto stepSize = 1.f / resolution;
+            std::vector<short> coordinatePlane(numberKeypoints);
+            for (auto channel = 0u ; channel < numberChannels - 1 ; channel++)
+            {
+                std::memcpy(coordinatePlane.data(), dataPtr, numberKeypoints * sizeof(short));
+                dataPtr += numberKeypoints * sizeof(short);
+                for (auto keypoint = 0ull ; keypoint < numberKeypoints ; keypoint++)
+                    keypointsPtr[keypoint*numberChannels + channel] = coordinatePlane[keypoint] * stepSize;
+            }
+            for (auto keypoint = 0ull ; keypoint < numberKeypoints ; keypoint++)
+                keypointsPtr[keypoint*numberChannels + numberChannels-1] = dataPtr[keypoint] * (1.f / 255.f);
+            dataPtr += numberKeypoints;
+            return keypoints;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Array<float>{};
+        }
+    }
+}
@@ -3,10 +3,21 @@
 
 namespace op
 {
-    KeypointSaver::KeypointSaver(const std::string& directoryPath, const DataFormat format) :
+    KeypointSaver::KeypointSaver(
+        const std::string& directoryPath, const DataFormat format, const float packedResolution) :
         FileSaver{directoryPath},
-        mFormat{format}
+        mFormat{format},
+        mPackedResolution{packedResolution}
     {
+        try
+        {
+            if (mFormat == DataFormat::Bin && !(mPackedResolution > 0.f))
+                error("The resolution of the packed keypoints must be positive.", __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
     }
 
     KeypointSaver::~KeypointSaver()
@@ -22,6 +33,14 @@ namespace op
                 // File path (no extension)
                 const auto fileNameNoExtension = getNextFileName(fileName) + "_" + keypointName;
 
+                // Packed int16 keypoints (the Array names are implicit in their order)
+                if (mFormat == DataFormat::Bin)
+                {
+                    savePackedKeypoints(
+                        keypointVector, fileNameNoExtension + "." + dataFormatToString(mFormat), mPackedResolution);
+                    return;
+                }
+
                 // Get vector of people poses
                 std::vector<Matrix> matPoses(keypointVector.size());
                 for (auto i = 0u; i < keypointVector.size(); i++)
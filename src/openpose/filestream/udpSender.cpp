@@ -7,6 +7,7 @@
     #include <Eigen/Core>
 #endif
 #include <openpose/filestream/fileStream.hpp>
+#include <openpose/filestream/keypointPacking.hpp>
 
 namespace op
 {
@@ -94,8 +95,8 @@ namespace op
         {
             // error("UdpSender (`--udp_host` and `--udp_port` flags) buggy and not working yet, but we are"
             //       "working on it! Coming soon!", __LINE__, __FUNCTION__, __FILE__);
-            #if !defined(USE_ASIO) || !defined(USE_EIGEN)
-                error("Both `WITH_ASIO` and `WITH_EIGEN` flags must be enabled in CMake for UDP sender.",
+            #ifndef USE_ASIO
+                error("The `WITH_ASIO` flag must be enabled in CMake for UDP sender.",
                       __LINE__, __FUNCTION__, __FILE__);
                 UNUSED(udpHost);
                 UNUSED(udpPort);
@@ -171,6 +172,46 @@ namespace op
             UNUSED(adamTranslationPtr);
             UNUSED(adamFaceCoeffsExpPtr);
             UNUSED(faceCoeffRows);
+            error("Both `WITH_ASIO` and `WITH_EIGEN` flags must be enabled in CMake to send joint angles.",
+                  __LINE__, __FUNCTION__, __FILE__);
+        #endif
+    }
+
+    void UdpSender::sendKeypoints(const std::vector<Array<float>>& keypointVector,
+                                  const unsigned long long frameNumber, const float resolution)
+    {
+        #ifdef USE_ASIO
+            try
+            {
+                // Sanity check
+                if (keypointVector.size() > 255)
+                    error("Too many keypoint arrays (" + std::to_string(keypointVector.size()) + ").",
+                          __LINE__, __FUNCTION__, __FILE__);
+                // Prefix + frame number + number of arrays
+                const std::string prefix = "Keypoints:";
+                std::vector<unsigned char> buffer(prefix.begin(), prefix.end());
+                const auto frameNumberPtr = (const unsigned char*)&frameNumber;
+                buffer.insert(buffer.end(), frameNumberPtr, frameNumberPtr + sizeof(frameNumber));
+                buffer.emplace_back((unsigned char)keypointVector.size());
+                // Packed keypoints
+                for (const auto& keypoints : keypointVector)
+                    packKeypoints(buffer, keypoints, resolution);
+                // Send data
+                const auto maxUdpDatagramSize = 65507u;
+                if (buffer.size() > maxUdpDatagramSize)
+                    opLog("Keypoints of frame " + std::to_string(frameNumber) + " not sent, they exceed the UDP"
+                          " datagram size (" + std::to_string(buffer.size()) + " bytes).", Priority::High);
+                else
+                    spImpl->mUdpClient.send(std::string{buffer.begin(), buffer.end()});
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        #else
+            UNUSED(keypointVector);
+            UNUSED(frameNumber);
+            UNUSED(resolution);
         #endif
     }
 }
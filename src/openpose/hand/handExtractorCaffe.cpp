@@ -19,6 +19,7 @@ namespace op
         #ifdef USE_CAFFE
             bool mNetInitialized;
             const int mGpuId;
+            const bool mFastStartup;
             std::shared_ptr<NetCaffe> spNetCaffe;
             std::shared_ptr<ResizeAndMergeCaffe<float>> spResizeAndMergeCaffe;
             std::shared_ptr<MaximumCaffe<float>> spMaximumCaffe;
@@ -28,11 +29,12 @@ namespace op
             std::shared_ptr<ArrayCpuGpu<float>> spPeaksBlob;
 
             ImplHandExtractorCaffe(const std::string& modelFolder, const int gpuId,
-                                   const bool enableGoogleLogging) :
+                                   const bool enableGoogleLogging, const bool fastStartup) :
                 mNetInitialized{false},
                 mGpuId{gpuId},
+                mFastStartup{fastStartup},
                 spNetCaffe{std::make_shared<NetCaffe>(modelFolder + HAND_PROTOTXT, modelFolder + HAND_TRAINED_MODEL,
-                                                      gpuId, enableGoogleLogging)},
+                                                      gpuId, enableGoogleLogging, "net_output", fastStartup)},
                 spResizeAndMergeCaffe{std::make_shared<ResizeAndMergeCaffe<float>>()},
                 spMaximumCaffe{std::make_shared<MaximumCaffe<float>>()}
             {
@@ -241,10 +243,10 @@ namespace op
                                            const int numberScales,
                                            const float rangeScales, const std::vector<HeatMapType>& heatMapTypes,
                                            const ScaleMode heatMapScaleMode,
-                                           const bool enableGoogleLogging) :
+                                           const bool enableGoogleLogging, const bool fastStartup) :
         HandExtractorNet{netInputSize, netOutputSize, numberScales, rangeScales, heatMapTypes, heatMapScaleMode}
         #ifdef USE_CAFFE
-        , upImpl{new ImplHandExtractorCaffe{modelFolder, gpuId, enableGoogleLogging}}
+        , upImpl{new ImplHandExtractorCaffe{modelFolder, gpuId, enableGoogleLogging, fastStartup}}
         #endif
     {
         try
@@ -259,6 +261,7 @@ namespace op
                 UNUSED(heatMapTypes);
                 UNUSED(heatMapScaleMode);
                 UNUSED(enableGoogleLogging);
+                UNUSED(fastStartup);
                 error("OpenPose must be compiled with the `USE_CAFFE` & `USE_CUDA` macro definitions in order to run"
                       " this functionality.", __LINE__, __FUNCTION__, __FILE__);
             #endif
@@ -292,6 +295,17 @@ namespace op
                 #ifdef USE_CUDA
                     cudaCheck(__LINE__, __FUNCTION__, __FILE__);
                 #endif
+                // Fast startup: Warm-up pass, so the first frame with a hand does not pay for the net and blob
+                // reshape (nor for the first-time GPU kernel and memory allocations)
+                if (upImpl->mFastStartup)
+                {
+                    mHandImageCrop.setTo(0.f);
+                    upImpl->spNetCaffe->forwardPass(mHandImageCrop);
+                    upImpl->mNetInitialized = true;
+                    reshapeHandExtractorCaffe(
+                        upImpl->spResizeAndMergeCaffe, upImpl->spMaximumCaffe, upImpl->spCaffeNetOutputBlob,
+                        upImpl->spHeatMapsBlob, upImpl->spPeaksBlob, upImpl->mGpuId);
+                }
                 // Logging
                 opLog("Finished initialization on thread.", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             #endif
@@ -51,6 +51,9 @@ namespace op
     {
         try
         {
+            // Already initialized on this thread (e.g., re-used by WrapperT::reconfigure) --> Keep its loaded net
+            if (mThreadId == std::this_thread::get_id())
+                return;
             // Get thread id
             mThreadId = {std::this_thread::get_id()};
             // Deep net initialization
@@ -2,9 +2,11 @@
 #include <algorithm> // std::sort
 #include <cmath> // std::sqrt
 #include <set>
+#include <openpose/core/arrayView.hpp>
 #include <openpose/utilities/check.hpp>
 #include <openpose/utilities/fastMath.hpp>
 #include <openpose/utilities/keypoint.hpp>
+#include <openpose/utilities/peopleSpatialIndex.hpp>
 #include <openpose/pose/poseParameters.hpp>
 
 namespace op
@@ -320,15 +322,14 @@ namespace op
                     }
                     else if (!pairScores.empty())
                     {
-                        const auto firstIndex = (int)pairIndex*pairScores.getSize(1)*pairScores.getSize(2);
+                        const ArrayView<const T, 3> pairScoresView{pairScores};
                         // E.g., neck-nose connection. For each neck
                         for (auto i = 0; i < numberPeaksA; i++)
                         {
-                            const auto iIndex = firstIndex + i*pairScores.getSize(2);
                             // E.g., neck-nose connection. For each nose
                             for (auto j = 0; j < numberPeaksB; j++)
                             {
-                                const auto scoreAB = pairScores[iIndex + j];
+                                const auto scoreAB = pairScoresView(pairIndex, i, j);
 
                                 // E.g., neck-nose connection. If possible PAF between neck i, nose j --> add
                                 // parts score + connection score
@@ -485,6 +486,7 @@ namespace op
 
             // Get all PAF pairs in a single std::vector
             const auto peaksOffset = 3*(maxPeaks+1);
+            const ArrayView<const T, 3> pairScoresView{pairScores};
             for (auto pairIndex = 0u; pairIndex < numberBodyPartPairs; pairIndex++)
             {
                 const auto bodyPartA = bodyPartPairs[2*pairIndex];
@@ -493,15 +495,13 @@ namespace op
                 const auto* candidateBPtr = peaksPtr + bodyPartB*peaksOffset;
                 const auto numberPeaksA = positiveIntRound(candidateAPtr[0]);
                 const auto numberPeaksB = positiveIntRound(candidateBPtr[0]);
-                const auto firstIndex = (int)pairIndex*pairScores.getSize(1)*pairScores.getSize(2);
                 // E.g., neck-nose connection. For each neck
                 for (auto indexA = 0; indexA < numberPeaksA; indexA++)
                 {
-                    const auto iIndex = firstIndex + indexA*pairScores.getSize(2);
                     // E.g., neck-nose connection. For each nose
                     for (auto indexB = 0; indexB < numberPeaksB; indexB++)
                     {
-                        const auto scoreAB = pairScores[iIndex + indexB];
+                        const auto scoreAB = pairScoresView(pairIndex, indexA, indexB);
 
                         // E.g., neck-nose connection. If possible PAF between neck indexA, nose indexB --> add
                         // parts score + connection score
@@ -799,6 +799,17 @@ namespace op
             // Random standalone facial keypoints --> Merge into a more complete face
             if (numberPeople > 0)
             {
+                // ROI of each valid face, computed once (and updated whenever a face is merged into it)
+                std::vector<Rectangle<T>> roisValid(faceValidSubsetIndexes.size());
+                for (auto personId = 0u ; personId < faceValidSubsetIndexes.size() ; personId++)
+                {
+                    int partFirstNon0Valid = -1;
+                    int partLastNon0Valid = -1;
+                    getRoiDiameterAndBounds(
+                        roisValid[personId], partFirstNon0Valid, partLastNon0Valid,
+                        peopleVector[faceValidSubsetIndexes[personId]].first, peaksPtr, 65, 135, T(0.1));
+                }
+                PeopleSpatialIndex<T> peopleSpatialIndex{roisValid};
                 // Check invalid faces
                 for (const auto& personInvalid : faceInvalidSubsetIndexes)
                 {
@@ -809,21 +820,13 @@ namespace op
                     getRoiDiameterAndBounds(
                         roiInvalid, partFirstNon0Invalid, partLastNon0Invalid,
                         peopleVector[personInvalid].first, peaksPtr, 65, 135, T(0.2));
-                    // Check all valid faces to find best candidate
+                    // Check all valid faces to find best candidate (only the overlapping ones, ROI = 0 for the rest)
                     float keypointsRoiBest = 0.f;
                     auto keypointsRoiBestIndex = -1;
-                    for (auto personId = 0u ; personId < faceValidSubsetIndexes.size() ; personId++)
+                    for (const auto personId : peopleSpatialIndex.getOverlappingPeople(roiInvalid))
                     {
-                        const auto& personValid = faceValidSubsetIndexes[personId];
-                        // Get ROI of current face
-                        Rectangle<T> roiValid;
-                        int partFirstNon0Valid = -1;
-                        int partLastNon0Valid = -1;
-                        getRoiDiameterAndBounds(
-                            roiValid, partFirstNon0Valid, partLastNon0Valid, peopleVector[personValid].first,
-                            peaksPtr, 65, 135, T(0.1));
                         // Get ROI between both faces
-                        const auto keypointsRoi = getKeypointsRoi(roiValid, roiInvalid);
+                        const auto keypointsRoi = getKeypointsRoi(roisValid[personId], roiInvalid);
                         // Update best so far
                         if (keypointsRoiBest < keypointsRoi)
                         {
@@ -862,6 +865,13 @@ namespace op
                                 }
                             }
                         }
+                        // Update ROI of the merged face
+                        int partFirstNon0Valid = -1;
+                        int partLastNon0Valid = -1;
+                        getRoiDiameterAndBounds(
+                            roisValid[keypointsRoiBestIndex], partFirstNon0Valid, partLastNon0Valid,
+                            peopleVector[personValid].first, peaksPtr, 65, 135, T(0.1));
+                        peopleSpatialIndex.reset(roisValid);
                     }
                 }
             }
@@ -2,13 +2,19 @@
 #include <numeric> // std::accumulate
 #ifdef USE_CAFFE
     #include <atomic>
+    #include <cstring> // std::memcpy
+    #include <future> // std::async, std::future, std::shared_future
+    #include <map>
     #include <mutex>
+    #include <set>
     #include <caffe/net.hpp>
+    #include <caffe/util/upgrade_proto.hpp> // caffe::ReadNetParamsFromBinaryFileOrDie
     #include <glog/logging.h> // google::InitGoogleLogging
 #endif
 #ifdef USE_CUDA
     #include <openpose/gpu/cuda.hpp>
 #endif
+#include <openpose/utilities/fileCache.hpp>
 #include <openpose/utilities/fileSystem.hpp>
 #include <openpose/utilities/standard.hpp>
 #ifdef USE_OPENCL
@@ -24,6 +30,212 @@ namespace op
         std::atomic<bool> sOpenCLInitialized{false};
     #endif
 
+    #ifdef USE_CAFFE
+        // Fast startup - Binary weight cache
+        // Format: NetCaffeCacheHeader + for each parameter blob: [#axes (uint32), shape (#axes x int32), data (float)]
+        const std::string NET_CAFFE_CACHE_EXTENSION{".opcache"};
+        const char NET_CAFFE_CACHE_MAGIC[8] = {'O', 'P', 'C', 'A', 'C', 'H', 'E', '\0'};
+        const unsigned int NET_CAFFE_CACHE_VERSION = 2u;
+
+        struct NetCaffeCacheHeader
+        {
+            char magic[8];
+            unsigned int version;
+            unsigned int numberBlobs;
+            // Used to invalidate the cache if the caffemodel changes (so the payload does not need to be hashed)
+            long long modelFileSize;
+            long long modelModificationTime;
+            // Used to detect truncated caches
+            unsigned long long payloadSize;
+        };
+
+        // Trained model loaded (asynchronously) before the net is initialized. It contains either the mapped weight
+        // cache (if valid) or the protobuf-parsed caffemodel.
+        struct NetCaffeTrainedModel
+        {
+            std::unique_ptr<MappedFile> upCacheFile;
+            std::unique_ptr<caffe::NetParameter> upNetParameter;
+        };
+
+        // Shared by all the NetCaffe instances using the same caffemodel (e.g., 1 per GPU), released once all of
+        // them have been initialized
+        struct NetCaffePreloadedModel
+        {
+            std::shared_future<std::shared_ptr<NetCaffeTrainedModel>> trainedModel;
+            int pendingNets;
+        };
+        std::map<std::string, NetCaffePreloadedModel> sNetCaffePreloadedModels;
+        std::set<std::string> sNetCaffeCachesWritten;
+
+        // Returns false (and leaves trainedModel untouched) if the cache does not exist or is outdated
+        bool mapNetCaffeCache(NetCaffeTrainedModel& trainedModel, const std::string& caffeTrainedModel)
+        {
+            try
+            {
+                const auto cachePath = caffeTrainedModel + NET_CAFFE_CACHE_EXTENSION;
+                if (!existFile(cachePath))
+                    return false;
+                // The weights will be read sequentially right away
+                std::unique_ptr<MappedFile> upCacheFile{new MappedFile{cachePath, true}};
+                if (upCacheFile->size() < sizeof(NetCaffeCacheHeader))
+                    return false;
+                // Check header
+                NetCaffeCacheHeader header;
+                std::memcpy(&header, upCacheFile->data(), sizeof(NetCaffeCacheHeader));
+                if (std::memcmp(header.magic, NET_CAFFE_CACHE_MAGIC, sizeof(header.magic)) != 0
+                    || header.version != NET_CAFFE_CACHE_VERSION
+                    || header.payloadSize != upCacheFile->size() - sizeof(NetCaffeCacheHeader)
+                    || header.modelFileSize != getFileSize(caffeTrainedModel)
+                    || header.modelModificationTime != getLastModificationTime(caffeTrainedModel))
+                {
+                    opLog("Outdated weight cache, it will be re-generated: " + cachePath, Priority::High);
+                    return false;
+                }
+                trainedModel.upCacheFile = std::move(upCacheFile);
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return false;
+            }
+        }
+
+        // Same than the prototxt parsing of the caffe::Net constructor, so it can run in the background
+        std::shared_ptr<caffe::NetParameter> loadNetCaffeProto(const std::string& caffeProto)
+        {
+            try
+            {
+                auto netParameter = std::make_shared<caffe::NetParameter>();
+                caffe::ReadNetParamsFromTextFileOrDie(caffeProto, netParameter.get());
+                netParameter->mutable_state()->set_phase(caffe::TEST);
+                netParameter->mutable_state()->set_level(0);
+                return netParameter;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return nullptr;
+            }
+        }
+
+        std::shared_ptr<NetCaffeTrainedModel> loadNetCaffeTrainedModel(const std::string& caffeTrainedModel)
+        {
+            try
+            {
+                auto trainedModel = std::make_shared<NetCaffeTrainedModel>();
+                // Cache not available --> Protobuf parsing
+                #ifndef NV_CAFFE
+                    if (!mapNetCaffeCache(*trainedModel, caffeTrainedModel))
+                #endif
+                {
+                    trainedModel->upNetParameter.reset(new caffe::NetParameter{});
+                    caffe::ReadNetParamsFromBinaryFileOrDie(caffeTrainedModel, trainedModel->upNetParameter.get());
+                }
+                return trainedModel;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return nullptr;
+            }
+        }
+
+        #ifndef NV_CAFFE
+            // Returns false if the cache does not match the net (in which case the weights must be re-loaded)
+            bool copyNetCaffeWeightsFromCache(
+                caffe::Net<float>& caffeNet, const NetCaffeTrainedModel& trainedModel)
+            {
+                try
+                {
+                    NetCaffeCacheHeader header;
+                    const auto& cacheFile = *trainedModel.upCacheFile;
+                    std::memcpy(&header, cacheFile.data(), sizeof(NetCaffeCacheHeader));
+                    const auto& params = caffeNet.params();
+                    if (header.numberBlobs != params.size())
+                        return false;
+                    const auto* const payloadPtr = cacheFile.data() + sizeof(NetCaffeCacheHeader);
+                    const auto payloadSize = cacheFile.size() - sizeof(NetCaffeCacheHeader);
+                    auto offset = size_t(0);
+                    for (const auto& param : params)
+                    {
+                        // Shape
+                        unsigned int numberAxes;
+                        if (offset + sizeof(numberAxes) > payloadSize)
+                            return false;
+                        std::memcpy(&numberAxes, payloadPtr + offset, sizeof(numberAxes));
+                        offset += sizeof(numberAxes);
+                        if (numberAxes != param->shape().size() || offset + numberAxes*sizeof(int) > payloadSize)
+                            return false;
+                        std::vector<int> shape(numberAxes);
+                        std::memcpy(shape.data(), payloadPtr + offset, numberAxes*sizeof(int));
+                        offset += numberAxes*sizeof(int);
+                        if (shape != param->shape())
+                            return false;
+                        // Data
+                        const auto dataSize = param->count() * sizeof(float);
+                        if (offset + dataSize > payloadSize)
+                            return false;
+                        std::memcpy(param->mutable_cpu_data(), payloadPtr + offset, dataSize);
+                        offset += dataSize;
+                    }
+                    return offset == payloadSize;
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                    return false;
+                }
+            }
+
+            void writeNetCaffeCache(caffe::Net<float>& caffeNet, const std::string& caffeTrainedModel)
+            {
+                try
+                {
+                    // Only once per caffemodel and process
+                    {
+                        std::lock_guard<std::mutex> lock{sMutexNetCaffe};
+                        if (!sNetCaffeCachesWritten.insert(caffeTrainedModel).second)
+                            return;
+                    }
+                    NetCaffeCacheHeader header;
+                    std::memcpy(header.magic, NET_CAFFE_CACHE_MAGIC, sizeof(header.magic));
+                    header.version = NET_CAFFE_CACHE_VERSION;
+                    header.numberBlobs = (unsigned int)caffeNet.params().size();
+                    header.modelFileSize = getFileSize(caffeTrainedModel);
+                    header.modelModificationTime = getLastModificationTime(caffeTrainedModel);
+                    if (header.modelFileSize < 0 || header.modelModificationTime < 0)
+                        return;
+                    // Payload (written directly from the blobs, without intermediate copy)
+                    const auto& params = caffeNet.params();
+                    std::vector<unsigned int> numberAxes(params.size());
+                    std::vector<std::pair<const char*, std::size_t>> blocks{
+                        std::make_pair((const char*)&header, sizeof(header))};
+                    header.payloadSize = 0ull;
+                    for (auto i = 0u ; i < params.size() ; i++)
+                    {
+                        numberAxes[i] = (unsigned int)params[i]->shape().size();
+                        blocks.emplace_back((const char*)&numberAxes[i], sizeof(numberAxes[i]));
+                        blocks.emplace_back((const char*)params[i]->shape().data(), numberAxes[i]*sizeof(int));
+                        blocks.emplace_back((const char*)params[i]->cpu_data(), params[i]->count() * sizeof(float));
+                        header.payloadSize += sizeof(numberAxes[i]) + numberAxes[i]*sizeof(int)
+                                            + params[i]->count() * sizeof(float);
+                    }
+                    const auto cachePath = caffeTrainedModel + NET_CAFFE_CACHE_EXTENSION;
+                    if (writeFileAtomically(cachePath, blocks))
+                        opLog("Weight cache written: " + cachePath, Priority::High);
+                    else
+                        opLog("Weight cache could not be written (read-only model folder?): " + cachePath,
+                              Priority::High);
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
+            }
+        #endif
+    #endif
+
     struct NetCaffe::ImplNetCaffe
     {
         #ifdef USE_CAFFE
@@ -32,6 +244,10 @@ namespace op
             const std::string mCaffeProto;
             const std::string mCaffeTrainedModel;
             const std::string mLastBlobName;
+            const bool mFastStartup;
+            bool mPreloadPending;
+            // Fast startup: Prototxt parsed in the background
+            std::future<std::shared_ptr<caffe::NetParameter>> mNetParameter;
             std::vector<int> mNetInputSize4D;
             // Init with thread
             #ifdef NV_CAFFE
@@ -43,11 +259,13 @@ namespace op
             #endif
 
             ImplNetCaffe(const std::string& caffeProto, const std::string& caffeTrainedModel, const int gpuId,
-                         const bool enableGoogleLogging, const std::string& lastBlobName) :
+                         const bool enableGoogleLogging, const std::string& lastBlobName, const bool fastStartup) :
                 mGpuId{gpuId},
                 mCaffeProto{caffeProto},
                 mCaffeTrainedModel{caffeTrainedModel},
-                mLastBlobName{lastBlobName}
+                mLastBlobName{lastBlobName},
+                mFastStartup{fastStartup},
+                mPreloadPending{false}
             {
                 try
                 {
@@ -91,6 +309,125 @@ namespace op
                             }
                         }
                     #endif
+                    // Start loading the prototxt and trained model in the background, so that they overlap with the
+                    // initialization of the other nets (e.g., body, face and hand)
+                    if (mFastStartup)
+                    {
+                        const auto caffeProtoCopy = mCaffeProto;
+                        mNetParameter = std::async(
+                            std::launch::async, [caffeProtoCopy]() { return loadNetCaffeProto(caffeProtoCopy); });
+                        std::lock_guard<std::mutex> lock{sMutexNetCaffe};
+                        auto preloadedModel = sNetCaffePreloadedModels.find(mCaffeTrainedModel);
+                        if (preloadedModel == sNetCaffePreloadedModels.end())
+                        {
+                            const auto caffeTrainedModelCopy = mCaffeTrainedModel;
+                            sNetCaffePreloadedModels[mCaffeTrainedModel] = NetCaffePreloadedModel{
+                                std::async(std::launch::async, [caffeTrainedModelCopy]()
+                                           { return loadNetCaffeTrainedModel(caffeTrainedModelCopy); }).share(),
+                                1};
+                        }
+                        else
+                            preloadedModel->second.pendingNets++;
+                        mPreloadPending = true;
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
+            }
+
+            ~ImplNetCaffe()
+            {
+                try
+                {
+                    releasePreloadedModel();
+                }
+                catch (const std::exception& e)
+                {
+                    errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
+            }
+
+            std::shared_ptr<NetCaffeTrainedModel> getPreloadedModel()
+            {
+                try
+                {
+                    std::shared_future<std::shared_ptr<NetCaffeTrainedModel>> trainedModel;
+                    {
+                        std::lock_guard<std::mutex> lock{sMutexNetCaffe};
+                        trainedModel = sNetCaffePreloadedModels.at(mCaffeTrainedModel).trainedModel;
+                    }
+                    return trainedModel.get();
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                    return nullptr;
+                }
+            }
+
+            // Returns nullptr if the prototxt was not parsed in the background (i.e., caffe::Net must parse it)
+            std::shared_ptr<caffe::NetParameter> getNetParameter()
+            {
+                try
+                {
+                    return (mNetParameter.valid() ? mNetParameter.get() : nullptr);
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                    return nullptr;
+                }
+            }
+
+            void releasePreloadedModel()
+            {
+                if (mPreloadPending)
+                {
+                    std::lock_guard<std::mutex> lock{sMutexNetCaffe};
+                    auto preloadedModel = sNetCaffePreloadedModels.find(mCaffeTrainedModel);
+                    if (preloadedModel != sNetCaffePreloadedModels.end() && --preloadedModel->second.pendingNets < 1)
+                        sNetCaffePreloadedModels.erase(preloadedModel);
+                    mPreloadPending = false;
+                }
+            }
+
+            void copyTrainedLayers()
+            {
+                try
+                {
+                    // Default: Protobuf parsing
+                    if (!mFastStartup)
+                    {
+                        upCaffeNet->CopyTrainedLayersFrom(mCaffeTrainedModel);
+                        return;
+                    }
+                    // Fast startup: Use the (possibly already loaded) preloaded model
+                    const auto trainedModel = getPreloadedModel();
+                    #ifndef NV_CAFFE
+                        if (trainedModel != nullptr && trainedModel->upCacheFile != nullptr)
+                        {
+                            if (copyNetCaffeWeightsFromCache(*upCaffeNet, *trainedModel))
+                            {
+                                opLog("Weights loaded from cache: " + mCaffeTrainedModel + NET_CAFFE_CACHE_EXTENSION,
+                                      Priority::Low);
+                                releasePreloadedModel();
+                                return;
+                            }
+                            opLog("Corrupted or non-matching weight cache, it will be re-generated: "
+                                  + mCaffeTrainedModel + NET_CAFFE_CACHE_EXTENSION, Priority::High);
+                        }
+                    #endif
+                    if (trainedModel != nullptr && trainedModel->upNetParameter != nullptr)
+                        upCaffeNet->CopyTrainedLayersFrom(*trainedModel->upNetParameter);
+                    else
+                        upCaffeNet->CopyTrainedLayersFrom(mCaffeTrainedModel);
+                    releasePreloadedModel();
+                    // Create the cache for the next runs
+                    #ifndef NV_CAFFE
+                        writeNetCaffeCache(*upCaffeNet, mCaffeTrainedModel);
+                    #endif
                 }
                 catch (const std::exception& e)
                 {
@@ -123,10 +460,10 @@ namespace op
     #endif
 
     NetCaffe::NetCaffe(const std::string& caffeProto, const std::string& caffeTrainedModel, const int gpuId,
-                       const bool enableGoogleLogging, const std::string& lastBlobName)
+                       const bool enableGoogleLogging, const std::string& lastBlobName, const bool fastStartup)
         #ifdef USE_CAFFE
             : upImpl{new ImplNetCaffe{caffeProto, caffeTrainedModel, gpuId, enableGoogleLogging,
-                                      lastBlobName}}
+                                      lastBlobName, fastStartup}}
         #endif
     {
         try
@@ -137,6 +474,7 @@ namespace op
                 UNUSED(gpuId);
                 UNUSED(enableGoogleLogging);
                 UNUSED(lastBlobName);
+                UNUSED(fastStartup);
                 error("OpenPose must be compiled with the `USE_CAFFE` macro definition in order to use this"
                       " functionality.", __LINE__, __FUNCTION__, __FILE__);
             #endif
@@ -157,32 +495,50 @@ namespace op
         {
             #ifdef USE_CAFFE
                 // Initialize net
+                const auto netParameter = upImpl->getNetParameter();
                 #ifdef USE_OPENCL
                     caffe::Caffe::set_mode(caffe::Caffe::GPU);
                     caffe::Caffe::SelectDevice(upImpl->mGpuId, true);
-                    upImpl->upCaffeNet.reset(new caffe::Net<float>{upImpl->mCaffeProto, caffe::TEST,
-                                             caffe::Caffe::GetDefaultDevice()});
-                    upImpl->upCaffeNet->CopyTrainedLayersFrom(upImpl->mCaffeTrainedModel);
+                    if (netParameter != nullptr)
+                        upImpl->upCaffeNet.reset(new caffe::Net<float>{*netParameter,
+                                                 caffe::Caffe::GetDefaultDevice()});
+                    else
+                        upImpl->upCaffeNet.reset(new caffe::Net<float>{upImpl->mCaffeProto, caffe::TEST,
+                                                 caffe::Caffe::GetDefaultDevice()});
+                    upImpl->copyTrainedLayers();
                     OpenCL::getInstance(upImpl->mGpuId, CL_DEVICE_TYPE_GPU, true);
                 #else
                     #ifdef USE_CUDA
                         caffe::Caffe::set_mode(caffe::Caffe::GPU);
                         caffe::Caffe::SetDevice(upImpl->mGpuId);
                         #ifdef NV_CAFFE
-                            upImpl->upCaffeNet.reset(new caffe::Net{upImpl->mCaffeProto, caffe::TEST});
+                            if (netParameter != nullptr)
+                                upImpl->upCaffeNet.reset(new caffe::Net{*netParameter});
+                            else
+                                upImpl->upCaffeNet.reset(new caffe::Net{upImpl->mCaffeProto, caffe::TEST});
                         #else
-                            upImpl->upCaffeNet.reset(new caffe::Net<float>{upImpl->mCaffeProto, caffe::TEST});
+                            if (netParameter != nullptr)
+                                upImpl->upCaffeNet.reset(new caffe::Net<float>{*netParameter});
+                            else
+                                upImpl->upCaffeNet.reset(new caffe::Net<float>{upImpl->mCaffeProto, caffe::TEST});
                         #endif
                     #else
                         caffe::Caffe::set_mode(caffe::Caffe::CPU);
                         #ifdef _WIN32
-                            upImpl->upCaffeNet.reset(new caffe::Net<float>{upImpl->mCaffeProto, caffe::TEST,
-                                                                           caffe::Caffe::GetCPUDevice()});
+                            if (netParameter != nullptr)
+                                upImpl->upCaffeNet.reset(new caffe::Net<float>{*netParameter,
+                                                                               caffe::Caffe::GetCPUDevice()});
+                            else
+                                upImpl->upCaffeNet.reset(new caffe::Net<float>{upImpl->mCaffeProto, caffe::TEST,
+                                                                               caffe::Caffe::GetCPUDevice()});
                         #else
-                            upImpl->upCaffeNet.reset(new caffe::Net<float>{upImpl->mCaffeProto, caffe::TEST});
+                            if (netParameter != nullptr)
+                                upImpl->upCaffeNet.reset(new caffe::Net<float>{*netParameter});
+                            else
+                                upImpl->upCaffeNet.reset(new caffe::Net<float>{upImpl->mCaffeProto, caffe::TEST});
                         #endif
                     #endif
-                    upImpl->upCaffeNet->CopyTrainedLayersFrom(upImpl->mCaffeTrainedModel);
+                    upImpl->copyTrainedLayers();
                     #ifdef USE_CUDA
                         cudaCheck(__LINE__, __FUNCTION__, __FILE__);
                     #endif
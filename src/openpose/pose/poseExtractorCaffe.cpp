@@ -70,20 +70,40 @@ namespace op
             }
         }
 
+        std::shared_ptr<Net> createCaffeNet(
+            const PoseModel poseModel, const int gpuId, const std::string& modelFolder,
+            const std::string& protoTxtPath, const std::string& caffeModelPath, const bool enableGoogleLogging,
+            const bool fastStartup)
+        {
+            try
+            {
+                return std::make_shared<NetCaffe>(
+                    modelFolder + (protoTxtPath.empty() ? getPoseProtoTxt(poseModel) : protoTxtPath),
+                    modelFolder + (caffeModelPath.empty() ? getPoseTrainedModel(poseModel) : caffeModelPath),
+                    gpuId, enableGoogleLogging, "net_output", fastStartup);
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return nullptr;
+            }
+        }
+
         void addCaffeNetOnThread(
             std::vector<std::shared_ptr<Net>>& net,
             std::vector<std::shared_ptr<ArrayCpuGpu<float>>>& caffeNetOutputBlob,
             const PoseModel poseModel, const int gpuId, const std::string& modelFolder,
-            const std::string& protoTxtPath, const std::string& caffeModelPath, const bool enableGoogleLogging)
+            const std::string& protoTxtPath, const std::string& caffeModelPath, const bool enableGoogleLogging,
+            const bool fastStartup = false)
         {
             try
             {
-                // Add Caffe Net
-                net.emplace_back(
-                    std::make_shared<NetCaffe>(
-                        modelFolder + (protoTxtPath.empty() ? getPoseProtoTxt(poseModel) : protoTxtPath),
-                        modelFolder + (caffeModelPath.empty() ? getPoseTrainedModel(poseModel) : caffeModelPath),
-                        gpuId, enableGoogleLogging));
+                // Add Caffe Net (unless it was already created by the constructor, i.e., fast startup)
+                if (net.size() == caffeNetOutputBlob.size())
+                    net.emplace_back(
+                        createCaffeNet(
+                            poseModel, gpuId, modelFolder, protoTxtPath, caffeModelPath, enableGoogleLogging,
+                            fastStartup));
                 // net.emplace_back(
                 //     std::make_shared<NetOpenCv>(
                 //         modelFolder + (protoTxtPath.empty() ? getPoseProtoTxt(poseModel) : protoTxtPath),
@@ -112,7 +132,8 @@ namespace op
         const PoseModel poseModel, const std::string& modelFolder, const int gpuId,
         const std::vector<HeatMapType>& heatMapTypes, const ScaleMode heatMapScaleMode, const bool addPartCandidates,
         const bool maximizePositives, const std::string& protoTxtPath, const std::string& caffeModelPath,
-        const float upsamplingRatio, const bool enableNet, const bool enableGoogleLogging) :
+        const float upsamplingRatio, const bool enableNet, const bool enableGoogleLogging, const bool fastStartup,
+        const Point<int>& netInputSize) :
         PoseExtractorNet{poseModel, heatMapTypes, heatMapScaleMode, addPartCandidates, maximizePositives},
         mPoseModel{poseModel},
         mGpuId{gpuId},
@@ -121,7 +142,9 @@ namespace op
         mCaffeModelPath{caffeModelPath},
         mUpsamplingRatio{upsamplingRatio},
         mEnableNet{enableNet},
-        mEnableGoogleLogging{enableGoogleLogging}
+        mEnableGoogleLogging{enableGoogleLogging},
+        mFastStartup{fastStartup},
+        mNetInputSize{netInputSize}
         #ifdef USE_CAFFE
             ,
             spResizeAndMergeCaffe{std::make_shared<ResizeAndMergeCaffe<float>>()},
@@ -136,6 +159,13 @@ namespace op
                 // Layers parameters
                 spBodyPartConnectorCaffe->setPoseModel(mPoseModel);
                 spBodyPartConnectorCaffe->setMaximizePositives(maximizePositives);
+                // Fast startup: Creating the net here starts loading its trained model in the background, so it
+                // overlaps with the rest of the OpenPose configuration (e.g., face and hand nets)
+                if (mEnableNet && mFastStartup)
+                    spNets.emplace_back(
+                        createCaffeNet(
+                            mPoseModel, mGpuId, mModelFolder, mProtoTxtPath, mCaffeModelPath, mEnableGoogleLogging,
+                            mFastStartup));
             #else
                 UNUSED(poseModel);
                 UNUSED(modelFolder);
@@ -146,7 +176,9 @@ namespace op
                 UNUSED(maximizePositives);
                 UNUSED(protoTxtPath);
                 UNUSED(caffeModelPath);
+                UNUSED(netInputSize);
                 UNUSED(enableGoogleLogging);
+                UNUSED(fastStartup);
                 error("OpenPose must be compiled with the `USE_CAFFE` macro definition in order to use this"
                       " functionality.", __LINE__, __FUNCTION__, __FILE__);
             #endif
@@ -174,7 +206,7 @@ namespace op
                     addCaffeNetOnThread(
                         spNets, spCaffeNetOutputBlobs, mPoseModel, mGpuId,
                         mModelFolder, mProtoTxtPath, mCaffeModelPath,
-                        mEnableGoogleLogging);
+                        mEnableGoogleLogging, mFastStartup);
                     #ifdef USE_CUDA
                         cudaCheck(__LINE__, __FUNCTION__, __FILE__);
                     #endif
@@ -187,6 +219,30 @@ namespace op
                 #ifdef USE_CUDA
                     cudaCheck(__LINE__, __FUNCTION__, __FILE__);
                 #endif
+                // Fast startup: Warm-up pass at the expected net input size, so neither the lazy initialization of
+                // the net (e.g., GPU memory allocation and CUDA/cuDNN setup) nor the net and blob reshape delay the
+                // first frame. Dimensions only known once the first frame arrives (-1) use the default one (368)
+                if (mEnableNet && mFastStartup)
+                {
+                    const Array<float> warmUpInput{
+                        {1, 3, (mNetInputSize.y > 0 ? mNetInputSize.y : 368),
+                         (mNetInputSize.x > 0 ? mNetInputSize.x : 368)}, 0.f};
+                    spNets.back()->forwardPass(warmUpInput);
+                    mNetInput4DSizes = {warmUpInput.getSize()};
+                    reshapePoseExtractorCaffe(
+                        spResizeAndMergeCaffe, spNmsCaffe, spBodyPartConnectorCaffe, spMaximumCaffe,
+                        spCaffeNetOutputBlobs, spHeatMapsBlob, spPeaksBlob, spMaximumPeaksBlob, 1.f, mPoseModel,
+                        mGpuId, mUpsamplingRatio);
+                    const auto ratio = (
+                        mUpsamplingRatio <= 0.f
+                            ? 1 : mUpsamplingRatio / getPoseNetDecreaseFactor(mPoseModel));
+                    mNetOutputSize = Point<int>{
+                        positiveIntRound(ratio*mNetInput4DSizes[0][3]),
+                        positiveIntRound(ratio*mNetInput4DSizes[0][2])};
+                    #ifdef USE_CUDA
+                        cudaCheck(__LINE__, __FUNCTION__, __FILE__);
+                    #endif
+                }
                 // Logging
                 opLog("Finished initialization on thread.", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             #endif
@@ -241,7 +297,7 @@ namespace op
                     while (spNets.size() < numberScales)
                         addCaffeNetOnThread(
                             spNets, spCaffeNetOutputBlobs, mPoseModel, mGpuId,
-                            mModelFolder, mProtoTxtPath, mCaffeModelPath, false);
+                            mModelFolder, mProtoTxtPath, mCaffeModelPath, false, mFastStartup);
 
                     for (auto i = 0u ; i < inputNetData.size(); i++)
                         spNets.at(i)->forwardPass(inputNetData[i]);
@@ -23,6 +23,8 @@ namespace op
             // Set frame first and step
             if (producerSharedPtr->getType() != ProducerType::FlirCamera
                 && producerSharedPtr->getType() != ProducerType::IPCamera
+                && producerSharedPtr->getType() != ProducerType::MultiVideo
+                && producerSharedPtr->getType() != ProducerType::WatchFolder
                 && producerSharedPtr->getType() != ProducerType::Webcam)
             {
                 // Frame first
@@ -1,20 +1,173 @@
 #include <openpose/producer/imageDirectoryReader.hpp>
+#include <chrono>
+#include <cstdio> // std::snprintf
+#include <cstdlib> // std::getenv
+#include <fstream> // std::ifstream
 #include <openpose/filestream/fileStream.hpp>
 #include <openpose/utilities/fastMath.hpp>
+#include <openpose/utilities/fileCache.hpp>
 #include <openpose/utilities/fileSystem.hpp>
 #include <openpose_private/utilities/openCvMultiversionHeaders.hpp>
 
 namespace op
 {
+    const auto IMAGE_DIRECTORY_INDEX_HEADER = std::string{"OpenPose image directory index 2"};
+    // Smaller folders are listed fast enough, so they are not cached
+    const auto IMAGE_DIRECTORY_INDEX_MIN_IMAGES = 10000ull;
+    // Coarsest modification time resolution among the common file systems (FAT), in nanoseconds
+    const auto IMAGE_DIRECTORY_TIME_GRANULARITY = 2000000000ll;
+
+    // User cache folder (e.g., ~/.cache), or "" if unknown
+    std::string getUserCachePath()
+    {
+        try
+        {
+            #ifdef _WIN32
+                const auto* const localAppData = std::getenv("LOCALAPPDATA");
+                return (localAppData != nullptr ? formatAsDirectory(localAppData) : "");
+            #else
+                const auto* const xdgCacheHome = std::getenv("XDG_CACHE_HOME");
+                if (xdgCacheHome != nullptr && xdgCacheHome[0] != '\0')
+                    return formatAsDirectory(xdgCacheHome);
+                const auto* const home = std::getenv("HOME");
+                return (home != nullptr ? formatAsDirectory(home) + ".cache/" : "");
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return "";
+        }
+    }
+
+    // The index of each folder is saved in the user cache folder (rather than on the image folder itself, which
+    // might be read-only or shared), named after the checksum of its absolute path
+    std::string getImageDirectoryIndexPath(const std::string& cachePath, const std::string& absolutePath)
+    {
+        try
+        {
+            char checksum[17];
+            std::snprintf(checksum, sizeof(checksum), "%016llx",
+                          getFileCacheChecksum(absolutePath.data(), absolutePath.size()));
+            return formatAsDirectory(cachePath + "openpose/image_index") + checksum + ".txt";
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return "";
+        }
+    }
+
+    // Index format: header, absolute path of the folder, its modification time, #images, and 1 image name per line
+    // (sorted)
+    std::vector<std::string> loadImageDirectoryIndex(const std::string& formatedPath, const std::string& absolutePath)
+    {
+        try
+        {
+            const auto cachePath = getUserCachePath();
+            if (cachePath.empty())
+                return {};
+            std::ifstream indexFile{getImageDirectoryIndexPath(cachePath, absolutePath)};
+            std::string line;
+            if (!indexFile.is_open() || !std::getline(indexFile, line) || line != IMAGE_DIRECTORY_INDEX_HEADER
+                || !std::getline(indexFile, line) || line != absolutePath)
+                return {};
+            // Outdated if any file was added, removed or renamed after the index was written
+            long long directoryTime;
+            unsigned long long numberImages;
+            if (!(indexFile >> directoryTime >> numberImages) || !std::getline(indexFile, line)
+                || directoryTime != getLastModificationTime(formatedPath))
+                return {};
+            std::vector<std::string> imagePaths;
+            while (imagePaths.size() < numberImages && std::getline(indexFile, line))
+                imagePaths.emplace_back(formatedPath + line);
+            // Truncated
+            if (imagePaths.size() != numberImages)
+                return {};
+            return imagePaths;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    void saveImageDirectoryIndex(
+        const std::string& formatedPath, const std::string& absolutePath, const std::vector<std::string>& imagePaths,
+        const long long directoryTimeBeforeListing, const long long timeBeforeListing)
+    {
+        try
+        {
+            if (imagePaths.size() < IMAGE_DIRECTORY_INDEX_MIN_IMAGES)
+                return;
+            // Folder modified while it was listed
+            if (directoryTimeBeforeListing != getLastModificationTime(formatedPath))
+                return;
+            // Folder modified too recently: a change right after (or while) listing it might keep the same
+            // modification time on file systems with coarse time resolution, so the index would not be invalidated
+            if (timeBeforeListing - directoryTimeBeforeListing < IMAGE_DIRECTORY_TIME_GRANULARITY)
+            {
+                opLog("Folder " + formatedPath + " was modified too recently to cache its image list.",
+                      Priority::Low);
+                return;
+            }
+            const auto cachePath = getUserCachePath();
+            if (cachePath.empty())
+                return;
+            makeDirectory(cachePath);
+            makeDirectory(cachePath + "openpose/");
+            makeDirectory(cachePath + "openpose/image_index/");
+            const auto indexPath = getImageDirectoryIndexPath(cachePath, absolutePath);
+            std::string index = IMAGE_DIRECTORY_INDEX_HEADER + "\n" + absolutePath + "\n"
+                              + std::to_string(directoryTimeBeforeListing) + " " + std::to_string(imagePaths.size())
+                              + "\n";
+            for (const auto& imagePath : imagePaths)
+            {
+                const auto imageName = imagePath.substr(formatedPath.size());
+                if (imageName.find('\n') != std::string::npos)
+                    return;
+                index += imageName + "\n";
+            }
+            // Written atomically, so other processes listing the same folder never read a partial index
+            if (!writeFileAtomically(indexPath, {std::make_pair(index.data(), index.size())}))
+                opLog("The image index could not be written on " + indexPath + ". The folder will be listed again"
+                      " next time.", Priority::High);
+        }
+        catch (const std::exception& e)
+        {
+            // The cache is optional (e.g., read-only home folder), so not being able to write it is not an error
+            UNUSED(e);
+            opLog("The image index of " + formatedPath + " could not be written on the cache folder. The folder"
+                  " will be listed again next time.", Priority::High);
+        }
+    }
+
     std::vector<std::string> getImagePathsOnDirectory(const std::string& imageDirectoryPath)
     {
         try
         {
+            // Sorted list cached in the user cache folder, so very large folders (e.g., millions of frames) are only
+            // listed and sorted once
+            const auto formatedPath = formatAsDirectory(imageDirectoryPath);
+            const auto absolutePath = getAbsolutePath(formatedPath);
+            auto imagePaths = (absolutePath.empty()
+                ? std::vector<std::string>{} : loadImageDirectoryIndex(formatedPath, absolutePath));
+            if (!imagePaths.empty())
+            {
+                opLog("Image list of " + formatedPath + " read from its cached index.", Priority::Low);
+                return imagePaths;
+            }
             // Get files on directory with the desired extensions
-            const auto imagePaths = getFilesOnDirectory(imageDirectoryPath, Extensions::Images);
+            const auto directoryTime = getLastModificationTime(formatedPath);
+            const auto time = (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            imagePaths = getFilesOnDirectory(formatedPath, Extensions::Images);
             // Check #files > 0
             if (imagePaths.empty())
                 error("No images were found on " + imageDirectoryPath, __LINE__, __FUNCTION__, __FILE__);
+            if (!absolutePath.empty())
+                saveImageDirectoryIndex(formatedPath, absolutePath, imagePaths, directoryTime, time);
             // Return result
             return imagePaths;
         }
@@ -0,0 +1,485 @@
+#include <openpose/producer/multiVideoReader.hpp>
+#include <chrono>
+#include <cmath> // std::abs
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <openpose/utilities/fastMath.hpp>
+#include <openpose/utilities/string.hpp>
+#include <openpose_private/utilities/openCvMultiversionHeaders.hpp>
+
+namespace op
+{
+    // Maximum number of decoded frames waiting per view. Video files block their decoding thread when it is reached,
+    // while streams drop their oldest frame (i.e., live cameras are never delayed)
+    const auto MULTI_VIDEO_MAX_QUEUED_FRAMES = 8u;
+    // Consecutive failed reads after which a stream is considered closed
+    const auto MULTI_VIDEO_MAX_STREAM_FAILURES = 100u;
+    // Used if the first view does not report its fps (e.g., some IP cameras)
+    const auto MULTI_VIDEO_DEFAULT_FPS = 30.;
+
+    struct TimestampedFrame
+    {
+        double timestampMs;
+        cv::Mat frame;
+    };
+
+    struct MultiVideoView
+    {
+        std::string path;
+        bool isStream;
+        cv::VideoCapture videoCapture;
+        // Shared with the decoding thread
+        std::deque<TimestampedFrame> frames;
+        bool ended;
+        // Only used by getRawFrames()
+        TimestampedFrame lastFrame;
+    };
+
+    struct MultiVideoReader::ImplMultiVideoReader
+    {
+        std::vector<std::unique_ptr<MultiVideoView>> mViews;
+        std::vector<std::thread> mThreads;
+        std::mutex mMutex;
+        std::condition_variable mConditionVariable;
+        bool mRunning;
+        std::string mError;
+        const std::chrono::steady_clock::time_point mStartTime;
+        double mFps;
+        double mMaxJitterMs;
+        Point<int> mResolution;
+        unsigned long long mFrameCounter;
+        unsigned long long mNumberDroppedFrames;
+        unsigned long long mNumberRepeatedFrames;
+
+        ImplMultiVideoReader() :
+            mRunning{false},
+            mStartTime{std::chrono::steady_clock::now()},
+            mFrameCounter{0ull},
+            mNumberDroppedFrames{0ull},
+            mNumberRepeatedFrames{0ull}
+        {
+        }
+
+        void decodeView(MultiVideoView* viewPtr)
+        {
+            try
+            {
+                auto& view = *viewPtr;
+                auto numberFailures = 0u;
+                while (true)
+                {
+                    // Video files: Wait until there is space in the queue
+                    {
+                        std::unique_lock<std::mutex> lock{mMutex};
+                        mConditionVariable.wait(
+                            lock, [this, &view]{
+                                return !mRunning || view.isStream
+                                    || view.frames.size() < MULTI_VIDEO_MAX_QUEUED_FRAMES; });
+                        if (!mRunning)
+                            break;
+                    }
+                    // Decode frame (outside the lock, so all views are decoded in parallel)
+                    TimestampedFrame timestampedFrame;
+                    const auto success = view.videoCapture.read(timestampedFrame.frame);
+                    timestampedFrame.timestampMs = (view.isStream
+                        ? (double)std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - mStartTime).count() * 1e-3
+                        : view.videoCapture.get(CV_CAP_PROP_POS_MSEC));
+                    // Stream hiccup - Retry before closing it
+                    if ((!success || timestampedFrame.frame.empty()) && view.isStream
+                        && ++numberFailures < MULTI_VIDEO_MAX_STREAM_FAILURES)
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+                        continue;
+                    }
+                    // Push frame
+                    {
+                        const std::lock_guard<std::mutex> lock{mMutex};
+                        if (!success || timestampedFrame.frame.empty())
+                            view.ended = true;
+                        else
+                        {
+                            numberFailures = 0u;
+                            if (view.isStream && view.frames.size() >= MULTI_VIDEO_MAX_QUEUED_FRAMES)
+                            {
+                                view.frames.pop_front();
+                                mNumberDroppedFrames++;
+                            }
+                            view.frames.emplace_back(std::move(timestampedFrame));
+                        }
+                    }
+                    mConditionVariable.notify_all();
+                    if (view.ended)
+                        break;
+                }
+            }
+            catch (const std::exception& e)
+            {
+                {
+                    const std::lock_guard<std::mutex> lock{mMutex};
+                    mError = e.what();
+                    viewPtr->ended = true;
+                }
+                mConditionVariable.notify_all();
+            }
+        }
+
+        // It waits until the closest frame of the view to timestampMs is known, and returns it (nullptr if the view
+        // has no frames at all). Older frames are dropped. isRepeated is set to whether it was already returned
+        const TimestampedFrame* getClosestFrame(bool& isRepeated, MultiVideoView& view,
+                                                std::unique_lock<std::mutex>& lock, const double timestampMs)
+        {
+            try
+            {
+                // Streams do not wait longer than the jitter window
+                const auto deadline = std::chrono::steady_clock::now()
+                    + std::chrono::microseconds((long long)(1e3*mMaxJitterMs));
+                while (true)
+                {
+                    // Frame i is not the closest one if frame i+1 is not after timestampMs
+                    while (view.frames.size() > 1 && view.frames[1].timestampMs <= timestampMs)
+                    {
+                        view.frames.pop_front();
+                        mNumberDroppedFrames++;
+                    }
+                    mConditionVariable.notify_all();
+                    if (!mRunning || !mError.empty() || view.ended
+                        || (!view.frames.empty() && view.frames.back().timestampMs >= timestampMs))
+                        break;
+                    if (view.isStream)
+                    {
+                        if (mConditionVariable.wait_until(lock, deadline) == std::cv_status::timeout)
+                            break;
+                    }
+                    else
+                        mConditionVariable.wait(lock);
+                }
+                // Closest frame among the last returned and the queued ones
+                const TimestampedFrame* closestFrame = (view.lastFrame.frame.empty() ? nullptr : &view.lastFrame);
+                for (const auto& timestampedFrame : view.frames)
+                {
+                    if (closestFrame == nullptr || std::abs(timestampedFrame.timestampMs - timestampMs)
+                                                   < std::abs(closestFrame->timestampMs - timestampMs))
+                        closestFrame = &timestampedFrame;
+                    else
+                        break;
+                }
+                // The returned frame is kept (as lastFrame), so it can be repeated
+                isRepeated = (closestFrame == &view.lastFrame);
+                if (closestFrame != nullptr && !isRepeated)
+                {
+                    while (&view.frames.front() != closestFrame)
+                    {
+                        view.frames.pop_front();
+                        mNumberDroppedFrames++;
+                    }
+                    view.lastFrame = std::move(view.frames.front());
+                    view.frames.pop_front();
+                    closestFrame = &view.lastFrame;
+                    mConditionVariable.notify_all();
+                }
+                return closestFrame;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return nullptr;
+            }
+        }
+    };
+
+    MultiVideoReader::MultiVideoReader(const std::vector<std::string>& videoPaths,
+                                       const std::string& cameraParameterPath, const bool undistortImage,
+                                       const int numberViews) :
+        Producer{ProducerType::MultiVideo, cameraParameterPath, undistortImage, (int)videoPaths.size()},
+        upImpl{new ImplMultiVideoReader{}}
+    {
+        try
+        {
+            // Sanity checks
+            if (videoPaths.size() < 2)
+                error("MultiVideoReader requires at least 2 videos/streams (1 per camera view), "
+                      + std::to_string(videoPaths.size()) + " given.", __LINE__, __FUNCTION__, __FILE__);
+            if (numberViews > 0 && numberViews != (int)videoPaths.size())
+                error("The number of views (`--3d_views`) and videos/streams do not match ("
+                      + std::to_string(numberViews) + " vs. " + std::to_string(videoPaths.size()) + ").",
+                      __LINE__, __FUNCTION__, __FILE__);
+            // Open all views
+            for (const auto& videoPath : videoPaths)
+            {
+                upImpl->mViews.emplace_back(new MultiVideoView{});
+                auto& view = *upImpl->mViews.back();
+                view.path = videoPath;
+                view.isStream = (videoPath.find("://") != std::string::npos);
+                view.ended = false;
+                view.videoCapture.open(videoPath);
+                if (!view.videoCapture.isOpened())
+                    error("VideoCapture (IP camera/video) could not be opened for path: '" + videoPath + "'. If"
+                          " it is a video path, is the path correct?", __LINE__, __FUNCTION__, __FILE__);
+                // Video files are aligned with their own timestamps (starting at 0) and streams with their arrival
+                // time, so both clocks cannot be compared
+                if (view.isStream != upImpl->mViews[0]->isStream)
+                    error("MultiVideoReader cannot mix video files and IP camera streams (`" + view.path + "` vs. `"
+                          + upImpl->mViews[0]->path + "`), given that video files are synchronized with their frame"
+                          " timestamps and streams with their arrival time.", __LINE__, __FUNCTION__, __FILE__);
+            }
+            // Clock of the first view
+            auto& firstVideoCapture = upImpl->mViews[0]->videoCapture;
+            upImpl->mFps = firstVideoCapture.get(CV_CAP_PROP_FPS);
+            const auto fps = (upImpl->mFps > 0. ? upImpl->mFps : MULTI_VIDEO_DEFAULT_FPS);
+            upImpl->mMaxJitterMs = 0.5 * 1e3 / fps;
+            // Set resolution
+            set(CV_CAP_PROP_FRAME_WIDTH, firstVideoCapture.get(CV_CAP_PROP_FRAME_WIDTH));
+            set(CV_CAP_PROP_FRAME_HEIGHT, firstVideoCapture.get(CV_CAP_PROP_FRAME_HEIGHT));
+            // Start 1 decoding thread per view
+            upImpl->mRunning = true;
+            for (auto& view : upImpl->mViews)
+                upImpl->mThreads.emplace_back(&ImplMultiVideoReader::decodeView, upImpl.get(), view.get());
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    MultiVideoReader::~MultiVideoReader()
+    {
+        try
+        {
+            release();
+        }
+        catch (const std::exception& e)
+        {
+            errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    std::string MultiVideoReader::getNextFrameName()
+    {
+        try
+        {
+            const auto stringLength = 12u;
+            return toFixedLengthString(upImpl->mFrameCounter, stringLength);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return "";
+        }
+    }
+
+    bool MultiVideoReader::isOpened() const
+    {
+        try
+        {
+            if (upImpl->mViews.empty())
+                return false;
+            const std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            // Finished once the first view (the clock) has no more frames
+            const auto& firstView = *upImpl->mViews[0];
+            return upImpl->mRunning && !(firstView.ended && firstView.frames.empty());
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    void MultiVideoReader::release()
+    {
+        try
+        {
+            {
+                const std::lock_guard<std::mutex> lock{upImpl->mMutex};
+                upImpl->mRunning = false;
+            }
+            upImpl->mConditionVariable.notify_all();
+            for (auto& thread : upImpl->mThreads)
+                if (thread.joinable())
+                    thread.join();
+            if (!upImpl->mThreads.empty())
+                opLog("MultiVideoReader: " + std::to_string(upImpl->mNumberDroppedFrames) + " frames dropped and "
+                      + std::to_string(upImpl->mNumberRepeatedFrames) + " frames repeated to keep the "
+                      + std::to_string(upImpl->mViews.size()) + " views synchronized.", Priority::High);
+            upImpl->mThreads.clear();
+            for (auto& view : upImpl->mViews)
+            {
+                view->videoCapture.release();
+                view->frames.clear();
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    Matrix MultiVideoReader::getRawFrame()
+    {
+        try
+        {
+            const auto frames = getRawFrames();
+            return (frames.empty() ? Matrix() : frames[0]);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Matrix();
+        }
+    }
+
+    std::vector<Matrix> MultiVideoReader::getRawFrames()
+    {
+        try
+        {
+            std::unique_lock<std::mutex> lock{upImpl->mMutex};
+            auto& views = upImpl->mViews;
+            std::vector<cv::Mat> cvMats(views.size());
+            // Drop frames of the first view until all the views can be synchronized with it
+            auto synchronized = false;
+            while (!synchronized && upImpl->mRunning)
+            {
+                // Next frame of the first view (the clock)
+                auto& firstView = *views[0];
+                upImpl->mConditionVariable.wait(
+                    lock, [&]{ return !upImpl->mRunning || !upImpl->mError.empty() || !firstView.frames.empty()
+                                      || firstView.ended; });
+                // Released (e.g., from another thread)
+                if (!upImpl->mRunning)
+                    break;
+                if (!upImpl->mError.empty())
+                    error("Error reading " + firstView.path + ": " + upImpl->mError,
+                          __LINE__, __FUNCTION__, __FILE__);
+                if (firstView.frames.empty())
+                {
+                    upImpl->mRunning = false;
+                    upImpl->mConditionVariable.notify_all();
+                    return {};
+                }
+                firstView.lastFrame = std::move(firstView.frames.front());
+                firstView.frames.pop_front();
+                upImpl->mConditionVariable.notify_all();
+                upImpl->mFrameCounter++;
+                const auto timestampMs = firstView.lastFrame.timestampMs;
+                cvMats[0] = firstView.lastFrame.frame;
+                // Closest frame of each other view
+                synchronized = true;
+                for (auto i = 1u ; i < views.size() && synchronized ; i++)
+                {
+                    auto& view = *views[i];
+                    auto isRepeated = false;
+                    const auto* const closestFrame = upImpl->getClosestFrame(isRepeated, view, lock, timestampMs);
+                    if (!upImpl->mRunning)
+                        return {};
+                    if (!upImpl->mError.empty())
+                        error("Error reading " + view.path + ": " + upImpl->mError,
+                              __LINE__, __FUNCTION__, __FILE__);
+                    // View finished --> Stop producer
+                    if (view.ended && view.frames.empty()
+                        && (closestFrame == nullptr
+                            || timestampMs - closestFrame->timestampMs > upImpl->mMaxJitterMs))
+                    {
+                        upImpl->mRunning = false;
+                        upImpl->mConditionVariable.notify_all();
+                        return {};
+                    }
+                    // No frame received yet (e.g., stream starting) or view ahead (e.g., it started later) --> Drop
+                    // frame of the first view
+                    if (closestFrame == nullptr || closestFrame->timestampMs - timestampMs > upImpl->mMaxJitterMs)
+                    {
+                        upImpl->mNumberDroppedFrames++;
+                        synchronized = false;
+                    }
+                    else
+                    {
+                        // View behind (e.g., lower fps or stream with missing frames) --> Repeat its last frame
+                        // Repeated frames are copied, since the previous Datum might still be using them
+                        if (isRepeated)
+                        {
+                            upImpl->mNumberRepeatedFrames++;
+                            cvMats[i] = closestFrame->frame.clone();
+                        }
+                        else
+                            cvMats[i] = closestFrame->frame;
+                    }
+                }
+            }
+            if (!synchronized)
+                return {};
+            // Return frames
+            std::vector<Matrix> frames(cvMats.size());
+            for (auto i = 0u ; i < cvMats.size() ; i++)
+                frames[i] = OP_CV2OPMAT(cvMats[i]);
+            return frames;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    double MultiVideoReader::get(const int capProperty)
+    {
+        try
+        {
+            if (capProperty == CV_CAP_PROP_FRAME_WIDTH)
+            {
+                if (Producer::get(ProducerProperty::Rotation) == 0.
+                    || Producer::get(ProducerProperty::Rotation) == 180.)
+                    return upImpl->mResolution.x;
+                else
+                    return upImpl->mResolution.y;
+            }
+            else if (capProperty == CV_CAP_PROP_FRAME_HEIGHT)
+            {
+                if (Producer::get(ProducerProperty::Rotation) == 0.
+                    || Producer::get(ProducerProperty::Rotation) == 180.)
+                    return upImpl->mResolution.y;
+                else
+                    return upImpl->mResolution.x;
+            }
+            else if (capProperty == CV_CAP_PROP_POS_FRAMES)
+                return (double)upImpl->mFrameCounter;
+            else if (capProperty == CV_CAP_PROP_FRAME_COUNT)
+                return (upImpl->mViews.empty() || upImpl->mViews[0]->isStream
+                        ? -1. : upImpl->mViews[0]->videoCapture.get(CV_CAP_PROP_FRAME_COUNT));
+            else if (capProperty == CV_CAP_PROP_FPS)
+                return (upImpl->mFps > 0. ? upImpl->mFps : -1.);
+            else
+            {
+                opLog("Unknown property.", Priority::Max, __LINE__, __FUNCTION__, __FILE__);
+                return -1.;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0.;
+        }
+    }
+
+    void MultiVideoReader::set(const int capProperty, const double value)
+    {
+        try
+        {
+            if (capProperty == CV_CAP_PROP_FRAME_WIDTH)
+                upImpl->mResolution.x = {(int)value};
+            else if (capProperty == CV_CAP_PROP_FRAME_HEIGHT)
+                upImpl->mResolution.y = {(int)value};
+            else if (capProperty == CV_CAP_PROP_POS_FRAMES)
+                opLog("This property is read-only.", Priority::Max, __LINE__, __FUNCTION__, __FILE__);
+            else if (capProperty == CV_CAP_PROP_FRAME_COUNT || capProperty == CV_CAP_PROP_FPS)
+                opLog("This property is read-only.", Priority::Max, __LINE__, __FUNCTION__, __FILE__);
+            else
+                opLog("Unknown property.", Priority::Max, __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+}
@@ -4,6 +4,7 @@
 #include <openpose/utilities/fastMath.hpp>
 #include <openpose/utilities/fileSystem.hpp>
 #include <openpose/utilities/openCv.hpp>
+#include <openpose/utilities/string.hpp>
 #include <openpose_private/utilities/openCvMultiversionHeaders.hpp>
 
 namespace op
@@ -46,12 +47,13 @@ namespace op
                 // If no stereo --> Set to 1
                 if (mNumberViews <= 0)
                     mNumberViews = 1;
-                // Get camera paremeters
-                if (mNumberViews > 1 || undistortImage)
+                // Get camera paremeters (a single XML file is always loaded, e.g., for `--3d_ground_plane`)
+                const auto extension = getFileExtension(cameraParameterPath);
+                const auto isXmlFile = (extension == "xml" || extension == "XML");
+                if (mNumberViews > 1 || undistortImage || isXmlFile)
                 {
-                    const auto extension = getFileExtension(cameraParameterPath);
                     // Get camera paremeters
-                    if (extension == "xml" || extension == "XML")
+                    if (isXmlFile)
                         mCameraParameterReader.readParameters(
                             getFileParentFolderPath(cameraParameterPath), getFileNameNoExtension(cameraParameterPath));
                     else // if (mNumberViews > 1)
@@ -294,7 +296,10 @@ namespace op
             {
                 mNumberEmptyFrames = 0;
 
-                if (mType != ProducerType::ImageDirectory
+                // Image directories, synchronized videos, and watched folders can contain images of different
+                // resolutions
+                if (mType != ProducerType::ImageDirectory && mType != ProducerType::MultiVideo
+                      && mType != ProducerType::WatchFolder
                       && ((frame.cols() != get(CV_CAP_PROP_FRAME_WIDTH) && get(CV_CAP_PROP_FRAME_WIDTH) > 0)
                           || (frame.rows() != get(CV_CAP_PROP_FRAME_HEIGHT) && get(CV_CAP_PROP_FRAME_HEIGHT) > 0)))
                 {
@@ -324,6 +329,7 @@ namespace op
                 // closed keeping the 0-index frame counting
                 if (mNumberEmptyFrames > 2
                     || (mType != ProducerType::FlirCamera && mType != ProducerType::IPCamera
+                        && mType != ProducerType::MultiVideo && mType != ProducerType::WatchFolder
                         && mType != ProducerType::Webcam
                         && get(CV_CAP_PROP_POS_FRAMES) >= get(CV_CAP_PROP_FRAME_COUNT)))
                 {
@@ -410,7 +416,8 @@ namespace op
 
     std::shared_ptr<Producer> createProducer(
         const ProducerType producerType, const std::string& producerString, const Point<int>& cameraResolution,
-        const std::string& cameraParameterPath, const bool undistortImage, const int numberViews)
+        const std::string& cameraParameterPath, const bool undistortImage, const int numberViews,
+        const std::string& processedFilesPath)
     {
         try
         {
@@ -427,6 +434,14 @@ namespace op
             // IP camera
             else if (producerType == ProducerType::IPCamera)
                 return std::make_shared<IpCameraReader>(producerString, cameraParameterPath, undistortImage);
+            // Several synchronized videos and/or IP cameras
+            else if (producerType == ProducerType::MultiVideo)
+                return std::make_shared<MultiVideoReader>(
+                    splitString(producerString, ","), cameraParameterPath, undistortImage, numberViews);
+            // Folder continuously receiving new images
+            else if (producerType == ProducerType::WatchFolder)
+                return std::make_shared<WatchFolderReader>(
+                    producerString, processedFilesPath, cameraParameterPath, undistortImage);
             // Flir camera
             else if (producerType == ProducerType::FlirCamera)
                 return std::make_shared<FlirReader>(
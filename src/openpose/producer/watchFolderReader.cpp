@@ -0,0 +1,544 @@
+#include <openpose/producer/watchFolderReader.hpp>
+#include <algorithm> // std::find
+#include <condition_variable>
+#include <cstdio> // std::remove, std::rename
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#ifdef __linux__
+    #include <cerrno> // errno
+    #include <poll.h> // poll
+    #include <sys/inotify.h> // inotify_init1, inotify_add_watch
+    #include <unistd.h> // close, read
+#endif
+#include <openpose/filestream/fileStream.hpp>
+#include <openpose/utilities/fileSystem.hpp>
+#include <openpose/utilities/string.hpp>
+#include <openpose_private/utilities/openCvMultiversionHeaders.hpp>
+
+namespace op
+{
+    // Threads decoding the images in parallel
+    const auto WATCH_FOLDER_DECODING_THREADS = 4u;
+    // Maximum number of images being decoded or decoded but not processed yet. Once reached, new images wait on disk
+    const auto WATCH_FOLDER_MAX_QUEUED_FRAMES = 16ull;
+    // Maximum time (in msec) the watching thread waits for new images before checking whether it must stop
+    const auto WATCH_FOLDER_POLL_TIMEOUT_MS = 100;
+    // `--watch_dir_processed` value to delete the images once read
+    const auto WATCH_FOLDER_DELETE = std::string{"delete"};
+
+    struct WatchFolderImage
+    {
+        std::string path;
+        Matrix frame;
+    };
+
+    struct WatchFolderReader::ImplWatchFolderReader
+    {
+        std::string mWatchDirectoryPath;
+        std::string mProcessedFilesPath;
+        std::vector<std::string> mImageExtensions;
+        int mInotifyFd;
+        std::thread mWatchingThread;
+        std::vector<std::thread> mDecodingThreads;
+        std::mutex mMutex;
+        std::condition_variable mConditionVariable;
+        bool mRunning;
+        std::string mError;
+        // Images waiting to be decoded (in arrival order), and number of copies of each path not returned yet
+        std::deque<std::string> mPendingPaths;
+        std::map<std::string, unsigned int> mQueuedPaths;
+        // Decoded images, indexed by arrival order
+        std::map<unsigned long long, WatchFolderImage> mDecodedImages;
+        unsigned long long mNextDecodingIndex;
+        unsigned long long mNextFrameIndex;
+        Point<int> mResolution;
+        unsigned long long mFrameCounter;
+
+        ImplWatchFolderReader() :
+            mInotifyFd{-1},
+            mRunning{false},
+            mNextDecodingIndex{0ull},
+            mNextFrameIndex{0ull},
+            mFrameCounter{0ull}
+        {
+        }
+
+        bool isImageFileName(const std::string& fileName) const
+        {
+            try
+            {
+                // Hidden files (e.g., temporary files of some uploaders) are ignored
+                if (fileName.empty() || fileName[0] == '.')
+                    return false;
+                const auto dotPos = fileName.find_last_of('.');
+                if (dotPos == std::string::npos)
+                    return false;
+                const auto extension = toLower(fileName.substr(dotPos + 1));
+                return std::find(mImageExtensions.begin(), mImageExtensions.end(), extension)
+                    != mImageExtensions.end();
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return false;
+            }
+        }
+
+        // It must be called with the lock
+        void queueImagePath(const std::string& imagePath)
+        {
+            try
+            {
+                // E.g., an image listed when starting while it was still being written, and closed after the folder
+                // started being watched
+                auto& numberQueued = mQueuedPaths[imagePath];
+                if (numberQueued > 0)
+                {
+                    // Not decoded yet --> The close event replaces its entry (i.e., it moves to the back)
+                    const auto pendingPath = std::find(mPendingPaths.begin(), mPendingPaths.end(), imagePath);
+                    if (pendingPath != mPendingPaths.end())
+                    {
+                        mPendingPaths.erase(pendingPath);
+                        mPendingPaths.emplace_back(imagePath);
+                        return;
+                    }
+                    // Already being decoded --> Queued again, the old copy is skipped by getNextImage()
+                }
+                numberQueued++;
+                mPendingPaths.emplace_back(imagePath);
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+
+        // It must be called with the lock
+        void dequeueImagePath(const std::string& imagePath)
+        {
+            try
+            {
+                auto queuedPath = mQueuedPaths.find(imagePath);
+                if (queuedPath != mQueuedPaths.end() && --queuedPath->second == 0u)
+                    mQueuedPaths.erase(queuedPath);
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+
+        void watchFolder()
+        {
+            try
+            {
+                #ifdef __linux__
+                    // Aligned as required by inotify_event
+                    alignas(struct inotify_event) char buffer[64*1024];
+                    struct pollfd pollFd{mInotifyFd, POLLIN, 0};
+                    while (true)
+                    {
+                        {
+                            const std::lock_guard<std::mutex> lock{mMutex};
+                            if (!mRunning)
+                                break;
+                        }
+                        // Wait for new events (with timeout, so release() is not blocked)
+                        const auto status = poll(&pollFd, 1, WATCH_FOLDER_POLL_TIMEOUT_MS);
+                        if (status < 0 && errno != EINTR)
+                            error("Folder " + mWatchDirectoryPath + " could not be watched (poll error "
+                                  + std::to_string(errno) + ").", __LINE__, __FUNCTION__, __FILE__);
+                        if (status <= 0)
+                            continue;
+                        const auto length = read(mInotifyFd, buffer, sizeof(buffer));
+                        if (length < 0 && errno != EAGAIN && errno != EINTR)
+                            error("Folder " + mWatchDirectoryPath + " could not be watched (read error "
+                                  + std::to_string(errno) + ").", __LINE__, __FUNCTION__, __FILE__);
+                        if (length <= 0)
+                            continue;
+                        // New images
+                        std::vector<std::string> imagePaths;
+                        for (auto* eventPtr = buffer ; eventPtr < buffer + length ; )
+                        {
+                            const auto* const event = (const struct inotify_event*)eventPtr;
+                            if (event->mask & IN_Q_OVERFLOW)
+                                opLog("Too many new images at once on " + mWatchDirectoryPath + ", some of them might"
+                                      " have been missed.", Priority::High);
+                            else if (event->mask & IN_IGNORED)
+                                error("Folder " + mWatchDirectoryPath + " was removed or unmounted.",
+                                      __LINE__, __FUNCTION__, __FILE__);
+                            else if (event->len > 0 && !(event->mask & IN_ISDIR) && isImageFileName(event->name))
+                                imagePaths.emplace_back(mWatchDirectoryPath + event->name);
+                            eventPtr += sizeof(struct inotify_event) + event->len;
+                        }
+                        if (!imagePaths.empty())
+                        {
+                            {
+                                const std::lock_guard<std::mutex> lock{mMutex};
+                                for (const auto& imagePath : imagePaths)
+                                    queueImagePath(imagePath);
+                            }
+                            mConditionVariable.notify_all();
+                        }
+                    }
+                #endif
+            }
+            catch (const std::exception& e)
+            {
+                {
+                    const std::lock_guard<std::mutex> lock{mMutex};
+                    mError = e.what();
+                }
+                mConditionVariable.notify_all();
+            }
+        }
+
+        void decodeImages()
+        {
+            try
+            {
+                while (true)
+                {
+                    std::string imagePath;
+                    auto index = 0ull;
+                    // Wait until there is an image to decode and it can be kept in memory (backpressure)
+                    {
+                        std::unique_lock<std::mutex> lock{mMutex};
+                        mConditionVariable.wait(
+                            lock, [this]{
+                                return !mRunning || (!mPendingPaths.empty()
+                                    && mNextDecodingIndex - mNextFrameIndex < WATCH_FOLDER_MAX_QUEUED_FRAMES); });
+                        if (!mRunning)
+                            break;
+                        imagePath = std::move(mPendingPaths.front());
+                        mPendingPaths.pop_front();
+                        index = mNextDecodingIndex++;
+                    }
+                    // Decode image (outside the lock, so images are decoded in parallel)
+                    auto frame = loadImage(imagePath, CV_LOAD_IMAGE_COLOR);
+                    {
+                        const std::lock_guard<std::mutex> lock{mMutex};
+                        mDecodedImages.emplace(index, WatchFolderImage{std::move(imagePath), std::move(frame)});
+                    }
+                    mConditionVariable.notify_all();
+                }
+            }
+            catch (const std::exception& e)
+            {
+                {
+                    const std::lock_guard<std::mutex> lock{mMutex};
+                    mError = e.what();
+                }
+                mConditionVariable.notify_all();
+            }
+        }
+
+        // It waits until the next image (in arrival order) is decoded, skipping the ones that cannot be decoded or
+        // that were re-written while being decoded. It returns nullptr if the reader was released
+        WatchFolderImage* getNextImage(std::unique_lock<std::mutex>& lock)
+        {
+            try
+            {
+                while (true)
+                {
+                    mConditionVariable.wait(
+                        lock, [this]{
+                            return !mRunning || !mError.empty() || mDecodedImages.count(mNextFrameIndex) > 0; });
+                    if (!mError.empty())
+                        error("Error watching " + mWatchDirectoryPath + ": " + mError,
+                              __LINE__, __FUNCTION__, __FILE__);
+                    if (!mRunning)
+                        return nullptr;
+                    auto& image = mDecodedImages.at(mNextFrameIndex);
+                    // A newer copy is queued (i.e., it was closed again while this one was being decoded)
+                    if (mQueuedPaths[image.path] > 1u)
+                        opLog("Image " + image.path + " was re-written while being read, reading it again.",
+                              Priority::Low);
+                    else if (!image.frame.empty())
+                        return &image;
+                    // E.g., corrupted image, kept on the folder
+                    else
+                        opLog("Image " + image.path + " could not be read, skipping it.", Priority::High);
+                    dequeueImagePath(image.path);
+                    mDecodedImages.erase(mNextFrameIndex++);
+                    mConditionVariable.notify_all();
+                }
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return nullptr;
+            }
+        }
+
+        // Keep, delete, or move the image once read
+        void processImageFile(const std::string& imagePath)
+        {
+            try
+            {
+                if (mProcessedFilesPath.empty())
+                    return;
+                else if (mProcessedFilesPath == WATCH_FOLDER_DELETE)
+                {
+                    if (std::remove(imagePath.c_str()) != 0)
+                        opLog("Image " + imagePath + " could not be deleted.", Priority::High);
+                }
+                else
+                {
+                    const auto newImagePath = mProcessedFilesPath + getFileNameAndExtension(imagePath);
+                    if (std::rename(imagePath.c_str(), newImagePath.c_str()) != 0)
+                        opLog("Image " + imagePath + " could not be moved to " + mProcessedFilesPath + " (is it on"
+                              " the same file system?).", Priority::High);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+    };
+
+    WatchFolderReader::WatchFolderReader(const std::string& watchDirectoryPath,
+                                         const std::string& processedFilesPath,
+                                         const std::string& cameraParameterPath, const bool undistortImage) :
+        Producer{ProducerType::WatchFolder, cameraParameterPath, undistortImage, 1},
+        upImpl{new ImplWatchFolderReader{}}
+    {
+        try
+        {
+            #ifdef __linux__
+                // Sanity check
+                upImpl->mWatchDirectoryPath = formatAsDirectory(watchDirectoryPath);
+                if (!existDirectory(upImpl->mWatchDirectoryPath))
+                    error("Folder " + upImpl->mWatchDirectoryPath + " does not exist.",
+                          __LINE__, __FUNCTION__, __FILE__);
+                // Folder for the processed images
+                if (processedFilesPath.empty() || processedFilesPath == WATCH_FOLDER_DELETE)
+                    upImpl->mProcessedFilesPath = processedFilesPath;
+                else
+                {
+                    upImpl->mProcessedFilesPath = formatAsDirectory(processedFilesPath);
+                    if (upImpl->mProcessedFilesPath == upImpl->mWatchDirectoryPath)
+                        error("The folder for the processed images (`--watch_dir_processed`) must be different than"
+                              " the watched one.", __LINE__, __FUNCTION__, __FILE__);
+                    makeDirectory(upImpl->mProcessedFilesPath);
+                }
+                upImpl->mImageExtensions = getExtensionNames(Extensions::Images);
+                // Watch images closed after being written or moved into the folder
+                upImpl->mInotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+                if (upImpl->mInotifyFd < 0)
+                    error("inotify could not be initialized (error " + std::to_string(errno) + ").",
+                          __LINE__, __FUNCTION__, __FILE__);
+                if (inotify_add_watch(
+                    upImpl->mInotifyFd, upImpl->mWatchDirectoryPath.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+                    error("Folder " + upImpl->mWatchDirectoryPath + " could not be watched (error "
+                          + std::to_string(errno) + ").", __LINE__, __FUNCTION__, __FILE__);
+                // Images already on the folder (listed after it started being watched, so none is missed)
+                const auto errorIfNoFiles = false;
+                const auto imagePaths = getFilesOnDirectory(
+                    upImpl->mWatchDirectoryPath, Extensions::Images, errorIfNoFiles);
+                for (const auto& imagePath : imagePaths)
+                    upImpl->queueImagePath(imagePath);
+                opLog("Watching " + upImpl->mWatchDirectoryPath + " for new images ("
+                      + std::to_string(imagePaths.size()) + " images already on it).", Priority::High);
+                // Start watching and decoding threads
+                upImpl->mRunning = true;
+                upImpl->mWatchingThread = std::thread{&ImplWatchFolderReader::watchFolder, upImpl.get()};
+                const auto numberDecodingThreads = std::max(
+                    1u, std::min(WATCH_FOLDER_DECODING_THREADS, std::thread::hardware_concurrency()));
+                for (auto i = 0u ; i < numberDecodingThreads ; i++)
+                    upImpl->mDecodingThreads.emplace_back(&ImplWatchFolderReader::decodeImages, upImpl.get());
+            #else
+                UNUSED(watchDirectoryPath);
+                UNUSED(processedFilesPath);
+                error("WatchFolderReader (`--watch_dir`) is only available on Linux (it requires inotify).",
+                      __LINE__, __FUNCTION__, __FILE__);
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    WatchFolderReader::~WatchFolderReader()
+    {
+        try
+        {
+            release();
+        }
+        catch (const std::exception& e)
+        {
+            errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    std::string WatchFolderReader::getNextFrameName()
+    {
+        try
+        {
+            std::unique_lock<std::mutex> lock{upImpl->mMutex};
+            const auto* const image = upImpl->getNextImage(lock);
+            return (image == nullptr ? "" : getFileNameNoExtension(image->path));
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return "";
+        }
+    }
+
+    bool WatchFolderReader::isOpened() const
+    {
+        try
+        {
+            const std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            return upImpl->mRunning;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    void WatchFolderReader::release()
+    {
+        try
+        {
+            {
+                const std::lock_guard<std::mutex> lock{upImpl->mMutex};
+                upImpl->mRunning = false;
+            }
+            upImpl->mConditionVariable.notify_all();
+            if (upImpl->mWatchingThread.joinable())
+            {
+                upImpl->mWatchingThread.join();
+                opLog("WatchFolderReader: " + std::to_string(upImpl->mFrameCounter) + " images read from "
+                      + upImpl->mWatchDirectoryPath + ".", Priority::High);
+            }
+            for (auto& decodingThread : upImpl->mDecodingThreads)
+                if (decodingThread.joinable())
+                    decodingThread.join();
+            upImpl->mDecodingThreads.clear();
+            #ifdef __linux__
+                if (upImpl->mInotifyFd >= 0)
+                {
+                    close(upImpl->mInotifyFd);
+                    upImpl->mInotifyFd = -1;
+                }
+            #endif
+            upImpl->mPendingPaths.clear();
+            upImpl->mQueuedPaths.clear();
+            upImpl->mDecodedImages.clear();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    Matrix WatchFolderReader::getRawFrame()
+    {
+        try
+        {
+            std::string imagePath;
+            Matrix frame;
+            {
+                std::unique_lock<std::mutex> lock{upImpl->mMutex};
+                auto* const image = upImpl->getNextImage(lock);
+                if (image == nullptr)
+                    return Matrix();
+                imagePath = std::move(image->path);
+                frame = std::move(image->frame);
+                upImpl->mDecodedImages.erase(upImpl->mNextFrameIndex++);
+                upImpl->dequeueImagePath(imagePath);
+                upImpl->mFrameCounter++;
+            }
+            upImpl->mConditionVariable.notify_all();
+            // Keep, delete, or move the image (already in memory)
+            upImpl->processImageFile(imagePath);
+            // Update size, since images might have different size between each one of them
+            upImpl->mResolution = Point<int>{frame.cols(), frame.rows()};
+            return frame;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Matrix();
+        }
+    }
+
+    std::vector<Matrix> WatchFolderReader::getRawFrames()
+    {
+        try
+        {
+            return std::vector<Matrix>{getRawFrame()};
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    double WatchFolderReader::get(const int capProperty)
+    {
+        try
+        {
+            if (capProperty == CV_CAP_PROP_FRAME_WIDTH)
+            {
+                if (Producer::get(ProducerProperty::Rotation) == 0.
+                    || Producer::get(ProducerProperty::Rotation) == 180.)
+                    return upImpl->mResolution.x;
+                else
+                    return upImpl->mResolution.y;
+            }
+            else if (capProperty == CV_CAP_PROP_FRAME_HEIGHT)
+            {
+                if (Producer::get(ProducerProperty::Rotation) == 0.
+                    || Producer::get(ProducerProperty::Rotation) == 180.)
+                    return upImpl->mResolution.y;
+                else
+                    return upImpl->mResolution.x;
+            }
+            else if (capProperty == CV_CAP_PROP_POS_FRAMES)
+                return (double)upImpl->mFrameCounter;
+            // Unknown (new images might arrive at any time)
+            else if (capProperty == CV_CAP_PROP_FRAME_COUNT || capProperty == CV_CAP_PROP_FPS)
+                return -1.;
+            else
+            {
+                opLog("Unknown property.", Priority::Max, __LINE__, __FUNCTION__, __FILE__);
+                return -1.;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0.;
+        }
+    }
+
+    void WatchFolderReader::set(const int capProperty, const double value)
+    {
+        try
+        {
+            if (capProperty == CV_CAP_PROP_FRAME_WIDTH)
+                upImpl->mResolution.x = {(int)value};
+            else if (capProperty == CV_CAP_PROP_FRAME_HEIGHT)
+                upImpl->mResolution.y = {(int)value};
+            else if (capProperty == CV_CAP_PROP_POS_FRAMES || capProperty == CV_CAP_PROP_FRAME_COUNT
+                     || capProperty == CV_CAP_PROP_FPS)
+                opLog("This property is read-only.", Priority::Max, __LINE__, __FUNCTION__, __FILE__);
+            else
+                opLog("Unknown property.", Priority::Max, __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+}
@@ -1,18 +1,11 @@
 #include <openpose_private/tracking/pyramidalLK.hpp>
-#ifdef WITH_SSE4
-    #include <emmintrin.h>
-    #include "smmintrin.h"
-#endif
-
-#ifdef WITH_AVX
-    #include <immintrin.h>
-#endif
-
+#include <algorithm> // std::fill
 #include <iostream>
 #include <opencv2/core/core.hpp> // cv::Point2f, cv::Mat
 #include <opencv2/imgproc/imgproc.hpp> // cv::pyrDown
 #include <opencv2/video/video.hpp> // cv::buildOpticalFlowPyramid
 #include <openpose/utilities/profiler.hpp>
+#include <openpose_private/utilities/simd.hpp>
 
 //#define DEBUG
 // #ifdef DEBUG
@@ -31,72 +24,134 @@
 
 namespace op
 {
-#ifdef WITH_SSE4
-    float sse_dot_product(std::vector<float> &av, std::vector<float> &bv)
+    // Sums of the Lucas-Kanade equations, i.e., sums = {sumXX, sumYY, sumXY, sumXT, sumYT}, in a single pass over
+    // the gradients (no copies nor aligned memory required). The SIMD kernels process the vectorized part and the
+    // scalar one the remaining elements.
+    typedef void (*LkSums)(
+        float* const sums, const float* const ix, const float* const iy, const float* const it, const int size);
+
+    inline void lkSumsTail(
+        float* const sums, const float* const ix, const float* const iy, const float* const it, const int first,
+        const int size)
     {
-
-      /* Get SIMD-vector pointers to the start of each vector */
-      unsigned int niters = av.size() / 4;
-      float zeros[] = {0.0, 0.0, 0.0, 0.0};
-
-      float *a = (float *) aligned_alloc(16, av.size()*sizeof(float));
-      float *b = (float *) aligned_alloc(16, av.size()*sizeof(float));
-      memcpy(a,&av[0],av.size()*sizeof(float));
-      memcpy(b,&bv[0],bv.size()*sizeof(float));
-
-      __m128 *ptrA = (__m128*) &a[0], *ptrB = (__m128*) &b[0];
-      __m128 res = _mm_load_ps(zeros);
-
-      /* Do SIMD dot product */
-      for (unsigned int i = 0; i < niters; i++, ptrA++,ptrB++)
-        res = _mm_add_ps(_mm_dp_ps(*ptrA, *ptrB, 255), res);
-
-
-      /* Get result back from the SIMD vector */
-      float fres[4];
-      _mm_store_ps (fres, res);
-      int q = 4 * niters;
-
-      for (unsigned int i = 0; i < av.size() % 4; i++)
-        fres[0] += (a[i+q]*b[i+q]);
-
-      free(a);
-      free(b);
-
-      return fres[0];
+        for (auto i = first ; i < size ; i++)
+        {
+            sums[0] += ix[i] * ix[i];
+            sums[1] += iy[i] * iy[i];
+            sums[2] += ix[i] * iy[i];
+            sums[3] += ix[i] * it[i];
+            sums[4] += iy[i] * it[i];
+        }
     }
-#endif
 
-// Function aligned_alloc requires C++17 in VS
-#if defined (WITH_AVX) && !defined (_WIN32)
-    float avx_dot_product(std::vector<float> &av, std::vector<float> &bv)
+    void lkSumsScalar(
+        float* const sums, const float* const ix, const float* const iy, const float* const it, const int size)
     {
-        /* Get SIMD-vector pointers to the start of each vector */
-        const size_t niters = av.size() / 8;
-
-        float *a = (float *)aligned_alloc(32, av.size() * sizeof(float));
-        float *b = (float *)aligned_alloc(32, av.size() * sizeof(float));
-        memcpy(a, &av[0], av.size() * sizeof(float));
-        memcpy(b, &bv[0], bv.size() * sizeof(float));
-
-        __m256 *ptrA = (__m256*) &a[0], *ptrB = (__m256*) &b[0];
-        __m256 res = _mm256_set1_ps(0.0);
-
-        for (size_t i = 0; i < niters; i++, ptrA++, ptrB++)
-            res = _mm256_add_ps(_mm256_dp_ps(*ptrA, *ptrB, 255), res);
+        std::fill(sums, sums + 5, 0.f);
+        lkSumsTail(sums, ix, iy, it, 0, size);
+    }
 
-        /* Get result back from the SIMD vector */
-        float fres[8];
-        _mm256_storeu_ps(fres, res);
-        const size_t q = 8 * niters;
+#ifdef OP_SIMD_X86
+    OP_TARGET_SSE42 inline float horizontalSumSse42(const __m128 values)
+    {
+        const auto sum2 = _mm_add_ps(values, _mm_movehl_ps(values, values));
+        return _mm_cvtss_f32(_mm_add_ss(sum2, _mm_shuffle_ps(sum2, sum2, 1)));
+    }
 
-        for (size_t i = 0; i < av.size() % 8; i++)
-            fres[0] += (a[i + q] * b[i + q]);
+    OP_TARGET_SSE42 void lkSumsSse42(
+        float* const sums, const float* const ix, const float* const iy, const float* const it, const int size)
+    {
+        __m128 accumulators[5];
+        for (auto& accumulator : accumulators)
+            accumulator = _mm_setzero_ps();
+        auto i = 0;
+        for (; i + 4 <= size ; i += 4)
+        {
+            const auto x = _mm_loadu_ps(ix + i);
+            const auto y = _mm_loadu_ps(iy + i);
+            const auto t = _mm_loadu_ps(it + i);
+            accumulators[0] = _mm_add_ps(accumulators[0], _mm_mul_ps(x, x));
+            accumulators[1] = _mm_add_ps(accumulators[1], _mm_mul_ps(y, y));
+            accumulators[2] = _mm_add_ps(accumulators[2], _mm_mul_ps(x, y));
+            accumulators[3] = _mm_add_ps(accumulators[3], _mm_mul_ps(x, t));
+            accumulators[4] = _mm_add_ps(accumulators[4], _mm_mul_ps(y, t));
+        }
+        for (auto k = 0 ; k < 5 ; k++)
+            sums[k] = horizontalSumSse42(accumulators[k]);
+        lkSumsTail(sums, ix, iy, it, i, size);
+    }
 
-        free(a);
-        free(b);
+    OP_TARGET_AVX2 void lkSumsAvx2(
+        float* const sums, const float* const ix, const float* const iy, const float* const it, const int size)
+    {
+        __m256 accumulators[5];
+        for (auto& accumulator : accumulators)
+            accumulator = _mm256_setzero_ps();
+        auto i = 0;
+        for (; i + 8 <= size ; i += 8)
+        {
+            const auto x = _mm256_loadu_ps(ix + i);
+            const auto y = _mm256_loadu_ps(iy + i);
+            const auto t = _mm256_loadu_ps(it + i);
+            accumulators[0] = _mm256_fmadd_ps(x, x, accumulators[0]);
+            accumulators[1] = _mm256_fmadd_ps(y, y, accumulators[1]);
+            accumulators[2] = _mm256_fmadd_ps(x, y, accumulators[2]);
+            accumulators[3] = _mm256_fmadd_ps(x, t, accumulators[3]);
+            accumulators[4] = _mm256_fmadd_ps(y, t, accumulators[4]);
+        }
+        for (auto k = 0 ; k < 5 ; k++)
+            sums[k] = horizontalSumSse42(_mm_add_ps(
+                _mm256_castps256_ps128(accumulators[k]), _mm256_extractf128_ps(accumulators[k], 1)));
+        lkSumsTail(sums, ix, iy, it, i, size);
+    }
 
-        return fres[0] + fres[4];
+    OP_TARGET_AVX512 void lkSumsAvx512(
+        float* const sums, const float* const ix, const float* const iy, const float* const it, const int size)
+    {
+        __m512 accumulators[5];
+        for (auto& accumulator : accumulators)
+            accumulator = _mm512_setzero_ps();
+        auto i = 0;
+        for (; i + 16 <= size ; i += 16)
+        {
+            const auto x = _mm512_loadu_ps(ix + i);
+            const auto y = _mm512_loadu_ps(iy + i);
+            const auto t = _mm512_loadu_ps(it + i);
+            accumulators[0] = _mm512_fmadd_ps(x, x, accumulators[0]);
+            accumulators[1] = _mm512_fmadd_ps(y, y, accumulators[1]);
+            accumulators[2] = _mm512_fmadd_ps(x, y, accumulators[2]);
+            accumulators[3] = _mm512_fmadd_ps(x, t, accumulators[3]);
+            accumulators[4] = _mm512_fmadd_ps(y, t, accumulators[4]);
+        }
+        for (auto k = 0 ; k < 5 ; k++)
+            sums[k] = _mm512_reduce_add_ps(accumulators[k]);
+        lkSumsTail(sums, ix, iy, it, i, size);
+    }
+#elif defined(OP_SIMD_NEON)
+    void lkSumsNeon(
+        float* const sums, const float* const ix, const float* const iy, const float* const it, const int size)
+    {
+        float32x4_t accumulators[5];
+        for (auto& accumulator : accumulators)
+            accumulator = vdupq_n_f32(0.f);
+        auto i = 0;
+        for (; i + 4 <= size ; i += 4)
+        {
+            const auto x = vld1q_f32(ix + i);
+            const auto y = vld1q_f32(iy + i);
+            const auto t = vld1q_f32(it + i);
+            accumulators[0] = vmlaq_f32(accumulators[0], x, x);
+            accumulators[1] = vmlaq_f32(accumulators[1], y, y);
+            accumulators[2] = vmlaq_f32(accumulators[2], x, y);
+            accumulators[3] = vmlaq_f32(accumulators[3], x, t);
+            accumulators[4] = vmlaq_f32(accumulators[4], y, t);
+        }
+        for (auto k = 0 ; k < 5 ; k++)
+        {
+            const auto sum2 = vadd_f32(vget_low_f32(accumulators[k]), vget_high_f32(accumulators[k]));
+            sums[k] = vget_lane_f32(vpadd_f32(sum2, sum2), 0);
+        }
+        lkSumsTail(sums, ix, iy, it, i, size);
     }
 #endif
 
@@ -105,34 +160,17 @@ namespace op
     {
         try
         {
-            // Calculate sums
-#if defined (WITH_AVX) && !defined (_WIN32)
-            const float sumXX = avx_dot_product(ix,ix);
-            const float sumYY = avx_dot_product(iy,iy);
-            const float sumXY = avx_dot_product(ix,iy);
-            const float sumXT = avx_dot_product(ix,it);
-            const float sumYT = avx_dot_product(iy,it);
-#elif defined (WITH_SSE4)
-            const float sumXX = sse_dot_product(ix,ix);
-            const float sumYY = sse_dot_product(iy,iy);
-            const float sumXY = sse_dot_product(ix,iy);
-            const float sumXT = sse_dot_product(ix,it);
-            const float sumYT = sse_dot_product(iy,it);
-#else
-            auto sumXX = 0.f;
-            auto sumYY = 0.f;
-            auto sumXT = 0.f;
-            auto sumYT = 0.f;
-            auto sumXY = 0.f;
-            for (auto i = 0u; i < ix.size(); i++)
-            {
-                sumXX += ix[i] * ix[i];
-                sumYY += iy[i] * iy[i];
-                sumXY += ix[i] * iy[i];
-                sumXT += ix[i] * it[i];
-                sumYT += iy[i] * it[i];
-            }
-#endif
+            // Calculate sums (kernel selected once from the CPU instruction set)
+            static const auto lkSums = selectCpuKernel(
+                &lkSumsScalar, OP_X86_KERNEL(lkSumsSse42), OP_X86_KERNEL(lkSumsAvx2), OP_X86_KERNEL(lkSumsAvx512),
+                OP_NEON_KERNEL(lkSumsNeon));
+            float sums[5];
+            lkSums(sums, ix.data(), iy.data(), it.data(), (int)ix.size());
+            const auto sumXX = sums[0];
+            const auto sumYY = sums[1];
+            const auto sumXY = sums[2];
+            const auto sumXT = sums[3];
+            const auto sumYT = sums[4];
 
             // Get numerator and denominator of u and v
             const auto den = (sumXX*sumYY) - (sumXY * sumXY);
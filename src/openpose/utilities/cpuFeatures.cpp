@@ -0,0 +1,129 @@
+#include <openpose/utilities/cpuFeatures.hpp>
+#include <openpose_private/utilities/simd.hpp>
+#ifdef OP_SIMD_X86
+    #ifdef _MSC_VER
+        #include <intrin.h> // __cpuid, __cpuidex, _xgetbv
+    #else
+        #include <cpuid.h> // __get_cpuid_max, __cpuid_count
+    #endif
+#endif
+
+namespace op
+{
+    #ifdef OP_SIMD_X86
+        // It fills registers = {eax, ebx, ecx, edx} for the desired CPUID leaf (0s if not supported)
+        void getCpuid(unsigned int registers[4], const unsigned int leaf, const unsigned int subleaf = 0)
+        {
+            registers[0] = registers[1] = registers[2] = registers[3] = 0;
+            #ifdef _MSC_VER
+                int cpuInfo[4];
+                __cpuid(cpuInfo, 0);
+                if ((unsigned int)cpuInfo[0] >= leaf)
+                {
+                    __cpuidex(cpuInfo, (int)leaf, (int)subleaf);
+                    for (auto i = 0 ; i < 4 ; i++)
+                        registers[i] = (unsigned int)cpuInfo[i];
+                }
+            #else
+                if (__get_cpuid_max(0, nullptr) >= leaf)
+                    __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+            #endif
+        }
+
+        // Register state enabled by the OS (XCR0)
+        unsigned long long getXcr0()
+        {
+            #ifdef _MSC_VER
+                return _xgetbv(0);
+            #else
+                unsigned int eax, edx;
+                __asm__ volatile ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+                return ((unsigned long long)edx << 32) | eax;
+            #endif
+        }
+
+        bool isBitSet(const unsigned int value, const int bit)
+        {
+            return ((value >> bit) & 1u) != 0;
+        }
+
+        CpuInstructionSet detectCpuInstructionSet()
+        {
+            unsigned int leaf1[4];
+            unsigned int leaf7[4];
+            getCpuid(leaf1, 1);
+            getCpuid(leaf7, 7);
+            // SSE4.2 (+ SSSE3 & SSE4.1)
+            const auto sse42 = isBitSet(leaf1[2], 9) && isBitSet(leaf1[2], 19) && isBitSet(leaf1[2], 20);
+            if (!sse42)
+                return CpuInstructionSet::Scalar;
+            // AVX registers (YMM) enabled by the OS
+            const auto osxsave = isBitSet(leaf1[2], 27);
+            const auto xcr0 = (osxsave ? getXcr0() : 0ull);
+            const auto osAvx = (xcr0 & 0x6ull) == 0x6ull;
+            // AVX2 + FMA
+            const auto avx2 = osAvx && isBitSet(leaf1[2], 28) && isBitSet(leaf1[2], 12) && isBitSet(leaf7[1], 5);
+            if (!avx2)
+                return CpuInstructionSet::Sse42;
+            // AVX-512 F + BW (and opmask/ZMM registers enabled by the OS)
+            const auto osAvx512 = (xcr0 & 0xE6ull) == 0xE6ull;
+            const auto avx512 = osAvx512 && isBitSet(leaf7[1], 16) && isBitSet(leaf7[1], 30);
+            return (avx512 ? CpuInstructionSet::Avx512 : CpuInstructionSet::Avx2);
+        }
+    #endif
+
+    CpuInstructionSet getCpuInstructionSet()
+    {
+        try
+        {
+            // Thread-safe, only detected once
+            static const auto sCpuInstructionSet = []()
+            {
+                #if defined(OP_SIMD_X86)
+                    const auto cpuInstructionSet = detectCpuInstructionSet();
+                #elif defined(OP_SIMD_NEON)
+                    const auto cpuInstructionSet = CpuInstructionSet::Neon;
+                #else
+                    const auto cpuInstructionSet = CpuInstructionSet::Scalar;
+                #endif
+                // Logged once at High priority, so it is shown with the default logging level
+                opLog("SIMD instruction set selected for the CPU kernels: "
+                      + cpuInstructionSetToString(cpuInstructionSet) + ".", Priority::High);
+                return cpuInstructionSet;
+            }();
+            return sCpuInstructionSet;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return CpuInstructionSet::Scalar;
+        }
+    }
+
+    std::string cpuInstructionSetToString(const CpuInstructionSet cpuInstructionSet)
+    {
+        try
+        {
+            if (cpuInstructionSet == CpuInstructionSet::Scalar)
+                return "Scalar";
+            else if (cpuInstructionSet == CpuInstructionSet::Sse42)
+                return "SSE4.2";
+            else if (cpuInstructionSet == CpuInstructionSet::Avx2)
+                return "AVX2";
+            else if (cpuInstructionSet == CpuInstructionSet::Avx512)
+                return "AVX-512";
+            else if (cpuInstructionSet == CpuInstructionSet::Neon)
+                return "NEON";
+            else
+            {
+                error("Unknown CpuInstructionSet.", __LINE__, __FUNCTION__, __FILE__);
+                return "";
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return "";
+        }
+    }
+}
@@ -0,0 +1,204 @@
+#include <openpose/utilities/fileCache.hpp>
+#include <cstdio> // std::remove, std::rename
+#include <cstring> // std::memcpy
+#include <fstream> // std::ifstream, std::ofstream
+#include <functional> // std::hash
+#include <thread> // std::this_thread
+#ifdef _WIN32
+    #include <process.h> // _getpid
+#else
+    #include <fcntl.h> // open
+    #include <sys/mman.h> // madvise, mmap, munmap
+    #include <sys/stat.h> // fstat
+    #include <unistd.h> // close, getpid
+#endif
+
+namespace op
+{
+    struct MappedFile::ImplMappedFile
+    {
+        const char* mDataPtr;
+        std::size_t mSize;
+        std::vector<char> mDataBuffer; // Only used if memory-mapping is not available
+
+        ImplMappedFile() :
+            mDataPtr{nullptr},
+            mSize{0}
+        {
+        }
+
+        ~ImplMappedFile()
+        {
+            #ifndef _WIN32
+                if (mDataPtr != nullptr && mDataBuffer.empty())
+                    munmap((void*)mDataPtr, mSize);
+            #endif
+        }
+    };
+
+    MappedFile::MappedFile(const std::string& filePath, const bool sequentialAccess) :
+        upImpl{new ImplMappedFile{}}
+    {
+        try
+        {
+            #ifndef _WIN32
+                const auto fileDescriptor = open(filePath.c_str(), O_RDONLY);
+                if (fileDescriptor < 0)
+                    return;
+                struct stat fileStats;
+                if (fstat(fileDescriptor, &fileStats) != 0 || fileStats.st_size <= 0)
+                {
+                    close(fileDescriptor);
+                    return;
+                }
+                const auto fileSize = (std::size_t)fileStats.st_size;
+                void* mappedPtr = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+                close(fileDescriptor);
+                if (mappedPtr == MAP_FAILED)
+                    return;
+                if (sequentialAccess)
+                    madvise(mappedPtr, fileSize, MADV_WILLNEED);
+                upImpl->mDataPtr = (const char*)mappedPtr;
+                upImpl->mSize = fileSize;
+            #else
+                UNUSED(sequentialAccess);
+                std::ifstream fileStream{filePath, std::ios::binary | std::ios::ate};
+                if (!fileStream.is_open() || (long long)fileStream.tellg() <= 0)
+                    return;
+                upImpl->mDataBuffer.resize((std::size_t)fileStream.tellg());
+                fileStream.seekg(0);
+                if (!fileStream.read(upImpl->mDataBuffer.data(), upImpl->mDataBuffer.size()))
+                {
+                    upImpl->mDataBuffer.clear();
+                    return;
+                }
+                upImpl->mDataPtr = upImpl->mDataBuffer.data();
+                upImpl->mSize = upImpl->mDataBuffer.size();
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    MappedFile::~MappedFile()
+    {
+    }
+
+    bool MappedFile::empty() const
+    {
+        try
+        {
+            return upImpl->mDataPtr == nullptr;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return true;
+        }
+    }
+
+    const char* MappedFile::data() const
+    {
+        try
+        {
+            return upImpl->mDataPtr;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+
+    std::size_t MappedFile::size() const
+    {
+        try
+        {
+            return upImpl->mSize;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0;
+        }
+    }
+
+    unsigned long long getFileCacheChecksum(const char* const data, const std::size_t size)
+    {
+        try
+        {
+            const auto prime = 1099511628211ull;
+            auto hash = 14695981039346656037ull;
+            // 8 bytes at a time (memcpy, as data might not be aligned)
+            const auto numberWords = size / sizeof(unsigned long long);
+            for (auto i = 0ull ; i < numberWords ; i++)
+            {
+                unsigned long long word;
+                std::memcpy(&word, data + i*sizeof(unsigned long long), sizeof(unsigned long long));
+                hash ^= word;
+                hash *= prime;
+            }
+            // Remaining bytes
+            for (auto i = numberWords*sizeof(unsigned long long) ; i < size ; i++)
+            {
+                hash ^= (unsigned char)data[i];
+                hash *= prime;
+            }
+            // The multiplication only propagates the low bits upwards, so the high ones are folded back
+            return hash ^ (hash >> 32);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0ull;
+        }
+    }
+
+    bool writeFileAtomically(
+        const std::string& filePath, const std::vector<std::pair<const char*, std::size_t>>& blocks)
+    {
+        try
+        {
+            // Temporary file unique to this writer (process and thread), so concurrent writers of the same file
+            // (e.g., several processes sharing a model folder) never write into the same temporary file
+            #ifdef _WIN32
+                const auto processId = (unsigned long long)_getpid();
+            #else
+                const auto processId = (unsigned long long)getpid();
+            #endif
+            const auto threadId = (unsigned long long)std::hash<std::thread::id>{}(std::this_thread::get_id());
+            const auto filePathTemporary = filePath + "." + std::to_string(processId) + "."
+                                         + std::to_string(threadId) + ".tmp";
+            {
+                std::ofstream fileStream{filePathTemporary, std::ios::binary};
+                if (!fileStream.is_open())
+                    return false;
+                for (const auto& block : blocks)
+                    fileStream.write(block.first, block.second);
+                if (!fileStream.good())
+                {
+                    fileStream.close();
+                    std::remove(filePathTemporary.c_str());
+                    return false;
+                }
+            }
+            // std::rename does not overwrite existing files on Windows
+            #ifdef _WIN32
+                std::remove(filePath.c_str());
+            #endif
+            if (std::rename(filePathTemporary.c_str(), filePath.c_str()) != 0)
+            {
+                std::remove(filePathTemporary.c_str());
+                return false;
+            }
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+}
@@ -1,14 +1,16 @@
 #include <openpose/utilities/fileSystem.hpp>
-#include <algorithm> // std::replace
-#include <cctype> // std::isdigit
+#include <algorithm> // std::find, std::replace, std::sort
+#include <cctype> // std::isdigit, std::toupper
 #include <cstdio> // std::fopen
+#include <cstdlib> // _fullpath, realpath, std::free
 #include <cstring> // std::strncmp
 #ifdef _WIN32
     #include <direct.h> // _mkdir
+    #include <sys/stat.h> // _stat64
     #include <windows.h> // DWORD, GetFileAttributesA
 #elif defined __unix__ || defined __APPLE__
     #include <dirent.h> // opendir
-    #include <sys/stat.h> // mkdir
+    #include <sys/stat.h> // mkdir, stat
 #else
     #error Unknown environment!
 #endif
@@ -16,46 +18,66 @@
 
 namespace op
 {
-    bool compareNat(const std::string& a, const std::string& b)
+    std::string getNaturalSortKey(const std::string& string)
     {
-        // If any is empty, that one is shorter
-        if (a.empty())
-            return true;
-        else if (b.empty())
-            return false;
-        // If one is digit, return that one
-        else if (std::isdigit(a[0]) && !std::isdigit(b[0]))
-            return true;
-        else if (!std::isdigit(a[0]) && std::isdigit(b[0]))
-            return false;
-        // If none is digit, compare those strings
-        else if (!std::isdigit(a[0]) && !std::isdigit(b[0]))
-        {
-            if (std::toupper(a[0]) == std::toupper(b[0]))
-                return compareNat(a.substr(1), b.substr(1));
-            return (std::toupper(a[0]) < std::toupper(b[0]));
-        }
-        // Both strings begin with digit
-        else
-        {
-            // Remove 0s at the beginning
-            const std::string aNo0s = remove0sFromString(a);
-            const std::string bNo0s = remove0sFromString(b);
-            // Get only number
-            const std::string aNumberAsString = getFirstNumberOnString(aNo0s);
-            const std::string bNumberAsString = getFirstNumberOnString(bNo0s);
-            // 1 number is longer --> it is bigger
-            if (aNumberAsString.size() != bNumberAsString.size())
-                return aNumberAsString.size() < bNumberAsString.size();
-            // Both same length --> Compare them
-            for (auto i = 0u ; i < aNumberAsString.size() ; ++i)
-                if (aNumberAsString[i] != bNumberAsString[i])
-                    return aNumberAsString[i] < bNumberAsString[i];
-            // Both same number --> Remove and return compareNat after removing those characters
-            const std::string aWithoutFirstNumber = aNo0s.substr(aNumberAsString.size(), aNo0s.size());
-            const std::string bWithoutFirstNumber = bNo0s.substr(bNumberAsString.size(), bNo0s.size());
-            // Number removed, compared the rest of the string
-            return compareNat(aWithoutFirstNumber, bWithoutFirstNumber);
+        try
+        {
+            std::string key;
+            key.reserve(string.size() + 8);
+            auto i = 0u;
+            while (i < string.size())
+            {
+                // Numbers: '\x01' (so digits go before any other character), number of digits without the
+                // initial 0s (so longer numbers go after shorter ones), and the digits themselves
+                if (std::isdigit((unsigned char)string[i]))
+                {
+                    while (i < string.size() && string[i] == '0')
+                        i++;
+                    const auto numberBegin = i;
+                    while (i < string.size() && std::isdigit((unsigned char)string[i]))
+                        i++;
+                    const auto numberLength = i - numberBegin;
+                    key += '\x01';
+                    for (auto byte = 3 ; byte >= 0 ; byte--)
+                        key += (char)((numberLength >> (8*byte)) & 0xFF);
+                    key.append(string, numberBegin, numberLength);
+                }
+                // Other characters: case insensitive
+                else
+                {
+                    key += (char)std::toupper((unsigned char)string[i]);
+                    i++;
+                }
+            }
+            return key;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return "";
+        }
+    }
+
+    void sortNatural(std::vector<std::string>& strings)
+    {
+        try
+        {
+            // Keys computed once (rather than parsing both strings on each one of the O(N log N) comparisons).
+            // Strings with the same key (e.g., "01" and "1") are sorted alphabetically.
+            std::vector<std::pair<std::string, std::string>> keysAndStrings;
+            keysAndStrings.reserve(strings.size());
+            for (auto& string : strings)
+            {
+                auto key = getNaturalSortKey(string);
+                keysAndStrings.emplace_back(std::move(key), std::move(string));
+            }
+            std::sort(keysAndStrings.begin(), keysAndStrings.end());
+            for (auto i = 0u ; i < strings.size() ; i++)
+                strings[i] = std::move(keysAndStrings[i].second);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
         }
     }
 
@@ -148,6 +170,85 @@ namespace op
         }
     }
 
+    long long getLastModificationTime(const std::string& path)
+    {
+        try
+        {
+            // stat fails on Windows if the path ends in '/' or '\\'
+            auto cleanedPath = path;
+            while (cleanedPath.size() > 1 && (cleanedPath.back() == '/' || cleanedPath.back() == '\\'))
+                cleanedPath.pop_back();
+            #ifdef _WIN32
+                struct _stat64 fileStat;
+                if (_stat64(cleanedPath.c_str(), &fileStat) != 0)
+                    return -1ll;
+                return (long long)fileStat.st_mtime * 1000000000ll;
+            #elif defined __unix__ || defined __APPLE__
+                struct stat fileStat;
+                if (stat(cleanedPath.c_str(), &fileStat) != 0)
+                    return -1ll;
+                #ifdef __APPLE__
+                    return (long long)fileStat.st_mtimespec.tv_sec * 1000000000ll + fileStat.st_mtimespec.tv_nsec;
+                #else
+                    return (long long)fileStat.st_mtim.tv_sec * 1000000000ll + fileStat.st_mtim.tv_nsec;
+                #endif
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return -1ll;
+        }
+    }
+
+    std::string getAbsolutePath(const std::string& path)
+    {
+        try
+        {
+            #ifdef _WIN32
+                char absolutePath[_MAX_PATH];
+                if (_fullpath(absolutePath, path.c_str(), _MAX_PATH) == nullptr
+                    || getLastModificationTime(absolutePath) < 0)
+                    return "";
+                return std::string{absolutePath};
+            #elif defined __unix__ || defined __APPLE__
+                char* const absolutePath = realpath(path.c_str(), nullptr);
+                if (absolutePath == nullptr)
+                    return "";
+                const std::string absolutePathString{absolutePath};
+                std::free(absolutePath);
+                return absolutePathString;
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return "";
+        }
+    }
+
+    long long getFileSize(const std::string& filePath)
+    {
+        try
+        {
+            #ifdef _WIN32
+                struct _stat64 fileStat;
+                if (_stat64(filePath.c_str(), &fileStat) != 0)
+                    return -1ll;
+            #elif defined __unix__ || defined __APPLE__
+                struct stat fileStat;
+                if (stat(filePath.c_str(), &fileStat) != 0)
+                    return -1ll;
+            #endif
+            return (long long)fileStat.st_size;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return -1ll;
+        }
+    }
+
     std::string formatAsDirectory(const std::string& directoryPathString)
     {
         try
@@ -296,25 +397,9 @@ namespace op
         }
     }
 
-    bool extensionIsDesired(const std::string& extension, const std::vector<std::string>& extensions)
-    {
-        try
-        {
-            const auto cleanedExtension = toLower(removeExtensionDot(extension));
-            for (auto& extensionI : extensions)
-                if (cleanedExtension == toLower(removeExtensionDot(extensionI)))
-                    return true;
-            return false;
-        }
-        catch (const std::exception& e)
-        {
-            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
-            return false;
-        }
-    }
-
     std::vector<std::string> getFilesOnDirectory(const std::string& directoryPath,
-                                                 const std::vector<std::string>& extensions)
+                                                 const std::vector<std::string>& extensions,
+                                                 const bool errorIfNoFiles)
     {
         try
         {
@@ -323,8 +408,27 @@ namespace op
             // Check folder exits
             if (!existDirectory(formatedPath))
                 error("Folder " + formatedPath + " does not exist.", __LINE__, __FUNCTION__, __FILE__);
-            // Read all files in folder
-            std::vector<std::string> filePaths;
+            // Desired extensions, cleaned once (rather than for each file)
+            std::vector<std::string> cleanedExtensions;
+            for (const auto& extension : extensions)
+                cleanedExtensions.emplace_back(toLower(removeExtensionDot(extension)));
+            // Read all file names in folder, keeping only the ones with the desired extensions
+            std::vector<std::string> fileNames;
+            auto numberFiles = 0ull;
+            const auto addFileName = [&](const std::string& fileName)
+            {
+                numberFiles++;
+                if (!cleanedExtensions.empty())
+                {
+                    const auto dotPos = fileName.find_last_of('.');
+                    const auto extension = toLower(
+                        dotPos == std::string::npos ? std::string{} : fileName.substr(dotPos + 1));
+                    if (std::find(cleanedExtensions.begin(), cleanedExtensions.end(), extension)
+                        == cleanedExtensions.end())
+                        return;
+                }
+                fileNames.emplace_back(fileName);
+            };
             #ifdef _WIN32
                 auto formatedPathWindows = formatedPath;
                 formatedPathWindows.append("\\*");
@@ -333,7 +437,8 @@ namespace op
                 if ((hFind = FindFirstFile(formatedPathWindows.c_str(), &data)) != INVALID_HANDLE_VALUE)
                 {
                     do
-                        filePaths.emplace_back(formatedPath + data.cFileName);
+                        if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+                            addFileName(data.cFileName);
                     while (FindNextFile(hFind, &data) != 0);
                     FindClose(hFind);
                 }
@@ -345,32 +450,30 @@ namespace op
                 struct dirent* direntPtr;
                 while ((direntPtr = readdir(directoryPtr.get())) != nullptr)
                 {
-                    std::string currentPath = formatedPath + direntPtr->d_name;
-                    if ((strncmp(direntPtr->d_name, ".", 1) == 0) || existDirectory(currentPath))
-                            continue;
-                    filePaths.emplace_back(currentPath);
+                    if (strncmp(direntPtr->d_name, ".", 1) == 0)
+                        continue;
+                    // d_type avoids opening each file (i.e., 1 system call per file) to check whether it is a
+                    // directory. Only unknown types (e.g., some network file systems) and symbolic links are checked
+                    const auto type = direntPtr->d_type;
+                    if (type == DT_DIR
+                        || ((type == DT_UNKNOWN || type == DT_LNK)
+                            && existDirectory(formatedPath + direntPtr->d_name)))
+                        continue;
+                    addFileName(direntPtr->d_name);
                 }
             #else
                 #error Unknown environment!
             #endif
             // Check #files > 0
-            if (filePaths.empty())
+            if (numberFiles == 0 && errorIfNoFiles)
                 error("No files were found on " + formatedPath, __LINE__, __FUNCTION__, __FILE__);
-            // If specific extensions specified
-            if (!extensions.empty())
-            {
-                // Read images
-                std::vector<std::string> specificExtensionPaths;
-                specificExtensionPaths.reserve(filePaths.size());
-                for (const auto& filePath : filePaths)
-                    if (extensionIsDesired(getFileExtension(filePath), extensions))
-                        specificExtensionPaths.emplace_back(filePath);
-                std::swap(filePaths, specificExtensionPaths);
-            }
-            // // Sort alphabetically
-            // std::sort(filePaths.begin(), filePaths.end());
-            // Natural sort
-            std::sort(filePaths.begin(), filePaths.end(), compareNat);
+            // Natural sort (on the file names, the folder is the same for all of them)
+            sortNatural(fileNames);
+            // Full paths
+            std::vector<std::string> filePaths;
+            filePaths.reserve(fileNames.size());
+            for (const auto& fileName : fileNames)
+                filePaths.emplace_back(formatedPath + fileName);
             // Return result
             return filePaths;
         }
@@ -394,20 +497,16 @@ namespace op
         }
     }
 
-    std::vector<std::string> getFilesOnDirectory(const std::string& directoryPath, const Extensions extensions)
+    std::vector<std::string> getExtensionNames(const Extensions extensions)
     {
         try
         {
-            // Get files on directory with the desired extensions
             if (extensions == Extensions::Images)
-            {
-                const std::vector<std::string> extensionNames{
+                return std::vector<std::string>{
                     // Completely supported by OpenCV
                     "bmp", "dib", "pbm", "pgm", "ppm", "sr", "ras",
                     // Most of them supported by OpenCV
                     "jpg", "jpeg", "png"};
-                return getFilesOnDirectory(directoryPath, extensionNames);
-            }
             // Unknown kind of extensions
             else
             {
@@ -423,6 +522,21 @@ namespace op
         }
     }
 
+    std::vector<std::string> getFilesOnDirectory(
+        const std::string& directoryPath, const Extensions extensions, const bool errorIfNoFiles)
+    {
+        try
+        {
+            // Get files on directory with the desired extensions
+            return getFilesOnDirectory(directoryPath, getExtensionNames(extensions), errorIfNoFiles);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
     std::string removeSpecialsCharacters(const std::string& stringToVariate)
     {
         try
@@ -163,7 +163,7 @@ namespace op
 
     ProducerType flagsToProducerType(
         const String& imageDirectory, const String& videoPath, const String& ipCameraPath,
-        const int webcamIndex, const bool flirCamera)
+        const int webcamIndex, const bool flirCamera, const String& videoViewPaths, const String& watchDirectory)
     {
         try
         {
@@ -171,15 +171,21 @@ namespace op
             const std::string& imageDirectoryStd = imageDirectory.getStdString();
             const std::string& videoPathStd = videoPath.getStdString();
             const std::string& ipCameraPathStd = ipCameraPath.getStdString();
+            const std::string& videoViewPathsStd = videoViewPaths.getStdString();
+            const std::string& watchDirectoryStd = watchDirectory.getStdString();
             // Avoid duplicates (e.g., selecting at the time camera & video)
             if (int(!imageDirectoryStd.empty()) + int(!videoPathStd.empty()) + int(webcamIndex > 0)
-                + int(flirCamera) + int(!ipCameraPathStd.empty()) > 1)
+                + int(flirCamera) + int(!ipCameraPathStd.empty()) + int(!videoViewPathsStd.empty())
+                + int(!watchDirectoryStd.empty()) > 1)
                 error("Selected simultaneously"
                       " image directory (seletected: " + (imageDirectoryStd.empty() ? "no" : imageDirectoryStd) + "),"
                       " video (seletected: " + (videoPathStd.empty() ? "no" : videoPathStd) + "),"
                       " camera (selected: " + (webcamIndex > 0 ? std::to_string(webcamIndex) : "no") + "),"
                       " flirCamera (selected: " + (flirCamera ? "yes" : "no") + ","
-                      " and/or IP camera (selected: " + (ipCameraPathStd.empty() ? "no" : ipCameraPathStd) + ")."
+                      " IP camera (selected: " + (ipCameraPathStd.empty() ? "no" : ipCameraPathStd) + "),"
+                      " video views (selected: " + (videoViewPathsStd.empty() ? "no" : videoViewPathsStd) + "),"
+                      " and/or watched directory (selected: "
+                      + (watchDirectoryStd.empty() ? "no" : watchDirectoryStd) + ")."
                       " Please, select only one.", __LINE__, __FUNCTION__, __FILE__);
 
             // Get desired ProducerType
@@ -189,6 +195,10 @@ namespace op
                 return ProducerType::Video;
             else if (!ipCameraPathStd.empty())
                 return ProducerType::IPCamera;
+            else if (!videoViewPathsStd.empty())
+                return ProducerType::MultiVideo;
+            else if (!watchDirectoryStd.empty())
+                return ProducerType::WatchFolder;
             else if (flirCamera)
                 return ProducerType::FlirCamera;
             else
@@ -203,13 +213,14 @@ namespace op
 
     std::pair<ProducerType, String> flagsToProducer(
         const String& imageDirectory, const String& videoPath, const String& ipCameraPath,
-        const int webcamIndex, const bool flirCamera, const int flirCameraIndex)
+        const int webcamIndex, const bool flirCamera, const int flirCameraIndex, const String& videoViewPaths,
+        const String& watchDirectory)
     {
         try
         {
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             const auto type = flagsToProducerType(
-                imageDirectory, videoPath, ipCameraPath, webcamIndex, flirCamera);
+                imageDirectory, videoPath, ipCameraPath, webcamIndex, flirCamera, videoViewPaths, watchDirectory);
 
             if (type == ProducerType::ImageDirectory)
                 return std::make_pair(ProducerType::ImageDirectory, imageDirectory);
@@ -217,6 +228,10 @@ namespace op
                 return std::make_pair(ProducerType::Video, videoPath);
             else if (type == ProducerType::IPCamera)
                 return std::make_pair(ProducerType::IPCamera, ipCameraPath);
+            else if (type == ProducerType::MultiVideo)
+                return std::make_pair(ProducerType::MultiVideo, videoViewPaths);
+            else if (type == ProducerType::WatchFolder)
+                return std::make_pair(ProducerType::WatchFolder, watchDirectory);
             // Flir camera
             else if (type == ProducerType::FlirCamera)
                 return std::make_pair(ProducerType::FlirCamera, String(std::to_string(flirCameraIndex)));
@@ -645,4 +645,301 @@ namespace op
         const Rectangle<float>& rectangleA, const Rectangle<float>& rectangleB);
     template OP_API float getKeypointsRoi(
         const Rectangle<double>& rectangleA, const Rectangle<double>& rectangleB);
+
+    template <typename T>
+    float getKeypointsRoi(
+        const PeopleSpatialIndex<T>& peopleA, const int personA, const PeopleSpatialIndex<T>& peopleB,
+        const int personB)
+    {
+        try
+        {
+            // Sanity checks
+            if (peopleA.getNumberPeople() <= personA)
+                error("PersonA index out of range.", __LINE__, __FUNCTION__, __FILE__);
+            if (peopleB.getNumberPeople() <= personB)
+                error("PersonB index out of range.", __LINE__, __FUNCTION__, __FILE__);
+            // Get ROI
+            return getKeypointsRoi(peopleA.getRectangle(personA), peopleB.getRectangle(personB));
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0.f;
+        }
+    }
+    template OP_API float getKeypointsRoi(
+        const PeopleSpatialIndex<float>& peopleA, const int personA, const PeopleSpatialIndex<float>& peopleB,
+        const int personB);
+    template OP_API float getKeypointsRoi(
+        const PeopleSpatialIndex<double>& peopleA, const int personA, const PeopleSpatialIndex<double>& peopleB,
+        const int personB);
+
+    template <typename T>
+    int getBiggestPerson(const PeopleSpatialIndex<T>& people)
+    {
+        try
+        {
+            auto biggestPoseIndex = -1;
+            auto biggestArea = T(-1);
+            for (auto person = 0 ; person < people.getNumberPeople() ; person++)
+            {
+                const auto newPersonArea = people.getRectangle(person).area();
+                if (newPersonArea > biggestArea)
+                {
+                    biggestArea = newPersonArea;
+                    biggestPoseIndex = person;
+                }
+            }
+            return biggestPoseIndex;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return -1;
+        }
+    }
+    template OP_API int getBiggestPerson(const PeopleSpatialIndex<float>& people);
+    template OP_API int getBiggestPerson(const PeopleSpatialIndex<double>& people);
+
+    template <typename T>
+    void scaleKeypoints2d(
+        PlanarKeypoints<T>& keypoints, const T scaleX, const T scaleY, const T offsetX, const T offsetY)
+    {
+        try
+        {
+            if (!keypoints.empty() && (scaleX != T(1) || scaleY != T(1) || offsetX != T(0) || offsetY != T(0)))
+            {
+                // Error check
+                if (keypoints.getNumberChannels() != 3)
+                    error(errorMessage, __LINE__, __FUNCTION__, __FILE__);
+                // Whole planes (including padding) to keep the loops trivially vectorizable
+                const auto planeStep = keypoints.getPlaneStep();
+                for (auto person = 0 ; person < keypoints.getNumberPeople() ; person++)
+                {
+                    auto* xPtr = keypoints.getPlane(person, 0);
+                    auto* yPtr = keypoints.getPlane(person, 1);
+                    for (auto part = 0 ; part < planeStep ; part++)
+                        xPtr[part] = xPtr[part] * scaleX + offsetX;
+                    for (auto part = 0 ; part < planeStep ; part++)
+                        yPtr[part] = yPtr[part] * scaleY + offsetY;
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+    template OP_API void scaleKeypoints2d(
+        PlanarKeypoints<float>& keypoints, const float scaleX, const float scaleY, const float offsetX,
+        const float offsetY);
+    template OP_API void scaleKeypoints2d(
+        PlanarKeypoints<double>& keypoints, const double scaleX, const double scaleY, const double offsetX,
+        const double offsetY);
+
+    template <typename T>
+    Rectangle<T> getKeypointsRectangle(
+        const PlanarKeypoints<T>& keypoints, const int person, const T threshold, const int firstIndex,
+        const int lastIndex)
+    {
+        try
+        {
+            // Params
+            const auto numberKeypoints = keypoints.getNumberParts();
+            const auto lastIndexClean = (lastIndex < 0 ? numberKeypoints : lastIndex);
+            // Sanity checks
+            if (numberKeypoints < 1)
+                error("Number body parts must be > 0.", __LINE__, __FUNCTION__, __FILE__);
+            if (person >= keypoints.getNumberPeople())
+                error("Person index out of bounds.", __LINE__, __FUNCTION__, __FILE__);
+            if (lastIndexClean > numberKeypoints)
+                error("The value of `lastIndex` must be less or equal than `numberKeypoints`. Currently: "
+                    + std::to_string(lastIndexClean) + " vs. " + std::to_string(numberKeypoints),
+                    __LINE__, __FUNCTION__, __FILE__);
+            if (firstIndex > lastIndexClean)
+                error("The value of `firstIndex` must be less or equal than `lastIndex`. Currently: "
+                    + std::to_string(firstIndex) + " vs. " + std::to_string(lastIndex),
+                    __LINE__, __FUNCTION__, __FILE__);
+            // Branchless min/max (keypoints under threshold do not modify them)
+            const auto* const xPtr = keypoints.getPlane(person, 0);
+            const auto* const yPtr = keypoints.getPlane(person, 1);
+            const auto* const scorePtr = keypoints.getScorePlane(person);
+            const T maxValue = std::numeric_limits<T>::max();
+            const T lowestValue = std::numeric_limits<T>::lowest();
+            T minX = maxValue;
+            T maxX = lowestValue;
+            T minY = minX;
+            T maxY = maxX;
+            for (auto part = firstIndex ; part < lastIndexClean ; part++)
+            {
+                const auto valid = (scorePtr[part] > threshold);
+                minX = fastMin(minX, (valid ? xPtr[part] : maxValue));
+                maxX = fastMax(maxX, (valid ? xPtr[part] : lowestValue));
+                minY = fastMin(minY, (valid ? yPtr[part] : maxValue));
+                maxY = fastMax(maxY, (valid ? yPtr[part] : lowestValue));
+            }
+            if (maxX >= minX && maxY >= minY)
+                return Rectangle<T>{minX, minY, maxX-minX, maxY-minY};
+            else
+                return Rectangle<T>{};
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Rectangle<T>{};
+        }
+    }
+    template OP_API Rectangle<float> getKeypointsRectangle(
+        const PlanarKeypoints<float>& keypoints, const int person, const float threshold, const int firstIndex,
+        const int lastIndex);
+    template OP_API Rectangle<double> getKeypointsRectangle(
+        const PlanarKeypoints<double>& keypoints, const int person, const double threshold, const int firstIndex,
+        const int lastIndex);
+
+    template <typename T>
+    T getAverageScore(const PlanarKeypoints<T>& keypoints, const int person)
+    {
+        try
+        {
+            // Sanity check
+            if (person >= keypoints.getNumberPeople())
+                error("Person index out of bounds.", __LINE__, __FUNCTION__, __FILE__);
+            // Get average score (padding has score 0)
+            T score = T(0);
+            const auto* const scorePtr = keypoints.getScorePlane(person);
+            for (auto part = 0 ; part < keypoints.getPlaneStep() ; part++)
+                score += scorePtr[part];
+            return score / keypoints.getNumberParts();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return T(0);
+        }
+    }
+    template OP_API float getAverageScore(const PlanarKeypoints<float>& keypoints, const int person);
+    template OP_API double getAverageScore(const PlanarKeypoints<double>& keypoints, const int person);
+
+    template <typename T>
+    T getKeypointsArea(const PlanarKeypoints<T>& keypoints, const int person, const T threshold)
+    {
+        try
+        {
+            return getKeypointsRectangle(keypoints, person, threshold).area();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return T(0);
+        }
+    }
+    template OP_API float getKeypointsArea(
+        const PlanarKeypoints<float>& keypoints, const int person, const float threshold);
+    template OP_API double getKeypointsArea(
+        const PlanarKeypoints<double>& keypoints, const int person, const double threshold);
+
+    template <typename T>
+    int getBiggestPerson(const PlanarKeypoints<T>& keypoints, const T threshold)
+    {
+        try
+        {
+            auto biggestPoseIndex = -1;
+            auto biggestArea = T(-1);
+            for (auto person = 0 ; person < keypoints.getNumberPeople() ; person++)
+            {
+                const auto newPersonArea = getKeypointsArea(keypoints, person, threshold);
+                if (newPersonArea > biggestArea)
+                {
+                    biggestArea = newPersonArea;
+                    biggestPoseIndex = person;
+                }
+            }
+            return biggestPoseIndex;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return -1;
+        }
+    }
+    template OP_API int getBiggestPerson(const PlanarKeypoints<float>& keypoints, const float threshold);
+    template OP_API int getBiggestPerson(const PlanarKeypoints<double>& keypoints, const double threshold);
+
+    template <typename T>
+    int getNonZeroKeypoints(const PlanarKeypoints<T>& keypoints, const int person, const T threshold)
+    {
+        try
+        {
+            if (!keypoints.empty())
+            {
+                // Sanity check
+                if (keypoints.getNumberPeople() <= person)
+                    error("Person index out of range.", __LINE__, __FUNCTION__, __FILE__);
+                // Count keypoints
+                auto nonZeroCounter = 0;
+                const auto* const scorePtr = keypoints.getScorePlane(person);
+                for (auto part = 0 ; part < keypoints.getNumberParts() ; part++)
+                    nonZeroCounter += (scorePtr[part] >= threshold);
+                return nonZeroCounter;
+            }
+            else
+                return 0;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0;
+        }
+    }
+    template OP_API int getNonZeroKeypoints(
+        const PlanarKeypoints<float>& keypoints, const int person, const float threshold);
+    template OP_API int getNonZeroKeypoints(
+        const PlanarKeypoints<double>& keypoints, const int person, const double threshold);
+
+    template <typename T>
+    T getDistanceAverage(
+        const PlanarKeypoints<T>& keypointsA, const int personA, const PlanarKeypoints<T>& keypointsB,
+        const int personB, const T threshold)
+    {
+        try
+        {
+            // Sanity checks
+            if (keypointsA.getNumberPeople() <= personA)
+                error("PersonA index out of range.", __LINE__, __FUNCTION__, __FILE__);
+            if (keypointsB.getNumberPeople() <= personB)
+                error("PersonB index out of range.", __LINE__, __FUNCTION__, __FILE__);
+            if (keypointsA.getNumberParts() != keypointsB.getNumberParts())
+                error("Keypoints should have the same number of keypoints.", __LINE__, __FUNCTION__, __FILE__);
+            // Get total distance
+            const auto* const xPtrA = keypointsA.getPlane(personA, 0);
+            const auto* const yPtrA = keypointsA.getPlane(personA, 1);
+            const auto* const scorePtrA = keypointsA.getScorePlane(personA);
+            const auto* const xPtrB = keypointsB.getPlane(personB, 0);
+            const auto* const yPtrB = keypointsB.getPlane(personB, 1);
+            const auto* const scorePtrB = keypointsB.getScorePlane(personB);
+            T totalDistance = 0;
+            int nonZeroCounter = 0;
+            for (auto part = 0 ; part < keypointsA.getNumberParts() ; part++)
+            {
+                const auto valid = (scorePtrA[part] >= threshold && scorePtrB[part] >= threshold);
+                const auto x = xPtrA[part] - xPtrB[part];
+                const auto y = yPtrA[part] - yPtrB[part];
+                totalDistance += (valid ? T(std::sqrt(x*x+y*y)) : T(0));
+                nonZeroCounter += valid;
+            }
+            // Get distance average
+            return totalDistance / nonZeroCounter;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return T(0);
+        }
+    }
+    template OP_API float getDistanceAverage(
+        const PlanarKeypoints<float>& keypointsA, const int personA, const PlanarKeypoints<float>& keypointsB,
+        const int personB, const float threshold);
+    template OP_API double getDistanceAverage(
+        const PlanarKeypoints<double>& keypointsA, const int personA, const PlanarKeypoints<double>& keypointsB,
+        const int personB, const double threshold);
 }
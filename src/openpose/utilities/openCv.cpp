@@ -1,7 +1,8 @@
 #include <openpose/utilities/openCv.hpp>
+#include <algorithm> // std::fill
 #include <openpose/utilities/fastMath.hpp>
-#include <openpose_private/utilities/avx.hpp>
 #include <openpose_private/utilities/openCvMultiversionHeaders.hpp>
+#include <openpose_private/utilities/simd.hpp>
 
 namespace op
 {
@@ -54,6 +55,138 @@ namespace op
         }
     }
 
+    // uCharCvMatToFloatPtr kernels
+    // Each one converts the first pixels of a BGR row into 3 float planes, i.e.,
+    // planePtrs[c][x] = (rowPtr[3*x + c] - means[c]) * scale, in a single pass (de-interleaving, conversion and
+    // normalization) and with unaligned loads/stores. They return the number of pixels processed (a multiple of 16),
+    // the remaining ones are processed by the scalar code.
+    typedef int (*BgrRowToFloatPlanes)(
+        float* const* const planePtrs, const unsigned char* const rowPtr, const int width, const float* const means,
+        const float scale);
+
+    #ifdef OP_SIMD_X86
+        // 16 BGR pixels (48 bytes) into 16 B, 16 G, and 16 R bytes
+        OP_TARGET_SSE42 inline void deinterleaveBgr16(
+            __m128i& b, __m128i& g, __m128i& r, const unsigned char* const bgrPtr)
+        {
+            const auto in0 = _mm_loadu_si128((const __m128i*)bgrPtr);
+            const auto in1 = _mm_loadu_si128((const __m128i*)(bgrPtr + 16));
+            const auto in2 = _mm_loadu_si128((const __m128i*)(bgrPtr + 32));
+            // Index -1 writes a 0
+            b = _mm_or_si128(_mm_or_si128(
+                _mm_shuffle_epi8(in0, _mm_setr_epi8(0,3,6,9,12,15, -1,-1,-1,-1,-1, -1,-1,-1,-1,-1)),
+                _mm_shuffle_epi8(in1, _mm_setr_epi8(-1,-1,-1,-1,-1,-1, 2,5,8,11,14, -1,-1,-1,-1,-1))),
+                _mm_shuffle_epi8(in2, _mm_setr_epi8(-1,-1,-1,-1,-1,-1, -1,-1,-1,-1,-1, 1,4,7,10,13)));
+            g = _mm_or_si128(_mm_or_si128(
+                _mm_shuffle_epi8(in0, _mm_setr_epi8(1,4,7,10,13, -1,-1,-1,-1,-1,-1, -1,-1,-1,-1,-1)),
+                _mm_shuffle_epi8(in1, _mm_setr_epi8(-1,-1,-1,-1,-1, 0,3,6,9,12,15, -1,-1,-1,-1,-1))),
+                _mm_shuffle_epi8(in2, _mm_setr_epi8(-1,-1,-1,-1,-1, -1,-1,-1,-1,-1,-1, 2,5,8,11,14)));
+            r = _mm_or_si128(_mm_or_si128(
+                _mm_shuffle_epi8(in0, _mm_setr_epi8(2,5,8,11,14, -1,-1,-1,-1,-1, -1,-1,-1,-1,-1,-1)),
+                _mm_shuffle_epi8(in1, _mm_setr_epi8(-1,-1,-1,-1,-1, 1,4,7,10,13, -1,-1,-1,-1,-1,-1))),
+                _mm_shuffle_epi8(in2, _mm_setr_epi8(-1,-1,-1,-1,-1, -1,-1,-1,-1,-1, 0,3,6,9,12,15)));
+        }
+
+        OP_TARGET_SSE42 inline void storeNormalizedSse42(
+            float* const floatPtr, __m128i bytes, const __m128 mean, const __m128 scale)
+        {
+            for (auto i = 0 ; i < 4 ; i++)
+            {
+                const auto values = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(bytes));
+                _mm_storeu_ps(floatPtr + 4*i, _mm_mul_ps(_mm_sub_ps(values, mean), scale));
+                bytes = _mm_srli_si128(bytes, 4);
+            }
+        }
+
+        OP_TARGET_SSE42 int bgrRowToFloatPlanesSse42(
+            float* const* const planePtrs, const unsigned char* const rowPtr, const int width,
+            const float* const means, const float scale)
+        {
+            const __m128 mmMeans[3]{_mm_set1_ps(means[0]), _mm_set1_ps(means[1]), _mm_set1_ps(means[2])};
+            const auto mmScale = _mm_set1_ps(scale);
+            auto x = 0;
+            for (; x + 16 <= width ; x += 16)
+            {
+                __m128i bgr[3];
+                deinterleaveBgr16(bgr[0], bgr[1], bgr[2], rowPtr + 3*x);
+                for (auto c = 0 ; c < 3 ; c++)
+                    storeNormalizedSse42(planePtrs[c] + x, bgr[c], mmMeans[c], mmScale);
+            }
+            return x;
+        }
+
+        OP_TARGET_AVX2 inline void storeNormalizedAvx2(
+            float* const floatPtr, const __m128i bytes, const __m256 mean, const __m256 scale)
+        {
+            const auto valuesLow = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes));
+            const auto valuesHigh = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8)));
+            _mm256_storeu_ps(floatPtr, _mm256_mul_ps(_mm256_sub_ps(valuesLow, mean), scale));
+            _mm256_storeu_ps(floatPtr + 8, _mm256_mul_ps(_mm256_sub_ps(valuesHigh, mean), scale));
+        }
+
+        OP_TARGET_AVX2 int bgrRowToFloatPlanesAvx2(
+            float* const* const planePtrs, const unsigned char* const rowPtr, const int width,
+            const float* const means, const float scale)
+        {
+            const __m256 mmMeans[3]{_mm256_set1_ps(means[0]), _mm256_set1_ps(means[1]), _mm256_set1_ps(means[2])};
+            const auto mmScale = _mm256_set1_ps(scale);
+            auto x = 0;
+            for (; x + 16 <= width ; x += 16)
+            {
+                __m128i bgr[3];
+                deinterleaveBgr16(bgr[0], bgr[1], bgr[2], rowPtr + 3*x);
+                for (auto c = 0 ; c < 3 ; c++)
+                    storeNormalizedAvx2(planePtrs[c] + x, bgr[c], mmMeans[c], mmScale);
+            }
+            return x;
+        }
+
+        OP_TARGET_AVX512 int bgrRowToFloatPlanesAvx512(
+            float* const* const planePtrs, const unsigned char* const rowPtr, const int width,
+            const float* const means, const float scale)
+        {
+            const __m512 mmMeans[3]{_mm512_set1_ps(means[0]), _mm512_set1_ps(means[1]), _mm512_set1_ps(means[2])};
+            const auto mmScale = _mm512_set1_ps(scale);
+            auto x = 0;
+            for (; x + 16 <= width ; x += 16)
+            {
+                __m128i bgr[3];
+                deinterleaveBgr16(bgr[0], bgr[1], bgr[2], rowPtr + 3*x);
+                for (auto c = 0 ; c < 3 ; c++)
+                {
+                    const auto values = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(bgr[c]));
+                    _mm512_storeu_ps(planePtrs[c] + x, _mm512_mul_ps(_mm512_sub_ps(values, mmMeans[c]), mmScale));
+                }
+            }
+            return x;
+        }
+    #elif defined(OP_SIMD_NEON)
+        int bgrRowToFloatPlanesNeon(
+            float* const* const planePtrs, const unsigned char* const rowPtr, const int width,
+            const float* const means, const float scale)
+        {
+            const auto mmScale = vdupq_n_f32(scale);
+            auto x = 0;
+            for (; x + 16 <= width ; x += 16)
+            {
+                // vld3q_u8 de-interleaves the 16 BGR pixels
+                const auto bgr = vld3q_u8(rowPtr + 3*x);
+                for (auto c = 0 ; c < 3 ; c++)
+                {
+                    const auto mmMean = vdupq_n_f32(means[c]);
+                    const uint16x8_t halves[2]{vmovl_u8(vget_low_u8(bgr.val[c])), vmovl_u8(vget_high_u8(bgr.val[c]))};
+                    for (auto i = 0 ; i < 4 ; i++)
+                    {
+                        const auto values = vcvtq_f32_u32(vmovl_u16(
+                            (i % 2 == 0 ? vget_low_u16(halves[i/2]) : vget_high_u16(halves[i/2]))));
+                        vst1q_f32(planePtrs[c] + x + 4*i, vmulq_f32(vsubq_f32(values, mmMean), mmScale));
+                    }
+                }
+            }
+            return x;
+        }
+    #endif
+
     void uCharCvMatToFloatPtr(float* floatPtrImage, const Matrix& matImage, const int normalize)
     {
         try
@@ -65,113 +198,52 @@ namespace op
             const int height = cvImage.rows;
             const int channels = cvImage.channels();
 
-            const auto* const originFramePtr = cvImage.data;    // cv::Mat.data is always uchar
-            for (auto c = 0; c < channels; c++)
-            {
-                const auto floatPtrImageOffsetC = c * height;
-                for (auto y = 0; y < height; y++)
-                {
-                    const auto floatPtrImageOffsetY = (floatPtrImageOffsetC + y) * width;
-                    const auto originFramePtrOffsetY = y * width;
-                    for (auto x = 0; x < width; x++)
-                        floatPtrImage[floatPtrImageOffsetY + x] = float(
-                            originFramePtr[(originFramePtrOffsetY + x) * channels + c]);
-                }
-            }
-            // Normalizing if desired
-            // VGG
+            // Normalization as (value - mean[c]) * scale
+            // No normalization
+            std::vector<float> means(channels, 0.f);
+            auto scale = 1.f;
+            // VGG, i.e., value/256 - 0.5
             if (normalize == 1)
             {
-                #ifdef WITH_AVX
-                    // // To check results are the same (norm(x1-x2) = 0)
-                    // cv::Mat floatPtrImageCvWrapper(height, width, CV_32FC3, floatPtrImage);
-                    // cv::Mat floatPtrImageCvWrapperTest = floatPtrImageCvWrapper*(1/256.f) - 0.5f;
-                    // // Speed profiling
-                    // const auto REPS = 2000;
-                    // double timeNormalize0 = 0.;
-                    // double timeNormalize1 = 0.;
-                    // double timeNormalize2 = 0.;
-                    // double timeNormalize3 = 0.;
-                    // // OpenCV wrapper
-                    // OP_PROFILE_INIT(REPS);
-                    // cv::Mat floatPtrImageCvWrapper(height, width, CV_32FC3, floatPtrImage);
-                    // floatPtrImageCvWrapper = floatPtrImageCvWrapper*(1/256.f) - 0.5f;
-                    // OP_PROFILE_END(timeNormalize0, 1e6, REPS);
-                    // // C++ sequential code
-                    // OP_PROFILE_INIT(REPS);
-                    // const auto ratio = 1.f/256.f;
-                    // for (auto pixel = 0 ; pixel < width*height*channels ; ++pixel)
-                    //     floatPtrImage[pixel] = floatPtrImage[pixel]*ratio - 0.5f;
-                    // OP_PROFILE_END(timeNormalize1, 1e6, REPS);
-                    // // OpenCV wrapper
-                    // OP_PROFILE_INIT(REPS);
-                    // cv::Mat floatPtrImageCvWrapper(height, width, CV_32FC3, floatPtrImage);
-                    // floatPtrImageCvWrapper = floatPtrImageCvWrapper*(1/256.f) - 0.5f;
-                    // OP_PROFILE_END(timeNormalize2, 1e6, REPS);
-                    // OP_PROFILE_INIT(REPS);
-                    // AVX code
-                    const auto volume = width*height*channels;
-                    int pixel;
-                    const __m256 mmRatio = _mm256_set1_ps(1.f/256.f);
-                    const __m256 mmBias = _mm256_set1_ps(-0.5f);
-                    for (pixel = 0 ; pixel < volume-7 ; pixel += 8)
-                    {
-                        const __m256 input = _mm256_load_ps(&floatPtrImage[pixel]);
-                        // const __m256 input = _mm256_loadu_ps(&floatPtrImage[pixel]); // If non-aligned pointer
-                        const __m256 output = _mm256_fmadd_ps(input, mmRatio, mmBias);
-                        _mm256_store_ps(&floatPtrImage[pixel], output);
-                        // _mm256_storeu_ps(&floatPtrImage[pixel], output); // If non-aligned pointer
-                    }
-                    const auto ratio = 1.f/256.f;
-                    for (; pixel < volume ; ++pixel)
-                        floatPtrImage[pixel] = floatPtrImage[pixel]*ratio - 0.5f;
-                    // OP_PROFILE_END(timeNormalize3, 1e6, REPS);
-                    // std::cout
-                    //     << "TN1: " << timeNormalize0 << " us\n"
-                    //     << "TN1: " << timeNormalize1 << " us\n"
-                    //     << "TN2: " << timeNormalize2 << " us\n"
-                    //     << "TN3: " << timeNormalize3 << " us\n"
-                    //     << std::endl;
-                    // std::cout
-                    //     << "Norm: " << cv::norm(floatPtrImageCvWrapper-floatPtrImageCvWrapperTest) << "\n"
-                    //     << std::endl;
-                // Non optimized code
-                #else
-                    // floatPtrImage wrapped as cv::Mat
-                        // Empirically tested - OpenCV is more efficient normalizing a whole matrix/image (it uses AVX and
-                        // other optimized instruction sets).
-                        // In addition, the following if statement does not copy the pointer to a cv::Mat, just wrapps it.
-                    cv::Mat floatPtrImageCvWrapper(height*width*3, 1, CV_32FC1, floatPtrImage); // CV_32FC3 warns about https://github.com/opencv/opencv/issues/16739
-                    floatPtrImageCvWrapper = floatPtrImageCvWrapper*(1/256.f) - 0.5f;
-                #endif
+                std::fill(means.begin(), means.end(), 128.f);
+                scale = 1.f/256.f;
             }
-            // // ResNet
+            // // ResNet, i.e., value - mean[c]
             // else if (normalize == 2)
-            // {
-            //     const int imageArea = width * height;
-            //     const std::array<float,3> means{102.9801, 115.9465, 122.7717};
-            //     for (auto i = 0 ; i < 3 ; i++)
-            //     {
-            //         cv::Mat floatPtrImageCvWrapper(height, width, CV_32FC1, floatPtrImage + i*imageArea);
-            //         floatPtrImageCvWrapper = floatPtrImageCvWrapper - means[i];
-            //     }
-            // }
+            //     means = {102.9801f, 115.9465f, 122.7717f};
             // DenseNet
             else if (normalize == 2)
             {
-                const auto scaleDenseNet = 0.017;
-                const int imageArea = width * height;
-                const std::array<float,3> means{103.94f, 116.78f, 123.68f};
-                for (auto i = 0 ; i < 3 ; i++)
-                {
-                    cv::Mat floatPtrImageCvWrapper(height, width, CV_32FC1, floatPtrImage + i*imageArea);
-                    floatPtrImageCvWrapper = scaleDenseNet*(floatPtrImageCvWrapper - means[i]);
-                }
+                const std::array<float,3> meansDenseNet{103.94f, 116.78f, 123.68f};
+                for (auto c = 0 ; c < fastMin(channels, 3) ; c++)
+                    means[c] = meansDenseNet[c];
+                scale = 0.017f;
             }
             // Unknown
             else if (normalize != 0)
                 error("Unknown normalization value (" + std::to_string(normalize) + ").",
                       __LINE__, __FUNCTION__, __FILE__);
+
+            // De-interleave + convert + normalize (single pass)
+            // Kernel selected once from the CPU instruction set (nullptr = scalar code only)
+            static const auto bgrRowToFloatPlanes = selectCpuKernel<BgrRowToFloatPlanes>(
+                nullptr, OP_X86_KERNEL(bgrRowToFloatPlanesSse42), OP_X86_KERNEL(bgrRowToFloatPlanesAvx2),
+                OP_X86_KERNEL(bgrRowToFloatPlanesAvx512), OP_NEON_KERNEL(bgrRowToFloatPlanesNeon));
+            const auto imageArea = width * height;
+            std::vector<float*> planePtrs(channels);
+            for (auto y = 0; y < height; y++)
+            {
+                const auto* const rowPtr = cvImage.ptr<uchar>(y); // cv::Mat.data is always uchar
+                for (auto c = 0; c < channels; c++)
+                    planePtrs[c] = floatPtrImage + c * imageArea + y * width;
+                // SIMD code (BGR images)
+                const auto xSimd = (channels == 3 && bgrRowToFloatPlanes != nullptr
+                    ? bgrRowToFloatPlanes(planePtrs.data(), rowPtr, width, means.data(), scale) : 0);
+                // Scalar code (remaining pixels)
+                for (auto c = 0; c < channels; c++)
+                    for (auto x = xSimd; x < width; x++)
+                        planePtrs[c][x] = (float(rowPtr[x * channels + c]) - means[c]) * scale;
+            }
         }
         catch (const std::exception& e)
         {
@@ -0,0 +1,267 @@
+#include <openpose/utilities/peopleSpatialIndex.hpp>
+#include <algorithm> // std::sort, std::unique
+#include <cmath> // std::floor, std::isfinite
+#include <limits> // std::numeric_limits
+#include <openpose/utilities/fastMath.hpp>
+#include <openpose/utilities/keypoint.hpp>
+
+namespace op
+{
+    // Maximum number of grid cells per person (the cells are enlarged if the people are too sparse)
+    const auto MAX_CELLS_PER_PERSON = 4;
+
+    template<typename T>
+    inline bool isRectangleValid(const Rectangle<T>& rectangle)
+    {
+        return rectangle.width > T(0) && rectangle.height > T(0)
+            && std::isfinite(rectangle.x) && std::isfinite(rectangle.y)
+            && std::isfinite(rectangle.x + rectangle.width) && std::isfinite(rectangle.y + rectangle.height);
+    }
+
+    // Equivalent to getKeypointsRoi(rectangleA, rectangleB) > 0
+    template<typename T>
+    inline bool rectanglesOverlap(const Rectangle<T>& rectangleA, const Rectangle<T>& rectangleB)
+    {
+        return rectangleA.x < rectangleB.x + rectangleB.width && rectangleB.x < rectangleA.x + rectangleA.width
+            && rectangleA.y < rectangleB.y + rectangleB.height && rectangleB.y < rectangleA.y + rectangleA.height;
+    }
+
+    template<typename T>
+    std::vector<Rectangle<T>> getKeypointsRectangles(
+        const Array<T>& keypoints, const T threshold, const int firstIndex, const int lastIndex)
+    {
+        try
+        {
+            std::vector<Rectangle<T>> rectangles(keypoints.empty() ? 0 : keypoints.getSize(0));
+            for (auto person = 0u ; person < rectangles.size() ; person++)
+                rectangles[person] = getKeypointsRectangle(keypoints, (int)person, threshold, firstIndex, lastIndex);
+            return rectangles;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    template<typename T>
+    PeopleSpatialIndex<T>::PeopleSpatialIndex(const std::vector<Rectangle<T>>& rectangles)
+    {
+        try
+        {
+            reset(rectangles);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename T>
+    PeopleSpatialIndex<T>::PeopleSpatialIndex(
+        const Array<T>& keypoints, const T threshold, const int firstIndex, const int lastIndex)
+    {
+        try
+        {
+            reset(getKeypointsRectangles(keypoints, threshold, firstIndex, lastIndex));
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename T>
+    void PeopleSpatialIndex<T>::reset(const std::vector<Rectangle<T>>& rectangles)
+    {
+        try
+        {
+            mRectangles = rectangles;
+            mGridSize = Point<int>{0, 0};
+            mCellStarts.clear();
+            mCellPeople.clear();
+            // Bounds and average size of the people
+            auto minX = std::numeric_limits<T>::max();
+            auto minY = std::numeric_limits<T>::max();
+            auto maxX = std::numeric_limits<T>::lowest();
+            auto maxY = std::numeric_limits<T>::lowest();
+            auto sizeSum = T(0);
+            auto numberValid = 0;
+            for (const auto& rectangle : mRectangles)
+            {
+                if (isRectangleValid(rectangle))
+                {
+                    minX = fastMin(minX, rectangle.x);
+                    minY = fastMin(minY, rectangle.y);
+                    maxX = fastMax(maxX, rectangle.x + rectangle.width);
+                    maxY = fastMax(maxY, rectangle.y + rectangle.height);
+                    sizeSum += fastMax(rectangle.width, rectangle.height);
+                    numberValid++;
+                }
+            }
+            if (numberValid == 0)
+                return;
+            // Grid: cells as big as the average person, enlarged if there would be too many of them
+            mOrigin = Point<T>{minX, minY};
+            mCellSize = sizeSum / numberValid;
+            const auto maxNumberCells = (long long)fastMax(16, MAX_CELLS_PER_PERSON*numberValid);
+            while (true)
+            {
+                const auto gridWidth = std::floor((maxX - minX) / mCellSize) + 1;
+                const auto gridHeight = std::floor((maxY - minY) / mCellSize) + 1;
+                if (gridWidth * gridHeight <= maxNumberCells)
+                {
+                    mGridSize = Point<int>{(int)gridWidth, (int)gridHeight};
+                    break;
+                }
+                mCellSize *= 2;
+            }
+            // Fill cells (2 passes: count and fill)
+            mCellStarts.assign(mGridSize.area() + 1, 0);
+            for (auto person = 0 ; person < (int)mRectangles.size() ; person++)
+            {
+                const auto cellRange = getCellRange(mRectangles[person]);
+                for (auto y = cellRange.y ; y < cellRange.y + cellRange.height ; y++)
+                    for (auto x = cellRange.x ; x < cellRange.x + cellRange.width ; x++)
+                        mCellStarts[y*mGridSize.x + x + 1]++;
+            }
+            for (auto cell = 0u ; cell + 1 < mCellStarts.size() ; cell++)
+                mCellStarts[cell+1] += mCellStarts[cell];
+            mCellPeople.resize(mCellStarts.back());
+            auto cellCursors = mCellStarts;
+            for (auto person = 0 ; person < (int)mRectangles.size() ; person++)
+            {
+                const auto cellRange = getCellRange(mRectangles[person]);
+                for (auto y = cellRange.y ; y < cellRange.y + cellRange.height ; y++)
+                    for (auto x = cellRange.x ; x < cellRange.x + cellRange.width ; x++)
+                        mCellPeople[cellCursors[y*mGridSize.x + x]++] = person;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename T>
+    std::vector<int> PeopleSpatialIndex<T>::getOverlappingPeople(const Rectangle<T>& rectangle) const
+    {
+        try
+        {
+            std::vector<int> overlappingPeople;
+            const auto cellRange = getCellRange(rectangle);
+            for (auto y = cellRange.y ; y < cellRange.y + cellRange.height ; y++)
+            {
+                for (auto x = cellRange.x ; x < cellRange.x + cellRange.width ; x++)
+                {
+                    const auto cell = y*mGridSize.x + x;
+                    for (auto index = mCellStarts[cell] ; index < mCellStarts[cell+1] ; index++)
+                    {
+                        const auto person = mCellPeople[index];
+                        if (rectanglesOverlap(rectangle, mRectangles[person]))
+                            overlappingPeople.emplace_back(person);
+                    }
+                }
+            }
+            // People spanning several cells are found more than once
+            std::sort(overlappingPeople.begin(), overlappingPeople.end());
+            overlappingPeople.erase(
+                std::unique(overlappingPeople.begin(), overlappingPeople.end()), overlappingPeople.end());
+            return overlappingPeople;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    template<typename T>
+    std::vector<int> PeopleSpatialIndex<T>::getOverlappingPeople(const int person) const
+    {
+        try
+        {
+            auto overlappingPeople = getOverlappingPeople(mRectangles.at(person));
+            overlappingPeople.erase(
+                std::remove(overlappingPeople.begin(), overlappingPeople.end(), person), overlappingPeople.end());
+            return overlappingPeople;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    template<typename T>
+    std::vector<std::pair<int, int>> PeopleSpatialIndex<T>::getOverlappingPairs() const
+    {
+        try
+        {
+            std::vector<std::pair<int, int>> overlappingPairs;
+            for (auto personA = 0 ; personA < (int)mRectangles.size() ; personA++)
+            {
+                const auto& rectangleA = mRectangles[personA];
+                const auto cellRange = getCellRange(rectangleA);
+                for (auto y = cellRange.y ; y < cellRange.y + cellRange.height ; y++)
+                {
+                    for (auto x = cellRange.x ; x < cellRange.x + cellRange.width ; x++)
+                    {
+                        const auto cell = y*mGridSize.x + x;
+                        for (auto index = mCellStarts[cell] ; index < mCellStarts[cell+1] ; index++)
+                        {
+                            const auto personB = mCellPeople[index];
+                            const auto& rectangleB = mRectangles[personB];
+                            if (personA < personB && rectanglesOverlap(rectangleA, rectangleB))
+                            {
+                                // Each pair is only added from the cell containing the top-left corner of their
+                                // intersection (both people are in that cell), so it is not repeated
+                                const auto intersectionCell = getCellRange(Rectangle<T>{
+                                    fastMax(rectangleA.x, rectangleB.x), fastMax(rectangleA.y, rectangleB.y),
+                                    T(0), T(0)});
+                                if (intersectionCell.x == x && intersectionCell.y == y)
+                                    overlappingPairs.emplace_back(std::make_pair(personA, personB));
+                            }
+                        }
+                    }
+                }
+            }
+            return overlappingPairs;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    template<typename T>
+    Rectangle<int> PeopleSpatialIndex<T>::getCellRange(const Rectangle<T>& rectangle) const
+    {
+        try
+        {
+            // Points (i.e., width = height = 0) are only used internally to locate a cell
+            const auto isPoint = (rectangle.width == T(0) && rectangle.height == T(0)
+                                  && std::isfinite(rectangle.x) && std::isfinite(rectangle.y));
+            if (mCellStarts.empty() || (!isRectangleValid(rectangle) && !isPoint))
+                return Rectangle<int>{};
+            // Clamped to the grid before casting to int (coordinates might be huge)
+            const auto getCell = [&](const T coordinate, const T origin, const int gridSize)
+            {
+                return (int)fastMin(fastMax(std::floor((coordinate - origin) / mCellSize), T(0)), T(gridSize-1));
+            };
+            const auto xMin = getCell(rectangle.x, mOrigin.x, mGridSize.x);
+            const auto yMin = getCell(rectangle.y, mOrigin.y, mGridSize.y);
+            const auto xMax = getCell(rectangle.x + rectangle.width, mOrigin.x, mGridSize.x);
+            const auto yMax = getCell(rectangle.y + rectangle.height, mOrigin.y, mGridSize.y);
+            return Rectangle<int>{xMin, yMin, xMax - xMin + 1, yMax - yMin + 1};
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Rectangle<int>{};
+        }
+    }
+
+    COMPILE_TEMPLATE_FLOATING_TYPES_CLASS(PeopleSpatialIndex);
+}
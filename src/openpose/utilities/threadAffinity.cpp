@@ -0,0 +1,233 @@
+#include <openpose/utilities/threadAffinity.hpp>
+#include <algorithm> // std::count
+#include <fstream>
+#include <sstream>
+#include <thread>
+#ifdef _WIN32
+    #include <windows.h>
+#elif defined __linux__
+    #include <pthread.h>
+    #include <sched.h>
+    #include <unistd.h>
+    #include <sys/syscall.h>
+#endif
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+#include <openpose/utilities/fastMath.hpp>
+
+namespace op
+{
+    #ifdef __linux__
+        // Equivalent to MPOL_PREFERRED of <numaif.h>, so libnuma is not required
+        const auto MEMORY_POLICY_PREFERRED = 1;
+
+        std::string getFirstLineOfFile(const std::string& filePath)
+        {
+            try
+            {
+                std::ifstream file{filePath};
+                std::string line;
+                if (file.is_open())
+                    std::getline(file, line);
+                return line;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return "";
+            }
+        }
+    #endif
+
+    ThreadAffinity::ThreadAffinity(const std::vector<int>& cores_, const int numaNode_, const int intraOpThreads_) :
+        cores{cores_},
+        numaNode{numaNode_},
+        intraOpThreads{intraOpThreads_}
+    {
+    }
+
+    bool ThreadAffinity::empty() const
+    {
+        try
+        {
+            return cores.empty() && numaNode < 0 && intraOpThreads < 1;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return true;
+        }
+    }
+
+    void applyThreadAffinity(const ThreadAffinity& threadAffinity)
+    {
+        try
+        {
+            // CPU pinning
+            if (!threadAffinity.cores.empty())
+            {
+                #ifdef _WIN32
+                    DWORD_PTR mask = 0;
+                    for (const auto core : threadAffinity.cores)
+                        if (core >= 0 && core < 8*(int)sizeof(DWORD_PTR))
+                            mask |= (DWORD_PTR(1) << core);
+                    if (mask == 0 || SetThreadAffinityMask(GetCurrentThread(), mask) == 0)
+                        opLog("Thread affinity could not be set.", Priority::High);
+                #elif defined __linux__
+                    cpu_set_t cpuSet;
+                    CPU_ZERO(&cpuSet);
+                    for (const auto core : threadAffinity.cores)
+                        if (core >= 0 && core < CPU_SETSIZE)
+                            CPU_SET(core, &cpuSet);
+                    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) != 0)
+                        opLog("Thread affinity could not be set.", Priority::High);
+                #else
+                    opLog("Thread affinity is not supported in this OS, ignored.", Priority::High);
+                #endif
+            }
+            // NUMA memory binding (preferred node, so it falls back to other nodes if it runs out of memory)
+            if (threadAffinity.numaNode >= 0)
+            {
+                #if defined __linux__ && defined SYS_set_mempolicy
+                    const auto bitsPerLong = 8*sizeof(unsigned long);
+                    std::vector<unsigned long> nodeMask(threadAffinity.numaNode / bitsPerLong + 1, 0ul);
+                    nodeMask[threadAffinity.numaNode / bitsPerLong] |= 1ul << (threadAffinity.numaNode % bitsPerLong);
+                    if (syscall(SYS_set_mempolicy, MEMORY_POLICY_PREFERRED, nodeMask.data(),
+                                nodeMask.size() * bitsPerLong + 1) != 0)
+                        opLog("NUMA memory policy could not be set.", Priority::High);
+                #else
+                    opLog("NUMA memory binding is not supported in this OS, ignored.", Priority::High);
+                #endif
+            }
+            // Intra-op threads (per calling thread in OpenMP, so each pose thread can have its own value)
+            if (threadAffinity.intraOpThreads > 0)
+            {
+                #ifdef _OPENMP
+                    omp_set_num_threads(threadAffinity.intraOpThreads);
+                #else
+                    opLog("OpenMP not enabled, the number of intra-op threads cannot be modified.", Priority::High);
+                #endif
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    int getNumberCpuCores()
+    {
+        try
+        {
+            return fastMax(1, (int)std::thread::hardware_concurrency());
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 1;
+        }
+    }
+
+    int getNumberNumaNodes()
+    {
+        try
+        {
+            #ifdef __linux__
+                // E.g., "0-1"
+                const auto nodes = coreListToVector(getFirstLineOfFile("/sys/devices/system/node/online"));
+                return (nodes.empty() ? 1 : nodes.back() + 1);
+            #else
+                return 1;
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 1;
+        }
+    }
+
+    std::vector<int> getNumaNodeCores(const int numaNode)
+    {
+        try
+        {
+            std::vector<int> cores;
+            #ifdef __linux__
+                cores = coreListToVector(getFirstLineOfFile(
+                    "/sys/devices/system/node/node" + std::to_string(numaNode) + "/cpulist"));
+            #endif
+            // NUMA not exposed --> All cores in node 0
+            if (cores.empty() && numaNode == 0)
+            {
+                cores.resize(getNumberCpuCores());
+                for (auto i = 0u ; i < cores.size() ; i++)
+                    cores[i] = (int)i;
+            }
+            return cores;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    std::vector<int> coreListToVector(const std::string& coreList)
+    {
+        try
+        {
+            std::vector<int> cores;
+            std::stringstream stringStream{coreList};
+            std::string range;
+            while (std::getline(stringStream, range, ','))
+            {
+                if (range.empty())
+                    continue;
+                const auto dashPosition = range.find('-');
+                const auto first = std::stoi(range.substr(0, dashPosition));
+                const auto last = (dashPosition == std::string::npos
+                                   ? first : std::stoi(range.substr(dashPosition+1)));
+                if (first < 0 || last < first)
+                    error("Invalid core range `" + range + "` in `" + coreList + "`.",
+                          __LINE__, __FUNCTION__, __FILE__);
+                for (auto core = first ; core <= last ; core++)
+                    cores.emplace_back(core);
+            }
+            return cores;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    int getNumaNodeFromCores(const std::vector<int>& cores)
+    {
+        try
+        {
+            auto bestNumaNode = -1;
+            auto bestNumberCores = 0l;
+            const auto numberNumaNodes = getNumberNumaNodes();
+            for (auto numaNode = 0 ; numaNode < numberNumaNodes ; numaNode++)
+            {
+                const auto numaNodeCores = getNumaNodeCores(numaNode);
+                auto numberCores = 0l;
+                for (const auto core : cores)
+                    numberCores += std::count(numaNodeCores.begin(), numaNodeCores.end(), core);
+                if (numberCores > bestNumberCores)
+                {
+                    bestNumaNode = numaNode;
+                    bestNumberCores = numberCores;
+                }
+            }
+            return bestNumaNode;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return -1;
+        }
+    }
+}
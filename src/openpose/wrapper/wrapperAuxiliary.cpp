@@ -1,6 +1,8 @@
 #include <openpose/wrapper/wrapperAuxiliary.hpp>
 #include <openpose/gpu/gpu.hpp>
 #include <openpose/thread/enumClasses.hpp>
+#include <openpose/utilities/fastMath.hpp>
+#include <openpose/utilities/string.hpp>
 
 namespace op
 {
@@ -56,6 +58,14 @@ namespace op
                                      " in binary mode.";
                 error(message, __LINE__, __FUNCTION__, __FILE__);
             }
+            // Packed keypoints
+            if (wrapperStructOutput.udpKeypoints && wrapperStructOutput.udpHost.empty())
+                error("Sending the keypoints through UDP (`--udp_keypoints`) requires an UDP host (`--udp_host`).",
+                      __LINE__, __FUNCTION__, __FILE__);
+            if ((wrapperStructOutput.udpKeypoints || wrapperStructOutput.writeKeypointFormat == DataFormat::Bin)
+                && !(wrapperStructOutput.packedKeypointResolution > 0.))
+                error("The resolution of the packed keypoints (`--packed_keypoint_resolution`) must be positive.",
+                      __LINE__, __FUNCTION__, __FILE__);
             if (userOutputWsEmpty && threadManagerMode != ThreadManagerMode::Asynchronous
                 && threadManagerMode != ThreadManagerMode::AsynchronousOut)
             {
@@ -79,7 +89,7 @@ namespace op
                                          + additionalMessage;
                     error(message, __LINE__, __FUNCTION__, __FILE__);
                 }
-                if (!guiEnabled && !savingSomething)
+                if (!guiEnabled && !savingSomething && !wrapperStructOutput.udpKeypoints)
                 {
                     const auto message = "No output is selected (`--display 0`) and no results are generated (no"
                                          " `--write_X` flags enabled). Thus, no output would be generated."
@@ -144,6 +154,27 @@ namespace op
                 error("Set `--number_people_max 1` when using `--3d`. The 3-D reconstruction demo assumes there is"
                       " at most 1 person on each image.", __LINE__, __FUNCTION__, __FILE__);
             }
+            // Monocular 3-D lifting
+            if (wrapperStructExtra.groundPlane3d)
+            {
+                if (wrapperStructExtra.reconstruct3d)
+                    error("`--3d_ground_plane` (single camera) and `--3d` (multiple cameras) are not compatible.",
+                          __LINE__, __FUNCTION__, __FILE__);
+                if (wrapperStructPose.poseMode == PoseMode::Disabled)
+                    error("`--3d_ground_plane` requires the body keypoint detector to be enabled.",
+                          __LINE__, __FUNCTION__, __FILE__);
+            }
+            // 3-D guided 2-D refinement
+            if (wrapperStructExtra.refinement3d > 0)
+            {
+                if (!wrapperStructExtra.reconstruct3d)
+                    opLog("Warning: `--3d_refinement` has no effect if `--3d` is disabled.", Priority::High);
+                // It reshapes the net input for each frame, which is only possible for the CUDA version
+                #if defined USE_MKL || defined USE_OPENCL
+                    error("`--3d_refinement` is not available for Caffe OpenCL and MKL versions.",
+                          __LINE__, __FUNCTION__, __FILE__);
+                #endif
+            }
             // If CPU mode, #GPU cannot be > 0
             if (getGpuMode() == GpuMode::NoGpu)
                 if (wrapperStructPose.gpuNumber > 0)
@@ -209,4 +240,500 @@ namespace op
             error(e.what(), __LINE__, __FUNCTION__, __FILE__);
         }
     }
+
+    std::vector<ThreadAffinity> getThreadAffinities(
+        const WrapperStructExtra& wrapperStructExtra, const unsigned long long numberThreads,
+        const std::vector<unsigned long long>& poseThreadIds)
+    {
+        try
+        {
+            std::vector<ThreadAffinity> threadAffinities(numberThreads);
+            const auto threadAffinity = wrapperStructExtra.threadAffinity.getStdString();
+            const auto numberNumaNodes = getNumberNumaNodes();
+            // Automatic - Distribute the pose threads across the NUMA nodes, splitting the cores of each node among
+            // the pose threads assigned to it
+            if (threadAffinity == "auto")
+            {
+                for (auto numaNode = 0 ; numaNode < numberNumaNodes ; numaNode++)
+                {
+                    std::vector<unsigned long long> numaNodeThreadIds;
+                    for (auto i = (unsigned long long)numaNode ; i < poseThreadIds.size() ; i += numberNumaNodes)
+                        numaNodeThreadIds.emplace_back(poseThreadIds[i]);
+                    const auto numaNodeCores = getNumaNodeCores(numaNode);
+                    if (numaNodeThreadIds.empty() || numaNodeCores.empty())
+                        continue;
+                    for (auto i = 0u ; i < numaNodeThreadIds.size() ; i++)
+                    {
+                        // Not enough cores -> Threads share them
+                        const auto coreBegin = (numaNodeCores.size() * i / numaNodeThreadIds.size());
+                        const auto coreEnd = fastMax(
+                            coreBegin + 1, numaNodeCores.size() * (i+1) / numaNodeThreadIds.size());
+                        auto& threadAffinityI = threadAffinities.at(numaNodeThreadIds[i]);
+                        threadAffinityI.cores = std::vector<int>(
+                            numaNodeCores.begin() + fastMin(coreBegin, numaNodeCores.size()-1),
+                            numaNodeCores.begin() + fastMin(coreEnd, numaNodeCores.size()));
+                        if (numberNumaNodes > 1)
+                            threadAffinityI.numaNode = numaNode;
+                    }
+                }
+            }
+            // Manual - Cores of each thread id
+            else if (!threadAffinity.empty())
+            {
+                const auto threadCores = splitString(threadAffinity, ";");
+                if (threadCores.size() > numberThreads)
+                    opLog("More thread affinities (" + std::to_string(threadCores.size()) + ") than threads ("
+                          + std::to_string(numberThreads) + "), the extra ones will be ignored.", Priority::High);
+                for (auto threadId = 0u ; threadId < threadCores.size() && threadId < numberThreads ; threadId++)
+                {
+                    auto& threadAffinityI = threadAffinities[threadId];
+                    threadAffinityI.cores = coreListToVector(threadCores[threadId]);
+                    if (numberNumaNodes > 1 && !threadAffinityI.cores.empty())
+                        threadAffinityI.numaNode = getNumaNodeFromCores(threadAffinityI.cores);
+                }
+            }
+            // Intra-op threads of the pose threads
+            if (wrapperStructExtra.intraOpThreads > 0)
+            {
+                for (const auto poseThreadId : poseThreadIds)
+                    threadAffinities.at(poseThreadId).intraOpThreads = wrapperStructExtra.intraOpThreads;
+            }
+            else if (wrapperStructExtra.intraOpThreads < 0 && !poseThreadIds.empty())
+            {
+                // Cores not used by the rest of pipeline threads, split among the pose threads
+                const auto numberOtherThreads = (long long)numberThreads - (long long)poseThreadIds.size();
+                const auto freeCores = fastMax(
+                    (long long)poseThreadIds.size(), (long long)getNumberCpuCores() - numberOtherThreads);
+                const auto intraOpThreads = (int)(freeCores / (long long)poseThreadIds.size());
+                for (const auto poseThreadId : poseThreadIds)
+                {
+                    auto& threadAffinityI = threadAffinities.at(poseThreadId);
+                    // If pinned, no more threads than cores
+                    threadAffinityI.intraOpThreads = (threadAffinityI.cores.empty()
+                        ? intraOpThreads : fastMin(intraOpThreads, (int)threadAffinityI.cores.size()));
+                }
+            }
+            // Logging
+            for (auto threadId = 0u ; threadId < threadAffinities.size() ; threadId++)
+            {
+                const auto& threadAffinityI = threadAffinities[threadId];
+                if (!threadAffinityI.empty())
+                    opLog("Thread " + std::to_string(threadId) + ": " + std::to_string(threadAffinityI.cores.size())
+                          + " cores, NUMA node " + std::to_string(threadAffinityI.numaNode) + ", "
+                          + std::to_string(threadAffinityI.intraOpThreads) + " intra-op threads.", Priority::High);
+            }
+            return threadAffinities;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    WrapperPoseLayout getWrapperPoseLayout(
+        const WrapperStructPose& wrapperStructPose, const WrapperStructFace& wrapperStructFace,
+        const WrapperStructHand& wrapperStructHand)
+    {
+        try
+        {
+            WrapperPoseLayout wrapperPoseLayout;
+            // Rendering
+            const auto gpuMode = getGpuMode();
+            const auto renderModePose = (
+                wrapperStructPose.renderMode != RenderMode::Auto
+                    ? wrapperStructPose.renderMode
+                    : (gpuMode == GpuMode::Cuda ? RenderMode::Gpu : RenderMode::Cpu));
+            const auto renderModeFace = (
+                wrapperStructFace.renderMode != RenderMode::Auto
+                    ? wrapperStructFace.renderMode
+                    : (gpuMode == GpuMode::Cuda ? RenderMode::Gpu : RenderMode::Cpu));
+            const auto renderModeHand = (
+                wrapperStructHand.renderMode != RenderMode::Auto
+                    ? wrapperStructHand.renderMode
+                    : (gpuMode == GpuMode::Cuda ? RenderMode::Gpu : RenderMode::Cpu));
+            const auto renderOutput = renderModePose != RenderMode::None
+                                        || renderModeFace != RenderMode::None
+                                        || renderModeHand != RenderMode::None;
+            const bool renderOutputGpu = renderModePose == RenderMode::Gpu
+                || (wrapperStructFace.enable && renderModeFace == RenderMode::Gpu)
+                || (wrapperStructHand.enable && renderModeHand == RenderMode::Gpu);
+            const bool renderFace = wrapperStructFace.enable && renderModeFace != RenderMode::None;
+            const bool renderHand = wrapperStructHand.enable && renderModeHand != RenderMode::None;
+            const bool renderHandGpu = wrapperStructHand.enable && renderModeHand == RenderMode::Gpu;
+            opLog("renderModePose = " + std::to_string(int(renderModePose)), Priority::Normal);
+            opLog("renderModeFace = " + std::to_string(int(renderModeFace)), Priority::Normal);
+            opLog("renderModeHand = " + std::to_string(int(renderModeHand)), Priority::Normal);
+            opLog("renderOutput = " + std::to_string(int(renderOutput)), Priority::Normal);
+            opLog("renderOutputGpu = " + std::to_string(int(renderOutput)), Priority::Normal);
+            opLog("renderFace = " + std::to_string(int(renderFace)), Priority::Normal);
+            opLog("renderHand = " + std::to_string(int(renderHand)), Priority::Normal);
+            opLog("renderHandGpu = " + std::to_string(int(renderHandGpu)), Priority::Normal);
+            wrapperPoseLayout.renderModePose = renderModePose;
+            wrapperPoseLayout.renderModeFace = renderModeFace;
+            wrapperPoseLayout.renderModeHand = renderModeHand;
+            wrapperPoseLayout.renderOutput = renderOutput;
+            wrapperPoseLayout.renderOutputGpu = renderOutputGpu;
+            wrapperPoseLayout.renderFace = renderFace;
+            wrapperPoseLayout.renderHand = renderHand;
+            wrapperPoseLayout.renderHandGpu = renderHandGpu;
+            wrapperPoseLayout.renderCpu = (wrapperStructPose.poseMode != PoseMode::Disabled
+                                           && renderModePose == RenderMode::Cpu)
+                || (renderFace && renderModeFace == RenderMode::Cpu)
+                || (renderHand && renderModeHand == RenderMode::Cpu);
+
+            // Get number threads
+            auto numberGpuThreads = wrapperStructPose.gpuNumber;
+            auto gpuNumberStart = wrapperStructPose.gpuNumberStart;
+            opLog("numberGpuThreads = " + std::to_string(numberGpuThreads), Priority::Normal);
+            opLog("gpuNumberStart = " + std::to_string(gpuNumberStart), Priority::Normal);
+            // CPU --> 1 thread or no pose extraction
+            if (gpuMode == GpuMode::NoGpu)
+            {
+                numberGpuThreads = (wrapperStructPose.gpuNumber == 0 ? 0 : 1);
+                gpuNumberStart = 0;
+            }
+            // GPU --> user picks (<= #GPUs)
+            else
+            {
+                // Get total number GPUs
+                const auto totalGpuNumber = getGpuNumber();
+                // If number GPU < 0 --> set it to all the available GPUs
+                if (numberGpuThreads < 0)
+                {
+                    if (totalGpuNumber <= gpuNumberStart)
+                        error("Number of initial GPU (`--number_gpu_start`) must be lower than the total number of"
+                              " used GPUs (`--number_gpu`)", __LINE__, __FUNCTION__, __FILE__);
+                    numberGpuThreads = totalGpuNumber - gpuNumberStart;
+                    // Reset initial GPU to 0 (we want them all)
+                    // Logging message
+                    opLog("Auto-detecting all available GPUs... Detected " + std::to_string(totalGpuNumber)
+                        + " GPU(s), using " + std::to_string(numberGpuThreads) + " of them starting at GPU "
+                        + std::to_string(gpuNumberStart) + ".", Priority::High);
+                }
+                // Sanity check
+                if (gpuNumberStart + numberGpuThreads > totalGpuNumber)
+                    error("Initial GPU selected (`--number_gpu_start`) + number GPUs to use (`--number_gpu`) must"
+                          " be lower or equal than the total number of GPUs in your machine ("
+                          + std::to_string(gpuNumberStart) + " + "
+                          + std::to_string(numberGpuThreads) + " vs. "
+                          + std::to_string(totalGpuNumber) + ").",
+                          __LINE__, __FUNCTION__, __FILE__);
+            }
+            wrapperPoseLayout.numberGpuThreads = numberGpuThreads;
+            wrapperPoseLayout.gpuNumberStart = gpuNumberStart;
+
+            // Input cvMat to OpenPose input & output format
+            // Note: resize on GPU reduces accuracy about 0.1%
+            wrapperPoseLayout.resizeInputOnCpu = true;
+            // wrapperPoseLayout.resizeInputOnCpu = (wrapperStructPose.poseMode != PoseMode::Enabled);
+            // Note: We realized that somehow doing it on GPU for any number of GPUs does speedup the whole OP
+            const auto resizeOutputOnCpu = false;
+            wrapperPoseLayout.addCvMatToOpOutput = renderOutput;
+            wrapperPoseLayout.addCvMatToOpOutputInCpu = renderOutput
+                && (numberGpuThreads <= 0 || resizeOutputOnCpu || !renderOutputGpu
+                    || wrapperStructPose.poseMode != PoseMode::Enabled
+                    // Resize in GPU causing bug
+                    || wrapperStructPose.outputSize.x != -1 || wrapperStructPose.outputSize.y != -1);
+            return wrapperPoseLayout;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return WrapperPoseLayout{};
+        }
+    }
+
+    bool wrapperReconfigureOnRuntime(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperStructPose& wrapperStructPoseRunning,
+        const WrapperStructPose& wrapperStructPose, const WrapperStructExtra& wrapperStructExtra)
+    {
+        try
+        {
+            const auto& running = wrapperStructPoseRunning;
+            const auto& desired = wrapperStructPose;
+            // Parameters that require re-configuring the ThreadManager
+            if (running.poseMode != desired.poseMode
+                || running.netInputSizeDynamicBehavior != desired.netInputSizeDynamicBehavior
+                || running.outputSize != desired.outputSize
+                || running.keypointScaleMode != desired.keypointScaleMode
+                || running.gpuNumber != desired.gpuNumber
+                || running.gpuNumberStart != desired.gpuNumberStart
+                || running.renderMode != desired.renderMode
+                || running.poseModel != desired.poseModel
+                || running.modelFolder.getStdString() != desired.modelFolder.getStdString()
+                || running.heatMapTypes != desired.heatMapTypes
+                || running.heatMapScaleMode != desired.heatMapScaleMode
+                || running.addPartCandidates != desired.addPartCandidates
+                || running.renderThreshold != desired.renderThreshold
+                || running.maximizePositives != desired.maximizePositives
+                || running.fpsMax != desired.fpsMax
+                || running.protoTxtPath.getStdString() != desired.protoTxtPath.getStdString()
+                || running.caffeModelPath.getStdString() != desired.caffeModelPath.getStdString()
+                || running.upsamplingRatio != desired.upsamplingRatio
+                || running.enableGoogleLogging != desired.enableGoogleLogging
+                || running.fastStartup != desired.fastStartup)
+                return false;
+            // Runtime-modifiable parameters
+            const auto netInputChanged = running.netInputSize != desired.netInputSize
+                || running.scalesNumber != desired.scalesNumber || running.scaleGap != desired.scaleGap;
+            const auto numberPeopleMaxChanged = running.numberPeopleMax != desired.numberPeopleMax;
+            const auto renderingChanged = running.blendOriginalFrame != desired.blendOriginalFrame
+                || running.alphaKeypoint != desired.alphaKeypoint || running.alphaHeatMap != desired.alphaHeatMap
+                || running.defaultPartToRender != desired.defaultPartToRender;
+            // They can only be applied if their Workers exist
+            // KeypointScaler is only added if netInputSize != producer size (for NetOutputResolution)
+            if (netInputChanged && (wrapperRuntimeHandles.spScaleAndSizeExtractor == nullptr
+                                    || desired.keypointScaleMode == ScaleMode::NetOutputResolution))
+                return false;
+            // PoseExtractor also uses numberPeopleMax for tracking
+            if (numberPeopleMaxChanged && (wrapperRuntimeHandles.spKeepTopNPeople == nullptr
+                                           || wrapperStructExtra.tracking > -1))
+                return false;
+            // If RenderMode::None, the pose renderers (if any) are created with alpha = 0
+            if (renderingChanged && (wrapperRuntimeHandles.poseRenderers.empty()
+                                     || desired.renderMode == RenderMode::None))
+                return false;
+            // Apply changes
+            if (netInputChanged)
+                wrapperRuntimeHandles.spScaleAndSizeExtractor->setNetInputResolution(
+                    desired.netInputSize, desired.scalesNumber, desired.scaleGap);
+            if (numberPeopleMaxChanged)
+                wrapperRuntimeHandles.spKeepTopNPeople->setNumberPeopleMax(desired.numberPeopleMax);
+            if (renderingChanged)
+            {
+                for (const auto& renderer : wrapperRuntimeHandles.poseRenderers)
+                {
+                    renderer->setBlendOriginalFrame(desired.blendOriginalFrame);
+                    renderer->setAlphaKeypoint(desired.alphaKeypoint);
+                    renderer->setAlphaHeatMap(desired.alphaHeatMap);
+                    if (running.defaultPartToRender != desired.defaultPartToRender)
+                        renderer->setElementToRender(desired.defaultPartToRender);
+                }
+            }
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    bool wrapperReconfigureOnRuntime(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperStructFace& wrapperStructFaceRunning,
+        const WrapperStructFace& wrapperStructFace)
+    {
+        try
+        {
+            const auto& running = wrapperStructFaceRunning;
+            const auto& desired = wrapperStructFace;
+            // Parameters that require re-configuring the ThreadManager
+            if (running.detector != desired.detector
+                || running.netInputSize != desired.netInputSize
+                || running.renderMode != desired.renderMode
+                || running.alphaKeypoint != desired.alphaKeypoint
+                || running.alphaHeatMap != desired.alphaHeatMap
+                || running.renderThreshold != desired.renderThreshold)
+                return false;
+            // Enable/disable (only if the face networks were created)
+            if (running.enable != desired.enable)
+            {
+                if (wrapperRuntimeHandles.faceExtractorNets.empty())
+                    return false;
+                for (const auto& faceExtractorNet : wrapperRuntimeHandles.faceExtractorNets)
+                    faceExtractorNet->setEnabled(desired.enable);
+            }
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    bool wrapperReconfigureOnRuntime(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperStructHand& wrapperStructHandRunning,
+        const WrapperStructHand& wrapperStructHand)
+    {
+        try
+        {
+            const auto& running = wrapperStructHandRunning;
+            const auto& desired = wrapperStructHand;
+            // Parameters that require re-configuring the ThreadManager
+            if (running.detector != desired.detector
+                || running.netInputSize != desired.netInputSize
+                || running.scalesNumber != desired.scalesNumber
+                || running.scaleRange != desired.scaleRange
+                || running.renderMode != desired.renderMode
+                || running.alphaKeypoint != desired.alphaKeypoint
+                || running.alphaHeatMap != desired.alphaHeatMap
+                || running.renderThreshold != desired.renderThreshold)
+                return false;
+            // Enable/disable (only if the hand networks were created)
+            if (running.enable != desired.enable)
+            {
+                if (wrapperRuntimeHandles.handExtractorNets.empty())
+                    return false;
+                for (const auto& handExtractorNet : wrapperRuntimeHandles.handExtractorNets)
+                    handExtractorNet->setEnabled(desired.enable);
+            }
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    bool wrapperReconfigurePoseExtractors(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperPoseLayout& wrapperPoseLayoutRunning,
+        const WrapperPoseLayout& wrapperPoseLayout, const WrapperStructPose& wrapperStructPoseRunning,
+        const WrapperStructPose& wrapperStructPose, const WrapperStructGui& wrapperStructGui)
+    {
+        try
+        {
+            const auto& running = wrapperStructPoseRunning;
+            const auto& desired = wrapperStructPose;
+            const auto& layoutRunning = wrapperPoseLayoutRunning;
+            const auto& layout = wrapperPoseLayout;
+            // The GUI keeps the networks and renderers (e.g., to modify them with the keyboard)
+            if (wrapperStructGui.displayMode != DisplayMode::NoDisplay)
+                return false;
+            // Same number of GPU threads, and no TWorker is added or removed out of them
+            if (layoutRunning.numberGpuThreads <= 0
+                || layoutRunning.numberGpuThreads != layout.numberGpuThreads
+                || layoutRunning.renderCpu || layout.renderCpu
+                || layoutRunning.resizeInputOnCpu != layout.resizeInputOnCpu
+                || layoutRunning.addCvMatToOpOutput != layout.addCvMatToOpOutput
+                || layoutRunning.addCvMatToOpOutputInCpu != layout.addCvMatToOpOutputInCpu)
+                return false;
+            // Parameters used by the TWorkers out of the GPU threads (input resize, keypoint scaler, heat map saver,
+            // FPS limiter, etc.)
+            if (running.poseModel != desired.poseModel
+                || running.netInputSizeDynamicBehavior != desired.netInputSizeDynamicBehavior
+                || running.outputSize != desired.outputSize
+                || running.keypointScaleMode != desired.keypointScaleMode
+                || running.heatMapTypes != desired.heatMapTypes
+                || running.heatMapScaleMode != desired.heatMapScaleMode
+                || running.fpsMax != desired.fpsMax)
+                return false;
+            // Net input resolution and scales (the ScaleAndSizeExtractor is kept)
+            if (running.netInputSize != desired.netInputSize || running.scalesNumber != desired.scalesNumber
+                || running.scaleGap != desired.scaleGap)
+            {
+                // KeypointScaler is only added if netInputSize != producer size (for NetOutputResolution)
+                if (wrapperRuntimeHandles.spScaleAndSizeExtractor == nullptr
+                    || desired.keypointScaleMode == ScaleMode::NetOutputResolution)
+                    return false;
+                wrapperRuntimeHandles.spScaleAndSizeExtractor->setNetInputResolution(
+                    desired.netInputSize, desired.scalesNumber, desired.scaleGap);
+            }
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    std::vector<std::shared_ptr<PoseExtractorNet>> getReusablePoseExtractorNets(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperStructPose& wrapperStructPoseRunning,
+        const WrapperStructPose& wrapperStructPose)
+    {
+        try
+        {
+            const auto& running = wrapperStructPoseRunning;
+            const auto& desired = wrapperStructPose;
+            // Parameters of the PoseExtractorCaffe constructor
+            if (desired.poseMode == PoseMode::Disabled
+                || running.poseMode != desired.poseMode
+                || running.poseModel != desired.poseModel
+                || running.modelFolder.getStdString() != desired.modelFolder.getStdString()
+                || running.gpuNumberStart != desired.gpuNumberStart
+                || running.heatMapTypes != desired.heatMapTypes
+                || running.heatMapScaleMode != desired.heatMapScaleMode
+                || running.addPartCandidates != desired.addPartCandidates
+                || running.maximizePositives != desired.maximizePositives
+                || running.protoTxtPath.getStdString() != desired.protoTxtPath.getStdString()
+                || running.caffeModelPath.getStdString() != desired.caffeModelPath.getStdString()
+                || running.upsamplingRatio != desired.upsamplingRatio
+                || running.enableGoogleLogging != desired.enableGoogleLogging
+                || running.fastStartup != desired.fastStartup)
+                return {};
+            return wrapperRuntimeHandles.poseExtractorNets;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    // Parameters of the WrapperStructPose used by the FaceExtractorCaffe and HandExtractorCaffe constructors
+    bool sameFaceAndHandNetParameters(
+        const WrapperStructPose& wrapperStructPoseRunning, const WrapperStructPose& wrapperStructPose)
+    {
+        try
+        {
+            const auto& running = wrapperStructPoseRunning;
+            const auto& desired = wrapperStructPose;
+            return running.modelFolder.getStdString() == desired.modelFolder.getStdString()
+                && running.gpuNumberStart == desired.gpuNumberStart
+                && running.heatMapTypes == desired.heatMapTypes
+                && running.heatMapScaleMode == desired.heatMapScaleMode
+                && running.enableGoogleLogging == desired.enableGoogleLogging
+                && running.fastStartup == desired.fastStartup;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    std::vector<std::shared_ptr<FaceExtractorNet>> getReusableFaceExtractorNets(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperStructPose& wrapperStructPoseRunning,
+        const WrapperStructFace& wrapperStructFaceRunning, const WrapperStructPose& wrapperStructPose,
+        const WrapperStructFace& wrapperStructFace)
+    {
+        try
+        {
+            if (!wrapperStructFace.enable
+                || wrapperStructFaceRunning.netInputSize != wrapperStructFace.netInputSize
+                || !sameFaceAndHandNetParameters(wrapperStructPoseRunning, wrapperStructPose))
+                return {};
+            return wrapperRuntimeHandles.faceExtractorNets;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    std::vector<std::shared_ptr<HandExtractorNet>> getReusableHandExtractorNets(
+        const WrapperRuntimeHandles& wrapperRuntimeHandles, const WrapperStructPose& wrapperStructPoseRunning,
+        const WrapperStructHand& wrapperStructHandRunning, const WrapperStructPose& wrapperStructPose,
+        const WrapperStructHand& wrapperStructHand)
+    {
+        try
+        {
+            if (!wrapperStructHand.enable
+                || wrapperStructHandRunning.netInputSize != wrapperStructHand.netInputSize
+                || wrapperStructHandRunning.scalesNumber != wrapperStructHand.scalesNumber
+                || wrapperStructHandRunning.scaleRange != wrapperStructHand.scaleRange
+                || !sameFaceAndHandNetParameters(wrapperStructPoseRunning, wrapperStructPose))
+                return {};
+            return wrapperRuntimeHandles.handExtractorNets;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
 }
@@ -0,0 +1,21 @@
+#include <openpose/wrapper/wrapperRuntimeHandles.hpp>
+
+namespace op
+{
+    void WrapperRuntimeHandles::clear()
+    {
+        try
+        {
+            spScaleAndSizeExtractor.reset();
+            spKeepTopNPeople.reset();
+            poseRenderers.clear();
+            poseExtractorNets.clear();
+            faceExtractorNets.clear();
+            handExtractorNets.clear();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+}
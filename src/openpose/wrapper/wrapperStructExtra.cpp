@@ -4,12 +4,17 @@ namespace op
 {
     WrapperStructExtra::WrapperStructExtra(
         const bool reconstruct3d_, const int minViews3d_, const bool identification_, const int tracking_,
-        const int ikThreads_) :
+        const int ikThreads_, const String& threadAffinity_, const int intraOpThreads_, const int refinement3d_,
+        const bool groundPlane3d_) :
         reconstruct3d{reconstruct3d_},
         minViews3d{minViews3d_},
         identification{identification_},
         tracking{tracking_},
-        ikThreads{ikThreads_}
+        ikThreads{ikThreads_},
+        threadAffinity{threadAffinity_},
+        intraOpThreads{intraOpThreads_},
+        refinement3d{refinement3d_},
+        groundPlane3d{groundPlane3d_}
     {
     }
 }
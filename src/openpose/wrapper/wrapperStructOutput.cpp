@@ -9,7 +9,7 @@ namespace op
         const String& writeVideo_, const double writeVideoFps_, const bool writeVideoWithAudio_,
         const String& writeHeatMaps_, const String& writeHeatMapsFormat_, const String& writeVideo3D_,
         const String& writeVideoAdam_, const String& writeBvh_, const String& udpHost_,
-        const String& udpPort_) :
+        const String& udpPort_, const double packedKeypointResolution_, const bool udpKeypoints_) :
         verbose{verbose_},
         writeKeypoint{writeKeypoint_},
         writeKeypointFormat{writeKeypointFormat_},
@@ -28,7 +28,9 @@ namespace op
         writeVideoAdam{writeVideoAdam_},
         writeBvh{writeBvh_},
         udpHost{udpHost_},
-        udpPort{udpPort_}
+        udpPort{udpPort_},
+        packedKeypointResolution{packedKeypointResolution_},
+        udpKeypoints{udpKeypoints_}
     {
         try
         {